@@ -0,0 +1,22 @@
+// Counts heap allocations made by the benchmarks (see benchAllocations())
+#include <new>
+#include <stdlib.h>
+
+#include "bench.h"
+
+static unsigned long allocations = 0;
+
+unsigned long benchAllocations() { return allocations; }
+
+void *operator new(size_t size) {
+  allocations++;
+  void *p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
@@ -0,0 +1,43 @@
+// Host benchmarks for [env:bench]
+#pragma once
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+// Deterministic inputs (xorshift64*)
+class BenchRng {
+public:
+  explicit BenchRng(uint64_t seed) : state_(seed ? seed : 1) {}
+  uint32_t next() {
+    state_ ^= state_ >> 12;
+    state_ ^= state_ << 25;
+    state_ ^= state_ >> 27;
+    return (uint32_t)((state_ * 0x2545F4914F6CDD1DULL) >> 32);
+  }
+  uint32_t below(uint32_t n) { return next() % n; }
+
+private:
+  uint64_t state_;
+};
+
+inline double benchSeconds() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Heap allocations so far (operator new)
+unsigned long benchAllocations();
+
+// Each benchmark returns 0 on success and non-zero if a check failed
+int benchFrame(int argc, char **argv);
+int benchReliable(int argc, char **argv);
+int benchMesh(int argc, char **argv);
+int benchCodec(int argc, char **argv);
+int benchCrypto(int argc, char **argv);
+int benchBulk(int argc, char **argv);
+int benchKnob(int argc, char **argv);
+int benchT9(int argc, char **argv);
+int benchWire(int argc, char **argv);
+int benchHistory(int argc, char **argv);
+int benchSearch(int argc, char **argv);
+int benchMetrics(int argc, char **argv);
@@ -0,0 +1,119 @@
+// Bulk Caesar kernels: the 256-entry table and the word-at-a-time rotate
+// against the per-character loop they replaced, over buffers the size of
+// one history entry up to the whole log. Both are first checked against
+// the loop for every byte value and shift.
+//
+//   bulk [megabytes per run]
+#include <Caesar.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "bench.h"
+
+// As in lib/Caesar before the bulk kernels
+static void branchRotate(const char *in, char *out, size_t len, int shift) {
+  int letters = ((shift % 26) + 26) % 26;
+  int digits = ((shift % 10) + 10) % 10;
+  for (size_t i = 0; i < len; i++) {
+    char c = in[i];
+    if (c >= 'A' && c <= 'Z') {
+      int v = c - 'A' + letters;
+      out[i] = 'A' + (v >= 26 ? v - 26 : v);
+    } else if (c >= '0' && c <= '9') {
+      int v = c - '0' + digits;
+      out[i] = '0' + (v >= 10 ? v - 10 : v);
+    } else {
+      out[i] = c;
+    }
+  }
+}
+
+static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 ";
+
+static long checkKernels() {
+  long mismatches = 0;
+  char all[256], expected[256], table[256], words[256];
+  for (int c = 0; c < 256; c++) all[c] = (char)c;
+  CaesarTable t;
+  for (int shift = -40; shift <= 40; shift++) {
+    branchRotate(all, expected, sizeof(all), shift);
+    caesarTable(t, shift);
+    caesarApply(t, all, table, sizeof(all));
+    caesarRotateWords(all, words, sizeof(all), shift);
+    mismatches += memcmp(expected, table, sizeof(all)) != 0;
+    mismatches += memcmp(expected, words, sizeof(all)) != 0;
+  }
+
+  // Odd lengths and offsets, in place, and decrypt undoing encrypt
+  BenchRng rng(0xB01C);
+  char text[300], buf[300];
+  for (int i = 0; i < 20000; i++) {
+    size_t offset = rng.below(8);
+    size_t len = rng.below(sizeof(text) - offset);
+    for (size_t j = 0; j < len; j++) text[offset + j] = (char)rng.next();
+    int shift = (int)rng.below(60) - 30;
+    branchRotate(text + offset, buf, len, shift);
+    caesarEncrypt(text + offset, text + offset, len, shift);
+    mismatches += memcmp(buf, text + offset, len) != 0;
+    caesarDecrypt(text + offset, text + offset, len, shift);
+    branchRotate(buf, buf, len, -shift);
+    mismatches += memcmp(buf, text + offset, len) != 0;
+  }
+  return mismatches;
+}
+
+int benchBulk(int argc, char **argv) {
+  double megabytes = argc > 1 ? atof(argv[1]) : 64;
+  long mismatches = checkKernels();
+  printf("checked          256 bytes x 81 shifts + 20000 buffers, mismatches %ld\n", mismatches);
+
+  const size_t sizes[] = {1024, 16 * 1024, 256 * 1024, 1024 * 1024};
+  const int shift = 3;
+  CaesarTable table;
+  caesarTable(table, shift);
+  BenchRng rng(0x5EED);
+
+  for (size_t len : sizes) {
+    std::vector<char> in(len), out(len), check(len);
+    for (size_t i = 0; i < len; i++) in[i] = alphabet[rng.below(sizeof(alphabet) - 1)];
+    long runs = (long)(megabytes * 1e6 / len) + 1;
+    double bytes = (double)len * runs;
+    volatile char sink = 0;
+
+    double start = benchSeconds();
+    for (long r = 0; r < runs; r++) {
+      branchRotate(in.data(), out.data(), len, shift);
+      sink = sink + out[r % len];
+    }
+    double branchSec = benchSeconds() - start;
+    branchRotate(in.data(), check.data(), len, shift);
+
+    start = benchSeconds();
+    for (long r = 0; r < runs; r++) {
+      caesarApply(table, in.data(), out.data(), len);
+      sink = sink + out[r % len];
+    }
+    double tableSec = benchSeconds() - start;
+    mismatches += memcmp(out.data(), check.data(), len) != 0;
+
+    start = benchSeconds();
+    for (long r = 0; r < runs; r++) {
+      caesarRotateWords(in.data(), out.data(), len, shift);
+      sink = sink + out[r % len];
+    }
+    double wordSec = benchSeconds() - start;
+    mismatches += memcmp(out.data(), check.data(), len) != 0;
+
+    start = benchSeconds();
+    for (long r = 0; r < runs; r++) {
+      memcpy(out.data(), in.data(), len);
+      sink = sink + out[r % len];
+    }
+    double copySec = benchSeconds() - start;
+
+    printf("%5zu KB  branch %7.0f MB/s  table %7.0f MB/s  words %7.0f MB/s  (memcpy %6.0f MB/s)\n", len / 1024,
+           bytes / branchSec / 1e6, bytes / tableSec / 1e6, bytes / wordSec / 1e6, bytes / copySec / 1e6);
+  }
+  return mismatches == 0 ? 0 : 1;
+}
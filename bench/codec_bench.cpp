@@ -0,0 +1,101 @@
+// Caesar codec: the fixed-buffer functions against the String versions they
+// replaced, for speed and heap allocations, plus an equivalence check.
+//
+//   codec [iterations]
+#include <Arduino.h>
+#include <Caesar.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+static const int shift = 3;
+
+// As in v7.cpp before the fixed-buffer codec
+static String stringEncrypt(String message) {
+  String result = "";
+  for (char c : message) {
+    if (c >= 'A' && c <= 'Z') {
+      result += char((c - 'A' + shift) % 26 + 'A');
+    } else if (isdigit(c)) {
+      result += char((c - '0' + shift) % 10 + '0');
+    } else if (c == ' ') {
+      result += ' ';
+    } else {
+      result += c;
+    }
+  }
+  return result;
+}
+
+static String stringDecrypt(String message) {
+  String result = "";
+  for (char c : message) {
+    if (c >= 'A' && c <= 'Z') {
+      result += char((c - 'A' - shift + 26) % 26 + 'A');
+    } else if (isdigit(c)) {
+      result += char((c - '0' - shift + 10) % 10 + '0');
+    } else if (c == ' ') {
+      result += ' ';
+    } else {
+      result += c;
+    }
+  }
+  return result;
+}
+
+static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 ";
+
+static void randomText(BenchRng &rng, char *buf, size_t len) {
+  for (size_t i = 0; i < len; i++) buf[i] = alphabet[rng.below(sizeof(alphabet) - 1)];
+  buf[len] = '\0';
+}
+
+int benchCodec(int argc, char **argv) {
+  long iterations = argc > 1 ? atol(argv[1]) : 20000;
+  BenchRng rng(0xCAE5A2);
+  char text[481];
+  char buf[481];
+  long mismatches = 0;
+
+  // Same output as the String versions, and decrypt undoes encrypt
+  for (long i = 0; i < iterations; i++) {
+    size_t len = rng.below(sizeof(text));
+    randomText(rng, text, len);
+    caesarEncrypt(text, buf, len, shift);
+    buf[len] = '\0';
+    if (stringEncrypt(String(text)) != buf) mismatches++;
+    caesarDecrypt(buf, buf, len, shift);
+    if (memcmp(buf, text, len) != 0) mismatches++;
+  }
+  printf("checked          %ld messages, mismatches %ld\n", iterations, mismatches);
+
+  const size_t sizes[] = {16, 64, 480};
+  for (size_t len : sizes) {
+    randomText(rng, text, len);
+    String message(text);
+    volatile size_t sink = 0;
+
+    unsigned long allocs = benchAllocations();
+    double start = benchSeconds();
+    for (long i = 0; i < iterations; i++) sink += stringDecrypt(stringEncrypt(message)).length();
+    double stringSec = benchSeconds() - start;
+    double stringAllocs = (double)(benchAllocations() - allocs) / iterations;
+
+    allocs = benchAllocations();
+    start = benchSeconds();
+    for (long i = 0; i < iterations; i++) {
+      caesarEncrypt(text, buf, len, shift);
+      caesarDecrypt(buf, buf, len, shift);
+      sink += buf[0];
+    }
+    double bufferSec = benchSeconds() - start;
+    double bufferAllocs = (double)(benchAllocations() - allocs) / iterations;
+
+    double bytes = 2.0 * len * iterations;
+    printf("%3zu B  String %7.1f MB/s %5.1f allocs/msg   buffer %7.1f MB/s %5.1f allocs/msg\n", len,
+           bytes / stringSec / 1e6, stringAllocs, bytes / bufferSec / 1e6, bufferAllocs);
+    if (bufferAllocs != 0) mismatches++;
+  }
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,175 @@
+// FrameCipher: AES-GCM known-answer tests, seal/open round trips with
+// tampering and replay, then per-frame cost next to the radio's frame rate.
+//
+//   crypto [iterations]
+//
+// On the host this measures the software AES stand-in; the ESP32-S3 runs
+// AES on its accelerator.
+#include <Frame.h>
+#include <FrameCipher.h>
+#include <mbedtls/gcm.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+static size_t unhex(const char *hex, uint8_t *out) {
+  size_t n = 0;
+  for (; hex[0] && hex[1]; hex += 2) {
+    char byte[3] = {hex[0], hex[1], 0};
+    out[n++] = (uint8_t)strtoul(byte, nullptr, 16);
+  }
+  return n;
+}
+
+struct GcmVector {
+  const char *key, *iv, *aad, *plain, *cipher, *tag;
+};
+
+// Test cases 2 and 4 of the GCM specification (McGrew and Viega)
+static const GcmVector vectors[] = {
+  {"00000000000000000000000000000000", "000000000000000000000000", "", "00000000000000000000000000000000",
+   "0388dace60b6a392f328c2b971b2fe78", "ab6e47d42cec13bdf53a67b21257bddf"},
+  {"feffe9928665731c6d6a8f9467308308", "cafebabefacedbaddecaf888", "feedfacedeadbeeffeedfacedeadbeefabaddad2",
+   "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39",
+   "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091",
+   "5bc94fbc3221a5db94fae95ae7121a47"},
+};
+
+static int knownAnswers() {
+  int failures = 0;
+  for (const GcmVector &v : vectors) {
+    uint8_t key[16], iv[12], aad[64], plain[64], expected[64], tag[16], out[64], outTag[16];
+    unhex(v.key, key);
+    unhex(v.iv, iv);
+    size_t aadLen = unhex(v.aad, aad);
+    size_t len = unhex(v.plain, plain);
+    unhex(v.cipher, expected);
+    unhex(v.tag, tag);
+
+    mbedtls_gcm_context gcm;
+    mbedtls_gcm_init(&gcm);
+    mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, key, 128);
+    mbedtls_gcm_crypt_and_tag(&gcm, MBEDTLS_GCM_ENCRYPT, len, iv, 12, aad, aadLen, plain, out, 16, outTag);
+    if (memcmp(out, expected, len) != 0 || memcmp(outTag, tag, 16) != 0) failures++;
+    if (mbedtls_gcm_auth_decrypt(&gcm, len, iv, 12, aad, aadLen, tag, 16, expected, out) != 0 ||
+        memcmp(out, plain, len) != 0) {
+      failures++;
+    }
+    mbedtls_gcm_free(&gcm);
+  }
+  printf("known answers    %d vectors, failures %d\n", (int)(sizeof(vectors) / sizeof(vectors[0])), failures);
+  return failures;
+}
+
+// Seals like ReliableLink does and returns the frame length
+static size_t sealFrame(FrameCipher &cipher, uint8_t *buf, FrameHeader h, const uint8_t *payload, size_t len) {
+  memcpy(framePayload(buf), payload, len);
+  len = cipher.seal(h, framePayload(buf), len, FRAME_MAX_PAYLOAD);
+  return len ? frameEncode(buf, FRAME_MAX_LEN, h, len) : 0;
+}
+
+int benchCrypto(int argc, char **argv) {
+  long iterations = argc > 1 ? atol(argv[1]) : 20000;
+  int failures = knownAnswers();
+
+  static const uint8_t key[FrameCipher::KEY_LEN] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+  static const uint8_t otherKey[FrameCipher::KEY_LEN] = {16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1};
+  FrameCipher a, b, stranger;
+  a.begin(key, 1);
+  b.begin(key, 2);
+  stranger.begin(otherKey, 3);
+
+  BenchRng rng(0xAE5);
+  uint8_t buf[FRAME_MAX_LEN];
+  uint8_t payload[FRAME_MAX_PAYLOAD];
+  uint8_t out[FRAME_MAX_PAYLOAD];
+  long mismatches = 0;
+  long forgeries = 0;
+
+  // Round trips, single-bit tampering, routing edits and a foreign key
+  for (long i = 0; i < iterations; i++) {
+    size_t len = rng.below(FRAME_MAX_PAYLOAD - FRAME_SEAL_OVERHEAD + 1);
+    for (size_t j = 0; j < len; j++) payload[j] = rng.next();
+    uint16_t dest = i % 4 == 0 ? FRAME_BROADCAST : 2;
+    FrameHeader h = {FRAME_TEXT, 1, dest, (uint16_t)i, FRAME_FLAG_ACK_REQ, FRAME_DEFAULT_TTL, 0};
+    size_t frameLen = sealFrame(a, buf, h, payload, len);
+
+    frameSetRouting(buf, frameLen, 2, 4);
+    frameSetFlags(buf, frameLen, frameFlags(buf) | 2 << FRAME_FLAG_ATTEMPT_SHIFT);
+    FrameView view;
+    if (!frameDecode(buf, frameLen, view) || b.open(view, out) != (int)len || memcmp(out, payload, len) != 0) {
+      mismatches++;
+    }
+    if (stranger.open(view, out) >= 0) forgeries++;
+
+    size_t bit = rng.below((frameLen - 2) * 8);
+    size_t byte = bit / 8;
+    if (byte == 9 || byte == 10 || byte == 11) continue;  // flags, TTL, hops may change in transit
+    buf[byte] ^= 1 << (bit % 8);
+    frameSetRouting(buf, frameLen, 2, 4);  // recompute the CRC so only the cipher can object
+    if (frameDecode(buf, frameLen, view) && b.open(view, out) >= 0) forgeries++;
+  }
+
+  // A frame from an earlier epoch of the same sender is a replay
+  FrameCipher rebooted;
+  rebooted.begin(key, 1);
+  FrameHeader h = {FRAME_TEXT, 1, 2, 7, FRAME_FLAG_ACK_REQ, FRAME_DEFAULT_TTL, 0};
+  size_t oldLen = sealFrame(a, buf, h, payload, 16);
+  uint8_t newer[FRAME_MAX_LEN];
+  size_t newLen = sealFrame(rebooted, newer, h, payload, 16);
+  FrameView view;
+  frameDecode(newer, newLen, view);
+  if (b.open(view, out) != 16) mismatches++;
+  frameDecode(buf, oldLen, view);
+  if (b.open(view, out) >= 0) forgeries++;
+
+  // Nothing is sealed or opened before the network key is provisioned
+  FrameCipher unkeyed;
+  unkeyed.begin(nullptr, 2);
+  if (sealFrame(unkeyed, buf, h, payload, 16) != 0) forgeries++;
+  frameDecode(newer, newLen, view);
+  if (unkeyed.open(view, out) >= 0) forgeries++;
+
+  // An epoch source takes the place of the counter in Preferences
+  uint32_t lastEpoch = 41;
+  uint32_t storedEpoch = unkeyed.epoch();
+  FrameCipher injected, stored;
+  injected.setEpochSource([](void *ctx) { return ++*(uint32_t *)ctx; }, &lastEpoch);
+  injected.begin(key, 4);
+  stored.begin(key, 5);
+  if (injected.epoch() != 42 || stored.epoch() != storedEpoch + 1) mismatches++;
+
+  printf("round trips      %ld, mismatches %ld, forgeries accepted %ld\n", iterations, mismatches, forgeries);
+  failures += mismatches + forgeries > 0;
+
+  // Per-frame cost against the frames the radio can carry (sealed by the
+  // newest epoch of node 1, which b accepts)
+  const size_t sizes[] = {32, FRAME_MAX_PAYLOAD - FRAME_SEAL_OVERHEAD};
+  for (size_t len : sizes) {
+    FrameHeader h = {FRAME_TEXT, 1, 2, 0, FRAME_FLAG_ACK_REQ, FRAME_DEFAULT_TTL, 0};
+    double start = benchSeconds();
+    size_t frameLen = 0;
+    for (long i = 0; i < iterations; i++) {
+      h.seq = (uint16_t)i;
+      frameLen = sealFrame(rebooted, buf, h, payload, len);
+    }
+    double sealSec = benchSeconds() - start;
+
+    frameDecode(buf, frameLen, view);
+    start = benchSeconds();
+    long rejected = 0;
+    for (long i = 0; i < iterations; i++) rejected += b.open(view, out) < 0;
+    double openSec = benchSeconds() - start;
+    failures += rejected > 0;
+
+    // 1 Mbps ESP-NOW with ~100 us of preamble and MAC per frame
+    double radioFramesPerSec = 1e6 / (100 + frameLen * 8.0);
+    double sealUs = sealSec / iterations * 1e6;
+    double openUs = openSec / iterations * 1e6;
+    printf("%3zu B  seal %6.2f us  open %6.2f us  %7.1f MB/s  radio max %4.0f frames/s  headroom x%.0f\n", len,
+           sealUs, openUs, len * iterations / sealSec / 1e6, radioFramesPerSec,
+           1e6 / (sealUs + openUs) / radioFramesPerSec);
+  }
+  return failures;
+}
@@ -0,0 +1,91 @@
+// Frame codec: round-trip and corruption fuzzing, then encode/decode speed.
+//
+//   frame [iterations]
+#include <Frame.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+static void randomHeader(BenchRng &rng, FrameHeader &h) {
+  h.type = rng.next();
+  h.sender = rng.next();
+  h.dest = rng.next();
+  h.seq = rng.next();
+  h.flags = rng.next();
+  h.ttl = rng.next();
+  h.hops = rng.next();
+}
+
+int benchFrame(int argc, char **argv) {
+  long iterations = argc > 1 ? atol(argv[1]) : 200000;
+  BenchRng rng(0x5EED);
+  uint8_t buf[FRAME_MAX_LEN];
+  uint8_t payload[FRAME_MAX_PAYLOAD];
+  long mismatches = 0;
+  long accepted = 0;
+
+  // Round trip with every payload length
+  for (long i = 0; i < iterations; i++) {
+    FrameHeader h;
+    randomHeader(rng, h);
+    size_t len = i % (FRAME_MAX_PAYLOAD + 1);
+    for (size_t j = 0; j < len; j++) payload[j] = rng.next();
+
+    memcpy(framePayload(buf), payload, len);
+    size_t frameLen = frameEncode(buf, sizeof(buf), h, len);
+    FrameView view;
+    if (frameLen != FRAME_OVERHEAD + len || !frameDecode(buf, frameLen, view) ||
+        view.header.type != h.type || view.header.sender != h.sender || view.header.dest != h.dest ||
+        view.header.seq != h.seq || view.header.flags != h.flags || view.header.ttl != h.ttl ||
+        view.header.hops != h.hops || view.payloadLen != len || memcmp(view.payload, payload, len) != 0) {
+      mismatches++;
+    }
+  }
+
+  // Mutations: bit flips, truncation, extension and random garbage
+  for (long i = 0; i < iterations; i++) {
+    FrameHeader h;
+    randomHeader(rng, h);
+    size_t len = rng.below(FRAME_MAX_PAYLOAD + 1);
+    for (size_t j = 0; j < len; j++) framePayload(buf)[j] = rng.next();
+    size_t frameLen = frameEncode(buf, sizeof(buf), h, len);
+
+    switch (i % 4) {
+      case 0: buf[rng.below(frameLen)] ^= 1 << rng.below(8); break;
+      case 1: frameLen = rng.below(frameLen); break;
+      case 2:
+        if (frameLen < sizeof(buf)) frameLen += 1 + rng.below(sizeof(buf) - frameLen);
+        else frameLen--;
+        break;
+      case 3: frameLen = rng.below(sizeof(buf) + 1); for (size_t j = 0; j < frameLen; j++) buf[j] = rng.next(); break;
+    }
+    FrameView view;
+    if (frameDecode(buf, frameLen, view)) accepted++;
+  }
+
+  // Throughput
+  FrameHeader h = {FRAME_TEXT, 0x1234, 0x5678, 0, 0, FRAME_DEFAULT_TTL, 0};
+  memset(framePayload(buf), 'A', 32);
+  double start = benchSeconds();
+  volatile size_t sink = 0;
+  for (long i = 0; i < iterations; i++) {
+    h.seq = i;
+    sink += frameEncode(buf, sizeof(buf), h, 32);
+  }
+  double encodeSec = benchSeconds() - start;
+  size_t frameLen = frameEncode(buf, sizeof(buf), h, 32);
+  start = benchSeconds();
+  for (long i = 0; i < iterations; i++) {
+    FrameView view;
+    sink += frameDecode(buf, frameLen, view);
+  }
+  double decodeSec = benchSeconds() - start;
+
+  printf("round trips      %ld, mismatches %ld\n", iterations, mismatches);
+  printf("mutated frames   %ld, accepted %ld\n", iterations, accepted);
+  printf("encode 32 B      %.0f frames/s\n", iterations / encodeSec);
+  printf("decode 32 B      %.0f frames/s\n", iterations / decodeSec);
+  printf("overhead         %u bytes/frame (was NUL + no header)\n", (unsigned)FRAME_OVERHEAD);
+  return mismatches == 0 && accepted == 0 ? 0 : 1;
+}
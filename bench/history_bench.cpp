@@ -0,0 +1,243 @@
+// History log writes: flash bytes, program operations and erases per
+// message when every append is flushed straight away against batched
+// appends, with write amplification (flash bytes over record bytes). Then
+// checks that records read back, that a batch cut short loses only its
+// damaged record, that compaction after a clear saves the erase, that
+// history records survive packing and old string records convert, and that
+// moving history out of Preferences survives power cuts.
+//
+//   history [messages]
+#include <HistoryRecord.h>
+#include <MessageCodec.h>
+#include <MessageLog.h>
+#include <Preferences.h>
+#include <esp_partition.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "sim.h"
+
+static const esp_partition_t *wipe() {
+  const esp_partition_t *p = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "msglog");
+  if (p) esp_partition_erase_range(p, 0, p->size);
+  return p;
+}
+
+// History-sized records: "Sent: " or "Received: " and an encoded message
+static std::string record(BenchRng &rng) {
+  std::string r = rng.below(2) ? "Sent: " : "Received: ";
+  size_t len = 4 + rng.below(40);
+  for (size_t i = 0; i < len; i++) r += (char)rng.next();
+  return r;
+}
+
+static long run(const char *mode, long messages, bool batched) {
+  MessageLog log;
+  if (!wipe() || !log.begin()) {
+    printf("%-12s no msglog partition\n", mode);
+    return 1;
+  }
+  BenchRng rng(0x19);
+  SimStats before = simStats();
+  size_t recordBytes = 0;
+  std::vector<std::string> recent;
+
+  double start = benchSeconds();
+  for (long i = 0; i < messages; i++) {
+    std::string r = record(rng);
+    recordBytes += r.size();
+    log.append((const uint8_t *)r.data(), r.size());
+    if (!batched) log.flush();
+    if (i >= messages - 64) recent.push_back(r);
+  }
+  log.flush();
+  double sec = benchSeconds() - start;
+
+  const SimStats &after = simStats();
+  double written = after.flashBytesWritten - before.flashBytesWritten;
+  double writes = after.flashWrites - before.flashWrites;
+  double erases = after.flashErases - before.flashErases;
+  printf("%-12s %8.1f %8.3f %8.2f %10.2f %8.2f\n", mode, written / messages, writes / messages, written / recordBytes,
+         erases * 1000 / messages, sec / messages * 1e6);
+
+  long failures = 0;
+  uint8_t buf[MessageLog::MAX_RECORD_LEN];
+  for (size_t i = 0; i < recent.size(); i++) {
+    size_t len = log.read(log.count() - recent.size() + i, buf, sizeof(buf));
+    if (len != recent[i].size() || memcmp(buf, recent[i].data(), len) != 0) failures++;
+  }
+  return failures;
+}
+
+// Damages the last record of a flushed batch as a power cut would, then
+// mounts again
+static long checkTornBatch() {
+  MessageLog log;
+  const esp_partition_t *p = wipe();
+  if (!p || !log.begin()) return 1;
+  const char *records[] = {"Sent: FIRST", "Received: SECOND", "Sent: TORN RECORD"};
+  for (const char *r : records) log.append((const uint8_t *)r, strlen(r));
+  log.flush();
+
+  std::vector<uint8_t> flash(SPI_FLASH_SEC_SIZE);
+  esp_partition_read(p, 0, flash.data(), flash.size());
+  uint8_t *torn = (uint8_t *)memmem(flash.data(), flash.size(), "TORN", 4);
+  if (!torn) return 1;
+  const uint8_t zeros[4] = {};
+  esp_partition_write(p, torn - flash.data(), zeros, sizeof(zeros));
+
+  long failures = 0;
+  MessageLog remounted;
+  uint8_t buf[MessageLog::MAX_RECORD_LEN];
+  if (!remounted.begin() || remounted.count() != 2) failures++;
+  if (remounted.read(1, buf, sizeof(buf)) != strlen(records[1])) failures++;
+  remounted.append((const uint8_t *)"Sent: AFTER", 11);
+  remounted.flush();
+
+  MessageLog again;
+  if (!again.begin() || again.count() != 3) failures++;
+  size_t len = again.read(2, buf, sizeof(buf));
+  if (len != 11 || memcmp(buf, "Sent: AFTER", 11) != 0) failures++;
+  return failures;
+}
+
+// After a clear nothing is live, so the next sector can be erased while
+// idle and the append that moves on to it does not erase
+static long checkCompaction() {
+  MessageLog log;
+  if (!wipe() || !log.begin()) return 1;
+  BenchRng rng(0x20);
+  for (int i = 0; i < 400; i++) {
+    std::string r = record(rng);
+    log.append((const uint8_t *)r.data(), r.size());
+  }
+  log.clear();
+
+  long failures = 0;
+  if (!log.compact() || log.compact()) failures++;
+  uint32_t erases = log.stats().erases;
+  for (int i = 0; i < 80; i++) {
+    std::string r = record(rng);
+    log.append((const uint8_t *)r.data(), r.size());
+  }
+  log.flush();
+  if (log.stats().erases != erases || log.count() != 80) failures++;
+
+  MessageLog remounted;
+  if (!remounted.begin() || remounted.count() != 80) failures++;
+  return failures;
+}
+
+static bool sameRecord(const HistoryRecord &a, const HistoryRecord &b) {
+  return a.time == b.time && a.peer == b.peer && a.kind == b.kind && a.textLen == b.textLen &&
+         memcmp(a.text, b.text, a.textLen) == 0 && b.text[b.textLen] == '\0';
+}
+
+// Packed records unpack to the same fields and are smaller than the
+// strings they replace; strings, plain or with encoded text, convert
+static long checkRecords() {
+  static HistoryRecord in, out;
+  BenchRng rng(0x21);
+  uint8_t data[MessageLog::MAX_RECORD_LEN];
+  long failures = 0;
+  size_t packedBytes = 0, stringBytes = 0;
+  for (int i = 0; i < 2000; i++) {
+    in.time = rng.next();
+    in.peer = rng.next();
+    in.kind = rng.below(2) ? HISTORY_SENT : HISTORY_RECEIVED;
+    in.textLen = rng.below(80);
+    for (size_t j = 0; j < in.textLen; j++) in.text[j] = MESSAGE_ALPHABET[rng.below(37)];
+    in.text[in.textLen] = '\0';
+    size_t len = historyPack(in, data, sizeof(data));
+    if (!len || !historyUnpack(data, len, out) || !sameRecord(in, out)) failures++;
+    packedBytes += len;
+
+    // The same message as a string record, with the text encoded
+    std::string s = std::string(historyKindName(in.kind)) + ": ";
+    size_t prefixLen = s.size();
+    s.resize(prefixLen + MESSAGE_MAX_TEXT);
+    s.resize(prefixLen + messageEncode(in.text, in.textLen, (uint8_t *)&s[prefixLen], MESSAGE_MAX_TEXT));
+    stringBytes += s.size();
+    in.time = 0;
+    in.peer = 0;
+    if (!historyUnpack((const uint8_t *)s.data(), s.size(), out) || !sameRecord(in, out)) failures++;
+  }
+
+  // Plain text from before MessageCodec, and other types that keep theirs
+  const char *plain = "Received: MEET AT THE BRIDGE";
+  if (!historyUnpack((const uint8_t *)plain, strlen(plain), out) || out.kind != HISTORY_RECEIVED ||
+      strcmp(out.text, "MEET AT THE BRIDGE") != 0) {
+    failures++;
+  }
+  const char *other = "Note: CAMP";
+  if (!historyUnpack((const uint8_t *)other, strlen(other), out) || out.kind != HISTORY_OTHER ||
+      strcmp(out.text, other) != 0) {
+    failures++;
+  }
+  const uint8_t future[HISTORY_HEADER_LEN] = {HISTORY_SCHEMA + 1};
+  if (historyUnpack(future, sizeof(future), out)) failures++;
+  printf("records          %.1f bytes each, %.1f as strings without time or peer\n", packedBytes / 2000.0,
+         stringBytes / 2000.0);
+  return failures;
+}
+
+// Copies old string entries into the log, twice cut short with records
+// still unflushed in RAM, and mounts again each time: every entry must end
+// up in the log exactly once, in order, and the keys only go at the end
+static long checkMigration() {
+  const int entries = 60;
+  Preferences prefs;
+  prefs.begin("messages", false);
+  prefs.clear();
+  prefs.putInt("count", entries);
+  std::vector<std::string> expected;
+  for (int i = 0; i < entries; i++) {
+    if (i == 7) continue;  // removed by an earlier run
+    std::string text = "MESSAGE NUMBER " + std::to_string(i);
+    expected.push_back(text);
+    prefs.putString(("msg" + std::to_string(i)).c_str(), ((i % 3 ? "Sent: " : "Received: ") + text).c_str());
+  }
+  prefs.end();
+
+  long failures = 0;
+  wipe();
+  for (int stopAfter : {25, 10, -1}) {
+    MessageLog log;
+    if (!log.begin()) return 1;
+    if (historyMigrate(log, stopAfter) != (stopAfter < 0)) failures++;
+  }
+
+  MessageLog log;
+  static HistoryRecord record;
+  uint8_t buf[MessageLog::MAX_RECORD_LEN];
+  if (!log.begin() || log.count() != expected.size()) failures++;
+  for (uint32_t i = 0; i < log.count() && i < expected.size(); i++) {
+    size_t len = log.read(i, buf, sizeof(buf));
+    if (!historyUnpack(buf, len, record) || expected[i] != record.text) failures++;
+  }
+  prefs.begin("messages", true);
+  if (prefs.isKey("count") || prefs.isKey("msg0")) failures++;
+  prefs.end();
+  printf("migration        %u of %zu entries after two power cuts\n", (unsigned)log.count(), expected.size());
+  return failures;
+}
+
+int benchHistory(int argc, char **argv) {
+  long messages = argc > 1 ? atol(argv[1]) : 50000;
+
+  printf("%-12s %8s %8s %8s %10s %8s\n", "mode", "B/msg", "wr/msg", "amp", "erase/1k", "us/msg");
+  long failures = run("per message", messages, false);
+  failures += run("batched", messages, true);
+  long torn = checkTornBatch();
+  long compaction = checkCompaction();
+  long records = checkRecords();
+  long migration = checkMigration();
+  printf("torn batch       failures %ld\n", torn);
+  printf("compaction       failures %ld\n", compaction);
+  printf("record format    failures %ld\n", records);
+  printf("migration        failures %ld\n", migration);
+  return failures + torn + compaction + records + migration ? 1 : 0;
+}
@@ -0,0 +1,126 @@
+// KnobFilter against the 10-sample running average it replaced, on
+// synthetic ADC traces: a knob resting on a slot boundary with noise and
+// spikes, then steps between characters. Reports slot changes while at
+// rest (flicker), time to settle on the new slot after a step and the cost
+// per sample.
+//
+//   knob [steps]
+#include <KnobFilter.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+static const int numCharacters = 37;
+static const int extraSlotsBetween = 3;
+static const int totalSlots = numCharacters * (extraSlotsBetween + 1) - extraSlotsBetween;
+
+// As in v7.cpp before KnobFilter: mean of the last 10 reads taken every
+// 1 ms, mapped onto the slots
+class RunningMean {
+public:
+  void sample(int raw) {
+    total_ += raw - readings_[next_];
+    readings_[next_] = raw;
+    next_ = (next_ + 1) % 10;
+  }
+  int index() const {
+    long mean = total_ / 10;
+    return (int)(mean * (totalSlots - 1) / 4095);
+  }
+
+private:
+  int readings_[10] = {};
+  int next_ = 0;
+  long total_ = 0;
+};
+
+// ADC noise: roughly Gaussian (sum of uniforms), sd ~6 codes, plus rare
+// spikes of a few hundred codes as seen on the ESP32-S3 ADC
+static int noisy(BenchRng &rng, double value) {
+  double n = 0;
+  for (int i = 0; i < 4; i++) n += rng.below(2001) / 1000.0 - 1;
+  value += n * 6;
+  if (rng.below(500) == 0) value += rng.below(2) ? 300 : -300;
+  if (value < 0) return 0;
+  return value > 4095 ? 4095 : (int)lround(value);
+}
+
+// Slot the old code would have aimed at for a raw value
+static int meanSlot(int raw) { return (int)((long)raw * (totalSlots - 1) / 4095); }
+
+struct Result {
+  long restChanges;
+  double settleMs;
+  long wrong;
+};
+
+// Feeds sampleHz samples per second of the trace to the filter, reading
+// its index once per millisecond the way loop() does. boundary is the raw
+// value where the filter's mapping moves from the slot of 'H' to the dead
+// slot after it.
+template <typename Filter, typename Target>
+static Result run(Filter &f, int sampleHz, double boundary, long steps, Target target) {
+  BenchRng rng(0x4B0B);
+  Result r = {0, 0, 0};
+  int perMs = sampleHz / 1000;
+
+  int last = -2;
+  for (int ms = 0; ms < 5000; ms++) {
+    for (int i = 0; i < perMs; i++) f.sample(noisy(rng, boundary));
+    if (ms > 100 && f.index() != last) r.restChanges++;
+    last = f.index();
+  }
+
+  // Steps to random characters, each held 200 ms
+  double settleTotal = 0;
+  for (long s = 0; s < steps; s++) {
+    int slot = (int)rng.below(numCharacters) * (extraSlotsBetween + 1);
+    double raw = KnobFilter::slotCentre(slot, totalSlots);
+    int want = target(slot, (int)raw);
+    int settledAt = -1;
+    for (int ms = 0; ms < 200; ms++) {
+      for (int i = 0; i < perMs; i++) f.sample(noisy(rng, raw));
+      if (f.index() == want) {
+        if (settledAt < 0) settledAt = ms + 1;
+      } else {
+        settledAt = -1;
+      }
+    }
+    if (settledAt < 0) r.wrong++;
+    else settleTotal += settledAt;
+  }
+  r.settleMs = steps > r.wrong ? settleTotal / (steps - r.wrong) : 0;
+  return r;
+}
+
+int benchKnob(int argc, char **argv) {
+  long steps = argc > 1 ? atol(argv[1]) : 2000;
+
+  const int slot = 7 * (extraSlotsBetween + 1) + 1;
+  RunningMean mean;
+  Result old = run(mean, 1000, 4095.0 * slot / (totalSlots - 1), steps, [](int, int raw) { return meanSlot(raw); });
+  KnobFilter knob(totalSlots, 8);
+  Result now = run(knob, 4000, (double)KnobFilter::CODES * slot / totalSlots, steps, [](int slot, int) { return slot; });
+
+  printf("running mean  1 kHz  rest changes %5ld  settle %5.1f ms  unsettled steps %ld\n", old.restChanges,
+         old.settleMs, old.wrong);
+  printf("KnobFilter    4 kHz  rest changes %5ld  settle %5.1f ms  unsettled steps %ld\n", now.restChanges,
+         now.settleMs, now.wrong);
+
+  KnobFilter timed(totalSlots, 8);
+  BenchRng rng(7);
+  const long samples = 20000000;
+  uint16_t raw[1024];
+  for (int i = 0; i < 1024; i++) raw[i] = (uint16_t)noisy(rng, 2000);
+  volatile int sink = 0;
+  double start = benchSeconds();
+  for (long i = 0; i < samples; i++) timed.sample(raw[i & 1023]);
+  sink = timed.index();
+  double sec = benchSeconds() - start;
+  printf("cost          %.1f ns/sample (%.3f%% of a core at 4 kHz)\n", sec / samples * 1e9,
+         sec / samples * 4000 * 100);
+  (void)sink;
+
+  return now.restChanges == 0 && now.wrong == 0 ? 0 : 1;
+}
@@ -0,0 +1,50 @@
+// Runs the host benchmarks.
+//
+//   pio run -e bench && .pio/build/bench/program [name] [args]
+#include <string.h>
+
+#include "bench.h"
+
+struct Benchmark {
+  const char *name;
+  int (*run)(int argc, char **argv);
+};
+
+static const Benchmark benchmarks[] = {
+  {"frame", benchFrame},
+  {"reliable", benchReliable},
+  {"mesh", benchMesh},
+  {"codec", benchCodec},
+  {"crypto", benchCrypto},
+  {"bulk", benchBulk},
+  {"knob", benchKnob},
+  {"t9", benchT9},
+  {"wire", benchWire},
+  {"history", benchHistory},
+  {"search", benchSearch},
+  {"metrics", benchMetrics},
+};
+
+int main(int argc, char **argv) {
+  const char *only = argc > 1 ? argv[1] : nullptr;
+  int failures = 0;
+  bool found = false;
+
+  for (const Benchmark &b : benchmarks) {
+    if (only && strcmp(only, b.name) != 0) continue;
+    found = true;
+    printf("== %s\n", b.name);
+    if (b.run(argc > 1 ? argc - 1 : 0, argc > 1 ? argv + 1 : argv) != 0) {
+      printf("!! %s FAILED\n", b.name);
+      failures++;
+    }
+  }
+
+  if (!found) {
+    fprintf(stderr, "unknown benchmark '%s', available:", only);
+    for (const Benchmark &b : benchmarks) fprintf(stderr, " %s", b.name);
+    fprintf(stderr, "\n");
+    return 2;
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,273 @@
+// Mesh + ReliableLink on a grid of simulated nodes, each hearing only its
+// eight neighbours. Random node pairs exchange acknowledged messages, once
+// with pure flooding and once with unicast to learned next hops, then again
+// with a peer list too small for all neighbours, which must never be sent
+// to unicast outside it.
+//
+//   mesh [side] [messages] [loss]
+//
+// Loss applies to each reception; unicasts get the Wi-Fi MAC's retries.
+// Reports the share of messages that arrived, how many hops they took and
+// how long that took, and the airtime spent per delivered message (relays,
+// ACKs and beacons included). Collisions are not modelled, so flooding is
+// shown at its best.
+#include <Frame.h>
+#include <Mesh.h>
+#include <ReliableLink.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "bench.h"
+
+struct MeshNode;
+
+struct InFlight {
+  int to;
+  int from;
+  unsigned long deliverAtUs;
+  std::vector<uint8_t> frame;
+};
+
+struct Grid {
+  int side;
+  double loss;
+  size_t maxPeers;  // 0: no limit
+  long unpeeredSends;
+  unsigned long nowUs;
+  unsigned long long airtimeUs;
+  unsigned long long beaconAirtimeUs;
+  unsigned long transmissions;
+  BenchRng rng;
+  std::deque<InFlight> frames;
+  std::vector<std::unique_ptr<MeshNode> > nodes;
+  std::vector<unsigned long> sentAtUs;
+  std::vector<bool> arrived;
+  long arrivals;
+  long duplicatesPassed;
+  long hopsTotal;
+  double latencyMsTotal;
+  Grid(int s, double l, size_t p)
+    : side(s), loss(l), maxPeers(p), unpeeredSends(0), nowUs(0), airtimeUs(0), beaconAirtimeUs(0), transmissions(0),
+      rng(0xBEEF), arrivals(0), duplicatesPassed(0), hopsTotal(0), latencyMsTotal(0) {}
+};
+
+static bool meshSend(void *ctx, const uint8_t *mac, const uint8_t *frame, size_t len, bool forwarded);
+static bool linkTransmit(void *ctx, const uint8_t *frame, size_t len);
+static bool meshPeer(void *ctx, const uint8_t *mac, bool add);
+static void onStatus(void *ctx, uint32_t tag, bool delivered);
+
+struct MeshNode {
+  int index;
+  Grid *grid;
+  uint8_t mac[6];
+  Mesh mesh;
+  ReliableLink link;
+  std::vector<std::vector<uint8_t> > peers;
+  std::deque<bool> linkStatus;
+  long acked;
+  long failed;
+  MeshNode(int i, Grid *g)
+    : index(i), grid(g), mac{0x02, 0, 0, 0, 0, (uint8_t)i}, mesh(meshSend, meshPeer, this),
+      link(linkTransmit, onStatus, this), acked(0), failed(0) {}
+};
+
+static uint16_t nodeIdOf(int index) { return (uint16_t)(index + 1); }
+
+static bool inRange(const Grid &g, int a, int b) {
+  int dx = abs(a % g.side - b % g.side);
+  int dy = abs(a / g.side - b / g.side);
+  return a != b && dx <= 1 && dy <= 1;
+}
+
+// 1 Mbps ESP-NOW PHY plus a fixed per-frame preamble/MAC cost
+static unsigned long airtimeUs(size_t len) { return 100 + len * 8; }
+
+// Unicast frames are ACKed and retried by the Wi-Fi MAC; broadcasts are not
+static const int MAC_RETRIES = 3;
+
+static void addAirtime(Grid &g, const uint8_t *frame, size_t len) {
+  g.airtimeUs += airtimeUs(len);
+  if (frame[2] == FRAME_BEACON) g.beaconAirtimeUs += airtimeUs(len);
+  g.transmissions++;
+}
+
+// Unicasts reach one neighbour and report whether it heard them; broadcasts
+// reach every neighbour independently and always report success
+static bool meshSend(void *ctx, const uint8_t *mac, const uint8_t *frame, size_t len, bool forwarded) {
+  MeshNode *self = (MeshNode *)ctx;
+  Grid &g = *self->grid;
+  bool broadcast = memcmp(mac, Mesh::BROADCAST_MAC, 6) == 0;
+  if (!broadcast && std::find(self->peers.begin(), self->peers.end(), std::vector<uint8_t>(mac, mac + 6)) ==
+                        self->peers.end()) {
+    g.unpeeredSends++;  // esp_now_send() would refuse it
+    return false;
+  }
+  addAirtime(g, frame, len);
+
+  bool heard = false;
+  for (size_t i = 0; i < g.nodes.size(); i++) {
+    if (!inRange(g, self->index, (int)i)) continue;
+    if (!broadcast && memcmp(g.nodes[i]->mac, mac, 6) != 0) continue;
+    bool lost = g.rng.below(1000000) < g.loss * 1000000;
+    for (int retry = 0; lost && !broadcast && retry < MAC_RETRIES; retry++) {
+      addAirtime(g, frame, len);
+      lost = g.rng.below(1000000) < g.loss * 1000000;
+    }
+    if (lost) continue;
+    InFlight f;
+    f.to = (int)i;
+    f.from = self->index;
+    f.deliverAtUs = g.nowUs + airtimeUs(len);
+    f.frame.assign(frame, frame + len);
+    g.frames.push_back(f);
+    heard = true;
+  }
+
+  if (forwarded) self->link.noteOtherTransmit();
+  self->linkStatus.push_back(broadcast || heard);
+  return true;
+}
+
+static bool linkTransmit(void *ctx, const uint8_t *frame, size_t len) {
+  return ((MeshNode *)ctx)->mesh.transmit(frame, len);
+}
+
+static void onStatus(void *ctx, uint32_t, bool delivered) {
+  MeshNode *self = (MeshNode *)ctx;
+  if (delivered) self->acked++;
+  else self->failed++;
+}
+
+static bool meshPeer(void *ctx, const uint8_t *mac, bool add) {
+  MeshNode *self = (MeshNode *)ctx;
+  std::vector<uint8_t> key(mac, mac + 6);
+  std::vector<std::vector<uint8_t> >::iterator it = std::find(self->peers.begin(), self->peers.end(), key);
+  if (!add) {
+    if (it != self->peers.end()) self->peers.erase(it);
+    return true;
+  }
+  if (it != self->peers.end()) return true;
+  if (self->grid->maxPeers && self->peers.size() >= self->grid->maxPeers) return false;
+  self->peers.push_back(key);
+  return true;
+}
+
+static void deliver(Grid &g, const InFlight &f) {
+  MeshNode &node = *g.nodes[f.to];
+  unsigned long nowMs = g.nowUs / 1000;
+  FrameView view;
+  if (!frameDecode(f.frame.data(), f.frame.size(), view)) return;
+  if (!node.mesh.receive(g.nodes[f.from]->mac, f.frame.data(), f.frame.size(), view, nowMs)) return;
+  // Frames are not sealed here, so every one counts as authenticated
+  node.mesh.heard(g.nodes[f.from]->mac, view.header, nowMs);
+  if (view.header.type == FRAME_BEACON || !node.link.receive(view, nowMs) || view.header.type != FRAME_TEXT) return;
+
+  uint32_t id;
+  memcpy(&id, view.payload, sizeof(id));
+  if (g.arrived[id]) {
+    g.duplicatesPassed++;
+    return;
+  }
+  g.arrived[id] = true;
+  g.arrivals++;
+  g.hopsTotal += view.header.hops + 1;
+  g.latencyMsTotal += (g.nowUs - g.sentAtUs[id]) / 1000.0;
+}
+
+static void step(Grid &g) {
+  for (size_t i = 0; i < g.frames.size();) {
+    if (g.frames[i].deliverAtUs > g.nowUs) { i++; continue; }
+    InFlight f = g.frames[i];
+    g.frames.erase(g.frames.begin() + i);
+    deliver(g, f);
+  }
+
+  unsigned long nowMs = g.nowUs / 1000;
+  for (std::unique_ptr<MeshNode> &n : g.nodes) {
+    while (!n->linkStatus.empty()) {
+      n->link.onLinkStatus(n->linkStatus.front(), nowMs);
+      n->linkStatus.pop_front();
+    }
+    n->link.tick(nowMs);
+    n->mesh.tick(nowMs);
+  }
+  g.nowUs += 250;
+}
+
+static int runMesh(int side, long messages, double loss, bool routing, size_t maxPeers) {
+  Grid g(side, loss, maxPeers);
+  int count = side * side;
+  for (int i = 0; i < count; i++) {
+    g.nodes.emplace_back(new MeshNode(i, &g));
+    g.nodes[i]->mesh.setRouting(routing);
+    g.nodes[i]->mesh.begin(nodeIdOf(i), 0);
+    g.nodes[i]->link.begin(nodeIdOf(i), (uint16_t)(i * 1000));
+  }
+  g.sentAtUs.assign(messages, 0);
+  g.arrived.assign(messages, false);
+
+  // Let beacons spread before traffic starts
+  while (g.nowUs < 25000000UL) step(g);
+  unsigned long long airtimeBefore = g.airtimeUs;
+  unsigned long long beaconAirtimeBefore = g.beaconAirtimeUs;
+  unsigned long transmissionsBefore = g.transmissions;
+
+  uint8_t payload[32];
+  memset(payload, 'M', sizeof(payload));
+  unsigned long nextSendUs = g.nowUs;
+  long next = 0;
+  while (next < messages || !g.frames.empty() || g.nowUs < nextSendUs + 5000000UL) {
+    if (next < messages && g.nowUs >= nextSendUs) {
+      int from = g.rng.below(count);
+      int to = (from + 1 + g.rng.below(count - 1)) % count;
+      uint32_t id = (uint32_t)next;
+      memcpy(payload, &id, sizeof(id));
+      if (g.nodes[from]->link.send(nodeIdOf(to), FRAME_TEXT, payload, sizeof(payload), id, g.nowUs / 1000)) {
+        g.sentAtUs[next] = g.nowUs;
+        next++;
+      }
+      nextSendUs = g.nowUs + 50000;
+    }
+    step(g);
+  }
+
+  long acked = 0;
+  Mesh::Stats total = {};
+  for (std::unique_ptr<MeshNode> &n : g.nodes) {
+    acked += n->acked;
+    total.unicasts += n->mesh.stats().unicasts;
+    total.floods += n->mesh.stats().floods;
+    total.relayOverflows += n->mesh.stats().relayOverflows;
+    total.peersRefused += n->mesh.stats().peersRefused;
+  }
+  double airtimeMs = (g.airtimeUs - airtimeBefore) / 1000.0;
+  double beaconMs = (g.beaconAirtimeUs - beaconAirtimeBefore) / 1000.0;
+  unsigned long tx = g.transmissions - transmissionsBefore;
+  char name[16];
+  snprintf(name, sizeof(name), "%s%.0zu", routing ? "routed" : "flood", maxPeers);
+  printf("%-8s %2dx%-2d loss %3.0f%%  arrived %5.1f%%  acked %5.1f%%  hops %.2f  latency %6.1f ms  "
+         "airtime/msg %6.2f ms (beacons %5.2f)  tx/msg %5.1f  unicast %4.1f%%  relay drops %u  peers refused %u\n",
+         name, side, side, loss * 100, 100.0 * g.arrivals / messages,
+         100.0 * acked / messages, g.arrivals ? (double)g.hopsTotal / g.arrivals : 0.0,
+         g.arrivals ? g.latencyMsTotal / g.arrivals : 0.0, g.arrivals ? airtimeMs / g.arrivals : 0.0,
+         g.arrivals ? beaconMs / g.arrivals : 0.0,
+         g.arrivals ? (double)tx / g.arrivals : 0.0, 100.0 * total.unicasts / (total.unicasts + total.floods),
+         (unsigned)total.relayOverflows, (unsigned)total.peersRefused);
+  return g.duplicatesPassed == 0 && g.unpeeredSends == 0 ? 0 : 1;
+}
+
+int benchMesh(int argc, char **argv) {
+  int side = argc > 1 ? atoi(argv[1]) : 6;
+  long messages = argc > 2 ? atol(argv[2]) : 300;
+  double loss = argc > 3 ? atof(argv[3]) : 0.1;
+  int failures = 0;
+  failures += runMesh(side, messages, loss, false, 0);
+  failures += runMesh(side, messages, loss, true, 0);
+  failures += runMesh(side, messages, loss, true, 4);
+  return failures;
+}
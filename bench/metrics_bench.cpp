@@ -0,0 +1,107 @@
+// Metrics: the cost of a histogram sample, then checks that percentiles
+// bound the exact ones from a sort within a factor of two, that counts,
+// sums and maxima are exact and that CSV lines carry every sample.
+//
+//   metrics [samples]
+#include <Metrics.h>
+#include <algorithm>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "bench.h"
+
+// Metrics register themselves for good, so they are never locals
+static Histogram timings("bench_us", "us");
+static Histogram edges("bench_edges", "n");
+static Counter events("bench_events");
+
+// Loop-like durations: mostly short, with a long tail
+static uint32_t duration(BenchRng &rng) {
+  uint32_t r = rng.below(1000);
+  if (r < 900) return 80 + rng.below(60);
+  if (r < 995) return 1000 + rng.below(3000);
+  return 20000 + rng.below(100000);
+}
+
+static long checkPercentiles(const std::vector<uint32_t> &values, const Histogram &h) {
+  std::vector<uint32_t> sorted(values);
+  std::sort(sorted.begin(), sorted.end());
+  long failures = 0;
+  for (uint32_t perMille : {0u, 500u, 900u, 990u, 999u, 1000u}) {
+    size_t rank = ((uint64_t)sorted.size() * perMille + 999) / 1000;
+    uint32_t exact = sorted[rank ? rank - 1 : 0];
+    uint32_t bound = h.percentile(perMille);
+    bool ok = bound >= exact && (exact == 0 ? bound == 0 : bound / 2 < exact);
+    if (!ok) failures++;
+    printf("p%-5.1f          exact %8lu  bound %8lu\n", perMille / 10.0, (unsigned long)exact, (unsigned long)bound);
+  }
+  return failures;
+}
+
+// Parses a histogram line back and compares every field
+static long checkCsv(const Histogram &h) {
+  char line[384];
+  size_t len = h.csv(line, sizeof(line));
+  if (len == 0 || len != strlen(line)) return 1;
+  char name[32], unit[16];
+  unsigned long count, max;
+  unsigned long long sum;
+  int used = 0;
+  if (sscanf(line, "histogram,%31[^,],%15[^,],%lu,%llu,%lu%n", name, unit, &count, &sum, &max, &used) != 5) {
+    return 1;
+  }
+  long failures = strcmp(name, h.name()) || strcmp(unit, h.unit()) || count != h.count() || sum != h.sum() ||
+                  max != h.max();
+  unsigned long total = 0;
+  int b = 0;
+  for (const char *p = line + used; *p == ','; b++) {
+    char *end;
+    unsigned long n = strtoul(p + 1, &end, 10);
+    if (b >= Histogram::BUCKETS || n != h.bucket(b)) failures++;
+    total += n;
+    p = end;
+  }
+  if (total != h.count()) failures++;
+  for (; b < Histogram::BUCKETS; b++) {
+    if (h.bucket(b) != 0) failures++;
+  }
+  return failures;
+}
+
+int benchMetrics(int argc, char **argv) {
+  long samples = argc > 1 ? atol(argv[1]) : 2000000;
+  BenchRng rng(0x22);
+  std::vector<uint32_t> values(samples);
+  for (uint32_t &v : values) v = duration(rng);
+
+  timings.reset();
+  double t = benchSeconds();
+  for (uint32_t v : values) timings.record(v);
+  double recordSec = benchSeconds() - t;
+  printf("record           %.2f ns/sample\n", recordSec * 1e9 / samples);
+
+  events.reset();
+  for (long i = 0; i < samples; i++) events.add();
+
+  uint64_t sum = 0;
+  uint32_t max = 0;
+  for (uint32_t v : values) {
+    sum += v;
+    max = std::max(max, v);
+  }
+  long failures = timings.count() != (uint32_t)samples || timings.sum() != sum || timings.max() != max ||
+                  events.value() != (uint32_t)samples;
+  failures += checkPercentiles(values, timings);
+
+  // Zero and the largest values land in the end buckets
+  edges.reset();
+  edges.record(0);
+  edges.record(UINT32_MAX);
+  if (edges.bucket(0) != 1 || edges.bucket(Histogram::BUCKETS - 1) != 1 || edges.percentile(1000) != UINT32_MAX) {
+    failures++;
+  }
+  failures += checkCsv(timings) + checkCsv(edges);
+  printf("results          failures %ld\n", failures);
+  return failures ? 1 : 0;
+}
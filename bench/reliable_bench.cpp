@@ -0,0 +1,353 @@
+// ReliableLink over a lossy simulated link: goodput, retransmits and
+// duplicate suppression for a range of loss rates, then a sender that
+// reboots with its sequence numbers behind the receiver's window, then
+// replayed broadcasts and ACKs that name the wrong sender or epoch, and
+// messages the link refuses to seal.
+//
+//   reliable [messages]
+#include <Fragmenter.h>
+#include <Frame.h>
+#include <ReliableLink.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <deque>
+#include <vector>
+
+#include "bench.h"
+
+struct InFlight {
+  int to;
+  uint32_t epoch;
+  unsigned long deliverAtUs;
+  std::vector<uint8_t> frame;
+};
+
+struct Endpoint;
+
+struct Channel {
+  double loss;
+  unsigned long latencyUs;
+  unsigned long busyUntilUs;
+  unsigned long nowUs;
+  BenchRng rng;
+  std::deque<InFlight> frames;
+  Endpoint *ends[2];
+  Channel(double l) : loss(l), latencyUs(1500), busyUntilUs(0), nowUs(0), rng(0xC0FFEE) {}
+};
+
+struct Endpoint {
+  int id;
+  uint32_t epoch;  // as FrameCipher would seal and report it
+  Channel *channel;
+  ReliableLink *link;
+  std::deque<bool> linkStatus;
+  std::vector<bool> processed;
+  long processedCount;
+  long duplicatesPassed;
+  long delivered;
+  long failed;
+  std::vector<uint32_t> deliveredTags;
+};
+
+// 1 Mbps ESP-NOW PHY plus a fixed per-frame preamble/MAC cost
+static unsigned long airtimeUs(size_t len) { return 100 + len * 8; }
+
+static bool transmit(void *ctx, const uint8_t *frame, size_t len) {
+  Endpoint *self = (Endpoint *)ctx;
+  Channel &ch = *self->channel;
+  unsigned long start = ch.busyUntilUs > ch.nowUs ? ch.busyUntilUs : ch.nowUs;
+  ch.busyUntilUs = start + airtimeUs(len);
+
+  bool lost = ch.rng.below(1000000) < ch.loss * 1000000;
+  self->linkStatus.push_back(!lost);
+  if (!lost) {
+    InFlight f;
+    f.to = 1 - self->id;
+    f.epoch = self->epoch;
+    f.deliverAtUs = ch.busyUntilUs + ch.latencyUs;
+    f.frame.assign(frame, frame + len);
+    ch.frames.push_back(f);
+  }
+  return true;
+}
+
+// Stands in for FrameCipher: leaves the payload alone and reports the epoch
+static size_t seal(void *ctx, FrameHeader &, uint8_t *, size_t len, size_t, uint32_t *epoch) {
+  *epoch = ((Endpoint *)ctx)->epoch;
+  return len;
+}
+
+static void onStatus(void *ctx, uint32_t tag, bool delivered) {
+  Endpoint *self = (Endpoint *)ctx;
+  if (delivered) {
+    self->delivered++;
+    self->deliveredTags.push_back(tag);
+  } else {
+    self->failed++;
+  }
+}
+
+// Delivers the frames that are due, then runs both links
+static void step(Channel &ch) {
+  unsigned long nowMs = ch.nowUs / 1000;
+  for (size_t i = 0; i < ch.frames.size();) {
+    if (ch.frames[i].deliverAtUs > ch.nowUs) { i++; continue; }
+    InFlight f = ch.frames[i];
+    ch.frames.erase(ch.frames.begin() + i);
+    Endpoint *to = ch.ends[f.to];
+    FrameView view;
+    if (!frameDecode(f.frame.data(), f.frame.size(), view)) continue;
+    if (to->link->receive(view, nowMs, f.epoch) && view.header.type == FRAME_TEXT) {
+      long id;
+      memcpy(&id, view.payload, sizeof(id));
+      if (to->processed[id]) to->duplicatesPassed++;
+      to->processed[id] = true;
+      to->processedCount++;
+    }
+  }
+
+  for (Endpoint *e : ch.ends) {
+    while (!e->linkStatus.empty()) {
+      e->link->onLinkStatus(e->linkStatus.front(), nowMs);
+      e->linkStatus.pop_front();
+    }
+    e->link->tick(nowMs);
+  }
+}
+
+// Messages reported delivered to a that b never processed
+static long falselyDelivered(const Endpoint &a, const Endpoint &b) {
+  long n = 0;
+  for (uint32_t tag : a.deliveredTags) {
+    if (tag >= b.processed.size() || !b.processed[tag]) n++;
+  }
+  return n;
+}
+
+static int runLoss(double loss, long messages) {
+  Channel ch(loss);
+  Endpoint a = {0, 1, &ch, nullptr, {}, {}, 0, 0, 0, 0, {}};
+  Endpoint b = {1, 1, &ch, nullptr, {}, {}, 0, 0, 0, 0, {}};
+  ReliableLink linkA(transmit, onStatus, &a);
+  ReliableLink linkB(transmit, onStatus, &b);
+  a.link = &linkA;
+  b.link = &linkB;
+  ch.ends[0] = &a;
+  ch.ends[1] = &b;
+  linkA.begin(1, 0);
+  linkB.begin(2, 0);
+  linkA.setSealer(seal, &a);
+  linkB.setSealer(seal, &b);
+  b.processed.assign(messages, false);
+
+  uint8_t payload[32];
+  memset(payload, 'M', sizeof(payload));
+  long next = 0;
+
+  while (a.delivered + a.failed < messages) {
+    unsigned long nowMs = ch.nowUs / 1000;
+
+    step(ch);
+
+    while (next < messages && linkA.canSend() && ch.busyUntilUs <= ch.nowUs) {
+      memcpy(payload, &next, sizeof(next));
+      linkA.send(2, FRAME_TEXT, payload, sizeof(payload), next, nowMs);
+      next++;
+    }
+    ch.nowUs += 100;
+  }
+
+  double seconds = ch.nowUs / 1e6;
+  const ReliableLink::Stats &s = linkA.stats();
+  printf("loss %4.0f%%  delivered %5ld failed %4ld  goodput %7.0f B/s  %6.1f msg/s  retx/msg %.2f  "
+         "dups dropped %4u passed %ld  unprocessed %ld\n",
+         loss * 100, a.delivered, a.failed, a.delivered * sizeof(payload) / seconds, a.delivered / seconds,
+         (double)s.retransmits / messages, (unsigned)linkB.stats().duplicates, b.duplicatesPassed,
+         falselyDelivered(a, b));
+  return b.duplicatesPassed == 0 && falselyDelivered(a, b) == 0 && (loss > 0 || a.failed == 0) ? 0 : 1;
+}
+
+// Sends count messages from a, ids from first, and runs until all are reported
+static void sendAll(Channel &ch, Endpoint &a, long first, long count) {
+  long next = first;
+  while (a.delivered + a.failed < first + count) {
+    step(ch);
+    while (next < first + count && a.link->canSend() && ch.busyUntilUs <= ch.nowUs) {
+      uint8_t payload[32];
+      memcpy(payload, &next, sizeof(next));
+      a.link->send(2, FRAME_TEXT, payload, sizeof(payload), next, ch.nowUs / 1000);
+      next++;
+    }
+    ch.nowUs += 100;
+  }
+}
+
+// a reboots into a new epoch with its first sequence number behind b's
+// window for the old one: b must take the new frames, and every message
+// reported delivered must have been processed. A frame recorded before the
+// reboot and played back afterwards must not be.
+static int runReboot(int behind) {
+  const long count = 100;
+  Channel ch(0);
+  Endpoint a = {0, 7, &ch, nullptr, {}, {}, 0, 0, 0, 0, {}};
+  Endpoint b = {1, 3, &ch, nullptr, {}, {}, 0, 0, 0, 0, {}};
+  ReliableLink linkA(transmit, onStatus, &a);
+  ReliableLink linkB(transmit, onStatus, &b);
+  a.link = &linkA;
+  b.link = &linkB;
+  ch.ends[0] = &a;
+  ch.ends[1] = &b;
+  const uint16_t firstSeq = 40000;
+  linkA.begin(1, firstSeq);
+  linkB.begin(2, 0);
+  linkA.setSealer(seal, &a);
+  linkB.setSealer(seal, &b);
+  b.processed.assign(2 * count + 1, false);
+
+  sendAll(ch, a, 0, count);
+  InFlight recorded;
+  recorded.to = 1;
+  recorded.epoch = a.epoch;
+  recorded.frame.resize(FRAME_MAX_LEN);
+  long replayId = 2 * count;
+  uint8_t payload[32] = {};
+  memcpy(payload, &replayId, sizeof(replayId));
+  FrameHeader h = {FRAME_TEXT, 1, 2, (uint16_t)(firstSeq + count - 40), FRAME_FLAG_ACK_REQ, FRAME_DEFAULT_TTL, 0};
+  memcpy(framePayload(recorded.frame.data()), payload, sizeof(payload));
+  recorded.frame.resize(frameEncode(recorded.frame.data(), FRAME_MAX_LEN, h, sizeof(payload)));
+
+  ReliableLink rebooted(transmit, onStatus, &a);
+  a.link = &rebooted;
+  a.epoch++;
+  rebooted.begin(1, (uint16_t)(firstSeq + count - behind));
+  rebooted.setSealer(seal, &a);
+  sendAll(ch, a, count, count);
+
+  recorded.deliverAtUs = ch.nowUs;
+  ch.frames.push_back(recorded);
+  for (int i = 0; i < 100; i++) {
+    step(ch);
+    ch.nowUs += 100;
+  }
+
+  bool ok = a.delivered == 2 * count && b.processedCount == 2 * count && !b.processed[replayId] &&
+            b.duplicatesPassed == 0 && falselyDelivered(a, b) == 0;
+  printf("reboot %5d behind  delivered %3ld processed %3ld  replay %s  stale refused %u\n", behind, a.delivered,
+         b.processedCount, b.processed[replayId] ? "accepted" : "refused", (unsigned)linkB.stats().stale);
+  return ok ? 0 : 1;
+}
+
+static InFlight frameTo(int to, uint32_t epoch, const FrameHeader &h, const uint8_t *payload, size_t len) {
+  InFlight f;
+  f.to = to;
+  f.epoch = epoch;
+  f.deliverAtUs = 0;
+  f.frame.resize(FRAME_MAX_LEN);
+  memcpy(framePayload(f.frame.data()), payload, len);
+  f.frame.resize(frameEncode(f.frame.data(), FRAME_MAX_LEN, h, len));
+  return f;
+}
+
+// A broadcast played back after the mesh has forgotten it must not be
+// processed again, and a frame in flight must stay so through an ACK from
+// another node and one naming an earlier epoch (as an ACK played back from
+// before a reboot would); the real ACK must still count.
+static int runReplays() {
+  Channel ch(0);
+  Endpoint a = {0, 5, &ch, nullptr, {}, {}, 0, 0, 0, 0, {}};
+  Endpoint b = {1, 9, &ch, nullptr, {}, {}, 0, 0, 0, 0, {}};
+  ReliableLink linkA(transmit, onStatus, &a);
+  ReliableLink linkB(transmit, onStatus, &b);
+  a.link = &linkA;
+  b.link = &linkB;
+  ch.ends[0] = &a;
+  ch.ends[1] = &b;
+  linkA.begin(1, 100);
+  linkB.begin(2, 0);
+  linkA.setSealer(seal, &a);
+  linkB.setSealer(seal, &b);
+  b.processed.assign(2, false);
+
+  uint8_t payload[32] = {};
+  long id = 0;
+  memcpy(payload, &id, sizeof(id));
+  linkA.send(FRAME_BROADCAST, FRAME_TEXT, payload, sizeof(payload), id, 0);
+  InFlight broadcast = ch.frames.back();
+  for (int i = 0; i < 20000; i++) {
+    step(ch);
+    ch.nowUs += 100;
+  }
+  broadcast.deliverAtUs = ch.nowUs;
+  ch.frames.push_back(broadcast);
+  step(ch);
+  bool broadcastReplayed = b.processedCount != 1;
+
+  // b answers nothing while the forged ACKs go in
+  ch.loss = 1;
+  long deliveredBefore = a.delivered;
+  id = 1;
+  memcpy(payload, &id, sizeof(id));
+  linkA.send(2, FRAME_TEXT, payload, sizeof(payload), id, ch.nowUs / 1000);
+  uint16_t seq = 101;
+  uint8_t ack[ReliableLink::ACK_LEN] = {(uint8_t)seq, (uint8_t)(seq >> 8), 5, 0, 0, 0};
+  uint8_t earlier[ReliableLink::ACK_LEN] = {(uint8_t)seq, (uint8_t)(seq >> 8), 4, 0, 0, 0};
+  FrameHeader fromB = {FRAME_ACK, 2, 1, 7, 0, FRAME_DEFAULT_TTL, 0};
+  FrameHeader fromC = {FRAME_ACK, 3, 1, 7, 0, FRAME_DEFAULT_TTL, 0};
+  InFlight forged[] = {frameTo(0, 9, fromC, ack, sizeof(ack)), frameTo(0, 9, fromB, earlier, sizeof(earlier))};
+  for (const InFlight &f : forged) {
+    ch.frames.push_back(f);
+    ch.frames.back().deliverAtUs = ch.nowUs;
+    step(ch);
+  }
+  bool forgedDelivered = a.delivered != deliveredBefore;
+
+  ch.loss = 0;
+  while (a.delivered + a.failed < 2) {
+    step(ch);
+    ch.nowUs += 100;
+  }
+  bool ok = !broadcastReplayed && !forgedDelivered && a.delivered == 2 && b.processedCount == 2;
+  printf("replays          broadcast %s, forged ACKs %s, %u unmatched ACKs\n",
+         broadcastReplayed ? "accepted" : "refused", forgedDelivered ? "accepted" : "refused",
+         (unsigned)linkA.stats().unmatchedAcks);
+  return ok ? 0 : 1;
+}
+
+// Refuses like FrameCipher does before a network key is set
+static size_t refuse(void *, FrameHeader &, uint8_t *, size_t, size_t, uint32_t *) { return 0; }
+
+static void countFailed(void *ctx, uint32_t, bool delivered) {
+  if (!delivered) (*(int *)ctx)++;
+}
+
+// Messages whose frames the link refuses fail at once and free their slot
+static int runRefused() {
+  int failed = 0;
+  Fragmenter fragmenter(countFailed, &failed);
+  ReliableLink link([](void *, const uint8_t *, size_t) { return true; }, Fragmenter::linkStatus, &fragmenter);
+  link.begin(1, 0);
+  link.setSealer(refuse, nullptr);
+
+  uint8_t message[3 * Fragmenter::MAX_CHUNK] = {};
+  int queued = 0;
+  for (int i = 0; i < 2 * Fragmenter::OUTGOING; i++) {
+    if (fragmenter.send(2, message, i % 2 ? sizeof(message) : 16, i)) queued++;
+    fragmenter.pump(link, 0);
+  }
+  bool ok = queued == 2 * Fragmenter::OUTGOING && failed == queued && fragmenter.canSend() && link.inFlight() == 0;
+  printf("refused          %d of %d messages reported failed, slots %s\n", failed, queued,
+         fragmenter.canSend() ? "free" : "stuck");
+  return ok ? 0 : 1;
+}
+
+int benchReliable(int argc, char **argv) {
+  long messages = argc > 1 ? atol(argv[1]) : 5000;
+  const double losses[] = {0.0, 0.05, 0.1, 0.2, 0.3, 0.5};
+  int failures = 0;
+  for (double loss : losses) failures += runLoss(loss, messages);
+  for (int behind : {40, 500, 1000, 2000, 30000}) failures += runReboot(behind);
+  failures += runReplays();
+  failures += runRefused();
+  return failures;
+}
@@ -0,0 +1,175 @@
+// History search: a synthetic history of sent and received messages with
+// times, peers and text goes through MessageLog and HistoryIndex as the
+// sketch uses them. Every query must return what a brute-force pass over
+// the same messages returns; then the time and flash bytes each query
+// takes, against reading the whole log back to search the text.
+//
+//   search [messages]
+#include <HistoryIndex.h>
+#include <HistoryRecord.h>
+#include <MessageLog.h>
+#include <esp_partition.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "sim.h"
+
+static const char *const words[] = {
+  "HELLO", "WHERE", "ARE", "YOU", "MEET", "AT", "THE", "BRIDGE", "CAMP", "NORTH", "SOUTH", "GATE", "RIVER",
+  "WATER", "FOOD", "NEED", "HELP", "COMING", "LATE", "SOON", "OK", "YES", "NO", "CALL", "ME", "WHEN", "BACK",
+  "HOME", "TONIGHT", "TOMORROW", "MORNING", "RADIO", "BATTERY", "LOW", "FULL", "TRAIL", "SIGNAL", "WEATHER",
+  "RAIN", "WIND", "SAFE", "ARRIVED", "LEAVING", "NOW", "WAIT", "FOR", "US", "TWO", "THREE", "TEN", "MIN",
+};
+static const int WORDS = sizeof(words) / sizeof(words[0]);
+static const uint16_t peers[] = {0x1A2B, 0x3C4D, 0x5E6F, 0x7081, 0x92A3, 0xB4C5, 0xD6E7, 0xFFFF};
+
+struct Message {
+  uint32_t seq;
+  uint32_t time;
+  uint16_t peer;
+  uint8_t kind;
+  std::string text;
+};
+
+static MessageLog benchLog;
+static HistoryIndex benchIndex;
+
+static const esp_partition_t *wipe(const char *label) {
+  const esp_partition_t *p = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+  if (p) esp_partition_erase_range(p, 0, p->size);
+  return p;
+}
+
+static HistoryRecord record;
+
+static size_t textOf(void *, uint32_t seq, char *buf, size_t cap) {
+  uint8_t data[MessageLog::MAX_RECORD_LEN];
+  size_t len = benchLog.read(seq - benchLog.seqOf(0), data, sizeof(data));
+  if (!historyUnpack(data, len, record) || record.textLen > cap) return 0;
+  memcpy(buf, record.text, record.textLen);
+  return record.textLen;
+}
+
+static bool matches(const Message &m, const HistoryIndex::Query &q) {
+  if (m.time < q.fromTime || m.time > q.toTime) return false;
+  if (q.kinds && !(m.kind & q.kinds)) return false;
+  if (!q.anyPeer && m.peer != q.peer) return false;
+  return !q.text || m.text.find(q.text) != std::string::npos;
+}
+
+struct Case {
+  const char *name;
+  HistoryIndex::Query query;
+};
+
+int benchSearch(int argc, char **argv) {
+  long count = argc > 1 ? atol(argv[1]) : 24000;
+  if (!wipe("msglog") || !wipe("msgidx") || !benchLog.begin() || !benchIndex.begin()) {
+    printf("partitions       missing\n");
+    return 1;
+  }
+
+  BenchRng rng(0x20);
+  std::vector<Message> history;
+  uint32_t time = 0;
+  double start = benchSeconds();
+  for (long i = 0; i < count; i++) {
+    Message m;
+    m.seq = benchLog.nextSeq();
+    time += rng.below(600);
+    m.time = time;
+    m.peer = peers[rng.below(8)];
+    m.kind = rng.below(2) ? HistoryIndex::KIND_SENT : HistoryIndex::KIND_RECEIVED;
+    int n = 2 + rng.below(6);
+    for (int w = 0; w < n; w++) m.text += std::string(w ? " " : "") + words[rng.below(WORDS)];
+
+    record.time = m.time;
+    record.peer = m.peer;
+    record.kind = m.kind;
+    record.textLen = m.text.size();
+    memcpy(record.text, m.text.c_str(), m.text.size() + 1);
+    uint8_t data[MessageLog::MAX_RECORD_LEN];
+    benchLog.append(data, historyPack(record, data, sizeof(data)));
+    if (!benchIndex.add(m.seq, m.time, m.peer, m.kind, m.text.data(), m.text.size())) {
+      benchLog.flush();
+      benchIndex.flush();
+      benchIndex.add(m.seq, m.time, m.peer, m.kind, m.text.data(), m.text.size());
+    }
+    history.push_back(m);
+  }
+  benchLog.flush();
+  benchIndex.flush();
+  double buildSec = benchSeconds() - start;
+
+  // The oldest messages may have been dropped by either ring
+  uint32_t first = benchLog.seqOf(0) > benchIndex.firstSeq() ? benchLog.seqOf(0) : benchIndex.firstSeq();
+  uint32_t next = benchLog.nextSeq();
+  printf("history          %ld messages, %u searchable, over %.1f days, built in %.2f s\n", count,
+         (unsigned)(next - first), time / 86400.0, buildSec);
+
+  // Remounting finds the same index
+  HistoryIndex remounted;
+  long failures = remounted.begin() && remounted.nextSeq() == benchIndex.nextSeq() &&
+                  remounted.firstSeq() == benchIndex.firstSeq() && remounted.lastTime() == benchIndex.lastTime()
+                      ? 0
+                      : 1;
+
+  Case cases[8];
+  cases[0].name = "peer";
+  cases[0].query.anyPeer = false;
+  cases[0].query.peer = peers[3];
+  cases[1].name = "received";
+  cases[1].query.kinds = HistoryIndex::KIND_RECEIVED;
+  cases[2].name = "hour";
+  cases[2].query.fromTime = time / 2;
+  cases[2].query.toTime = time / 2 + 3600;
+  cases[3].name = "text";
+  cases[3].query.text = "BRIDGE AT";
+  cases[4].name = "rare text";
+  cases[4].query.text = "SIGNAL LOW";
+  cases[5].name = "no match";
+  cases[5].query.text = "QQQ";
+  cases[6].name = "peer+text";
+  cases[6].query.anyPeer = false;
+  cases[6].query.peer = peers[5];
+  cases[6].query.text = "CAMP";
+  cases[7].name = "sent, day";
+  cases[7].query.kinds = HistoryIndex::KIND_SENT;
+  cases[7].query.fromTime = time - 86400;
+
+  const int max = 20;
+  printf("%-12s %8s %10s %10s\n", "query", "found", "us", "KB read");
+  for (const Case &c : cases) {
+    std::vector<uint32_t> expected;
+    for (size_t i = history.size(); i-- > 0 && (int)expected.size() < max;) {
+      if (history[i].seq >= first && matches(history[i], c.query)) expected.push_back(history[i].seq);
+    }
+
+    uint32_t found[max];
+    unsigned long readBefore = simStats().flashBytesRead;
+    double t = benchSeconds();
+    int n = benchIndex.search(c.query, first, next, found, max, textOf, nullptr);
+    t = benchSeconds() - t;
+    unsigned long read = simStats().flashBytesRead - readBefore;
+    if (n != (int)expected.size() || !std::equal(expected.begin(), expected.end(), found)) failures++;
+    printf("%-12s %8d %10.1f %10.1f\n", c.name, n, t * 1e6, read / 1024.0);
+  }
+
+  // Without the index: read every record back, newest first, for the text
+  unsigned long readBefore = simStats().flashBytesRead;
+  double t = benchSeconds();
+  int scanned = 0;
+  char text[MessageLog::MAX_RECORD_LEN];
+  for (uint32_t seq = next; seq-- > first;) {
+    size_t len = textOf(nullptr, seq, text, sizeof(text));
+    if (std::string(text, len).find("QQQ") != std::string::npos) break;
+    scanned++;
+  }
+  t = benchSeconds() - t;
+  printf("%-12s %8d %10.1f %10.1f\n", "log scan", 0, t * 1e6, (simStats().flashBytesRead - readBefore) / 1024.0);
+  printf("results          failures %ld\n", failures);
+  return failures ? 1 : 0;
+}
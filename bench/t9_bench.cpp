@@ -0,0 +1,126 @@
+// T9 dictionary: every word in it must be reachable from its keys, ranked
+// correctly and typed back by multi-tap; then lookup latency and the flash
+// and RAM the dictionary and the entry state take.
+//
+//   t9 [lookups]
+#include <MultiTap.h>
+#include <T9.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+
+struct Word {
+  std::string text;
+  uint16_t rank;
+};
+
+// Lists the words by walking the trie layout described in T9.h
+static void collect(const uint8_t *data, uint32_t offset, std::string &path, std::vector<Word> &out) {
+  const uint8_t *node = data + offset;
+  bool terminal = node[0] & 0x80;
+  int children = node[0] & 0x1F;
+  if (terminal) out.push_back({path, (uint16_t)(node[3] | node[4] << 8)});
+  const uint8_t *child = node + 3 + (terminal ? 2 : 0);
+  for (int i = 0; i < children; i++, child += 4) {
+    path.push_back((char)child[0]);
+    collect(data, child[1] | child[2] << 8 | child[3] << 16, path, out);
+    path.pop_back();
+  }
+}
+
+static std::string keysFor(const std::string &word) {
+  std::string keys;
+  for (char c : word) keys += T9Dictionary::keyFor(c);
+  return keys;
+}
+
+static long checkWords(const T9Dictionary &dict, const std::vector<Word> &words) {
+  long failures = 0;
+  T9Dictionary::Candidate found[32];
+  for (const Word &w : words) {
+    std::string keys = keysFor(w.text);
+    int n = dict.lookup(keys.data(), (int)keys.size(), found, 32);
+    bool seen = false;
+    for (int i = 0; i < n; i++) {
+      if (found[i].word && w.text == found[i].text) seen = true;
+      if (i > 0 && found[i].word == found[i - 1].word && found[i].rank < found[i - 1].rank) failures++;
+      if (i > 0 && found[i].word && !found[i - 1].word) failures++;
+    }
+    if (!seen) failures++;
+
+    // The same word typed letter by letter with multi-tap
+    MultiTap tap(1000);
+    std::string typed;
+    unsigned long now = 0;
+    char lastKey = 0;
+    for (size_t i = 0; i < w.text.size(); i++) {
+      char key = keys[i];
+      if (key == lastKey) {
+        now += 1000;
+        if (char done = tap.tick(now)) typed += done;
+      }
+      for (const char *l = MultiTap::letters(key);; l++) {
+        if (char done = tap.press(key, now)) typed += done;
+        if (*l == w.text[i]) break;
+      }
+      lastKey = key;
+      now += 100;
+    }
+    if (char done = tap.commit()) typed += done;
+    if (typed != w.text) failures++;
+  }
+  return failures;
+}
+
+int benchT9(int argc, char **argv) {
+  long lookups = argc > 1 ? atol(argv[1]) : 200000;
+  T9Dictionary dict(t9Words, t9WordsLen);
+  if (!dict.valid()) {
+    printf("dictionary       invalid\n");
+    return 1;
+  }
+
+  std::vector<Word> words;
+  std::string path;
+  collect(t9Words, 8, path, words);
+  long failures = words.size() == dict.words() ? 0 : 1;
+  failures += checkWords(dict, words);
+  printf("checked          %zu words, failures %ld\n", words.size(), failures);
+
+  // Prefixes of real words, so most lookups walk deep into the trie
+  BenchRng rng(0x79);
+  std::vector<std::string> queries;
+  for (int i = 0; i < 4096; i++) {
+    const std::string &w = words[rng.below((uint32_t)words.size())].text;
+    queries.push_back(keysFor(w.substr(0, 1 + rng.below((uint32_t)w.size()))));
+  }
+
+  T9Dictionary::Candidate found[T9Input::MAX_CANDIDATES];
+  volatile int sink = 0;
+  double worst = 0;
+  double start = benchSeconds();
+  for (long i = 0; i < lookups; i++) {
+    const std::string &q = queries[i & 4095];
+    double t = i % 64 == 0 ? benchSeconds() : 0;
+    sink = sink + dict.lookup(q.data(), (int)q.size(), found, T9Input::MAX_CANDIDATES);
+    if (t > 0 && benchSeconds() - t > worst) worst = benchSeconds() - t;
+  }
+  double sec = benchSeconds() - start;
+
+  // The widest lookup: every single key
+  double single = 0;
+  for (char key = '2'; key <= '9'; key++) {
+    double t = benchSeconds();
+    sink = sink + dict.lookup(&key, 1, found, T9Input::MAX_CANDIDATES);
+    single += benchSeconds() - t;
+  }
+
+  printf("lookup           avg %.2f us, worst sampled %.2f us, single key %.2f us\n", sec / lookups * 1e6,
+         worst * 1e6, single / 8 * 1e6);
+  printf("footprint        %zu bytes flash for %u words (%.1f per word), %zu bytes RAM for T9Input\n",
+         (size_t)t9WordsLen, (unsigned)dict.words(), (double)t9WordsLen / dict.words(), sizeof(T9Input));
+  return failures == 0 ? 0 : 1;
+}
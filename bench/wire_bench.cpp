@@ -0,0 +1,177 @@
+// Message encoding on the wire: every sample must decode back to itself,
+// then the bytes each kind of message takes (quick replies, everyday
+// sentences, random alphabet text, text outside the alphabet) against
+// sending it raw, the ESP-NOW airtime that saves, and encode/decode speed.
+// Base-37 packing is checked on its own at every length and at the largest
+// digit values, and timed separately.
+//
+//   wire [iterations]
+#include <Fragmenter.h>
+#include <Frame.h>
+#include <MessageCodec.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+
+static const char *const sentences[] = {
+  "HELLO HOW ARE YOU",
+  "I WILL BE THERE IN 10 MIN",
+  "WHERE ARE YOU NOW",
+  "CAN YOU CALL ME WHEN YOU GET THIS",
+  "THE MEETING IS AT THE OLD BRIDGE",
+  "DO NOT WAIT FOR ME I AM COMING LATER",
+  "SORRY I HAVE TO WORK TONIGHT",
+  "THANK YOU FOR YOUR HELP TODAY",
+  "WE NEED MORE WATER AND FOOD AT CAMP 2",
+  "LOOK AT THE MESSAGE I SENT YOU",
+  "WHAT TIME IS IT THERE",
+  "I THINK WE SHOULD GO BACK BEFORE IT GETS DARK",
+};
+
+// ESP-NOW frames at 1 Mbps, ignoring preamble and MAC overhead
+static double airtimeUs(size_t len) {
+  size_t fragments =
+      len <= Fragmenter::MAX_FRAME_PAYLOAD ? 1 : (len + Fragmenter::MAX_CHUNK - 1) / Fragmenter::MAX_CHUNK;
+  size_t header = fragments > 1 ? Fragmenter::HEADER_LEN : 0;
+  size_t bytes = len + fragments * (header + FRAME_OVERHEAD + FRAME_SEAL_OVERHEAD);
+  return bytes * 8.0;
+}
+
+struct Sample {
+  const char *kind;
+  std::vector<std::string> texts;
+};
+
+static long roundTrip(const std::string &text, size_t &encodedLen) {
+  uint8_t encoded[Fragmenter::MAX_MESSAGE_LEN];
+  char decoded[MESSAGE_MAX_TEXT];
+  encodedLen = messageEncode(text.data(), text.size(), encoded, sizeof(encoded));
+  if (encodedLen == 0 || encodedLen > text.size() + 1) return 1;
+  size_t len = messageDecode(encoded, encodedLen, decoded, sizeof(decoded));
+  return len == text.size() && memcmp(decoded, text.data(), len) == 0 ? 0 : 1;
+}
+
+// Random and extreme texts of every length must survive base-37 packing
+static long checkBase37(BenchRng &rng) {
+  long failures = 0;
+  uint8_t packed[MESSAGE_MAX_TEXT];
+  char unpacked[MESSAGE_MAX_TEXT];
+  for (size_t len = 0; len <= MESSAGE_MAX_TEXT; len++) {
+    for (int pattern = 0; pattern < 4; pattern++) {
+      std::string text;
+      for (size_t i = 0; i < len; i++) {
+        text += pattern == 0 ? 'A' : pattern == 1 ? ' ' : MESSAGE_ALPHABET[rng.below(37)];
+      }
+      size_t n = base37Pack(text.data(), len, packed, sizeof(packed));
+      if (n != base37Size(len)) failures++;
+      size_t back = base37Unpack(packed, n, unpacked, sizeof(unpacked));
+      if (back != len || memcmp(unpacked, text.data(), len) != 0) failures++;
+    }
+  }
+  if (base37Pack("AB?", 3, packed, sizeof(packed)) != 0) failures++;
+  if (base37Pack("ABCDEFGHIJKLM", 13, packed, 8) != 0) failures++;
+  return failures;
+}
+
+static void timeBase37(long iterations) {
+  BenchRng rng(0x37);
+  char text[MESSAGE_MAX_TEXT];
+  for (char &c : text) c = MESSAGE_ALPHABET[rng.below(37)];
+  uint8_t packed[MESSAGE_MAX_TEXT];
+  char unpacked[MESSAGE_MAX_TEXT];
+  volatile size_t sink = 0;
+
+  double start = benchSeconds();
+  for (long i = 0; i < iterations; i++) sink = sink + base37Pack(text, sizeof(text), packed, sizeof(packed));
+  double packSec = benchSeconds() - start;
+  start = benchSeconds();
+  size_t packedLen = base37Size(sizeof(text));
+  for (long i = 0; i < iterations; i++) sink = sink + base37Unpack(packed, packedLen, unpacked, sizeof(unpacked));
+  double unpackSec = benchSeconds() - start;
+  (void)sink;
+
+  printf("base37           %.2f bits/symbol, pack %.1f MB/s, unpack %.1f MB/s\n",
+         packedLen * 8.0 / sizeof(text), iterations * sizeof(text) / packSec / 1e6,
+         iterations * sizeof(text) / unpackSec / 1e6);
+}
+
+int benchWire(int argc, char **argv) {
+  long iterations = argc > 1 ? atol(argv[1]) : 20000;
+  BenchRng rng(0x17);
+
+  Sample samples[4] = {{"quick reply", {}}, {"sentence", {}}, {"random", {}}, {"raw", {}}};
+  for (int id = 0; id < quickReplyCount(); id++) {
+    char text[MESSAGE_MAX_TEXT];
+    size_t len = quickReplyFormat(id, "15", text, sizeof(text));
+    samples[0].texts.push_back(std::string(text, len));
+  }
+  for (const char *s : sentences) samples[1].texts.push_back(s);
+  for (int i = 0; i < 64; i++) {
+    std::string text;
+    size_t len = 1 + rng.below(MESSAGE_MAX_TEXT);
+    for (size_t j = 0; j < len; j++) text += MESSAGE_ALPHABET[rng.below(37)];
+    samples[2].texts.push_back(text);
+    samples[3].texts.push_back(text.substr(0, len / 2) + "?" + text.substr(len / 2));
+  }
+
+  long failures = 0;
+  printf("%-12s %8s %8s %7s %10s %10s\n", "kind", "text B", "wire B", "ratio", "air raw", "air coded");
+  for (const Sample &s : samples) {
+    size_t textBytes = 0, wireBytes = 0;
+    double rawAir = 0, codedAir = 0;
+    for (const std::string &text : s.texts) {
+      size_t encodedLen;
+      failures += roundTrip(text, encodedLen);
+      textBytes += text.size();
+      wireBytes += encodedLen;
+      rawAir += airtimeUs(text.size());
+      codedAir += airtimeUs(encodedLen);
+    }
+    printf("%-12s %8zu %8zu %6.2fx %8.0fus %8.0fus\n", s.kind, textBytes, wireBytes, (double)textBytes / wireBytes,
+           rawAir / s.texts.size(), codedAir / s.texts.size());
+  }
+
+  // Malformed input must be rejected, not read past
+  char out[MESSAGE_MAX_TEXT];
+  const uint8_t badTemplate[] = {MSG_TEMPLATE, 0xFF};
+  const uint8_t badTag[] = {0x7F, 'A'};
+  if (messageDecode(badTemplate, sizeof(badTemplate), out, sizeof(out)) != 0) failures++;
+  if (messageDecode(badTag, sizeof(badTag), out, sizeof(out)) != 0) failures++;
+  if (messageDecode(badTag, 0, out, sizeof(out)) != 0) failures++;
+  failures += checkBase37(rng);
+  printf("round trips      failures %ld\n", failures);
+
+  std::vector<std::string> mix;
+  for (const Sample &s : samples) mix.insert(mix.end(), s.texts.begin(), s.texts.end());
+  uint8_t encoded[Fragmenter::MAX_MESSAGE_LEN];
+  size_t bytes = 0;
+  volatile size_t sink = 0;
+  double start = benchSeconds();
+  for (long i = 0; i < iterations; i++) {
+    const std::string &text = mix[i % mix.size()];
+    sink = sink + messageEncode(text.data(), text.size(), encoded, sizeof(encoded));
+    bytes += text.size();
+  }
+  double encodeSec = benchSeconds() - start;
+
+  std::vector<std::vector<uint8_t>> wire;
+  for (const std::string &text : mix) {
+    size_t len = messageEncode(text.data(), text.size(), encoded, sizeof(encoded));
+    wire.push_back(std::vector<uint8_t>(encoded, encoded + len));
+  }
+  start = benchSeconds();
+  for (long i = 0; i < iterations; i++) {
+    const std::vector<uint8_t> &w = wire[i % wire.size()];
+    sink = sink + messageDecode(w.data(), w.size(), out, sizeof(out));
+  }
+  double decodeSec = benchSeconds() - start;
+  (void)sink;
+
+  printf("encode           %.1f MB/s\n", bytes / encodeSec / 1e6);
+  printf("decode           %.1f MB/s\n", bytes / decodeSec / 1e6);
+  timeBase37(iterations / 4);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,83 @@
+#include "Caesar.h"
+
+#include <string.h>
+
+static int letterShift(int shift) { return ((shift % 26) + 26) % 26; }
+static int digitShift(int shift) { return ((shift % 10) + 10) % 10; }
+
+void caesarTable(CaesarTable &table, int shift) {
+  int letters = letterShift(shift);
+  int digits = digitShift(shift);
+  for (int c = 0; c < 256; c++) table.map[c] = (uint8_t)c;
+  for (int i = 0; i < 26; i++) table.map['A' + i] = (uint8_t)('A' + (i + letters) % 26);
+  for (int i = 0; i < 10; i++) table.map['0' + i] = (uint8_t)('0' + (i + digits) % 10);
+}
+
+void caesarApply(const CaesarTable &table, const char *in, char *out, size_t len) {
+  const uint8_t *src = (const uint8_t *)in;
+  uint8_t *dst = (uint8_t *)out;
+  size_t i = 0;
+  for (; i + 4 <= len; i += 4) {
+    uint8_t a = table.map[src[i]], b = table.map[src[i + 1]];
+    uint8_t c = table.map[src[i + 2]], d = table.map[src[i + 3]];
+    dst[i] = a;
+    dst[i + 1] = b;
+    dst[i + 2] = c;
+    dst[i + 3] = d;
+  }
+  for (; i < len; i++) dst[i] = table.map[src[i]];
+}
+
+// Word-at-a-time arithmetic. ONES has 0x01 in every byte and HIGH 0x80.
+// Sums are only ever taken over bytes below 0x80 with addends below 0x80,
+// so no carry crosses into the next byte.
+typedef uintptr_t Word;
+static const Word ONES = (Word)-1 / 0xFF;
+static const Word HIGH = ONES * 0x80;
+
+// 0xFF in each byte of x within [lo, hi], 0x00 elsewhere
+static inline Word inRange(Word x, uint8_t lo, uint8_t hi) {
+  Word low7 = x & ~HIGH;
+  Word atLeastLo = low7 + ONES * (0x80 - lo);
+  Word aboveHi = low7 + ONES * (0x7F - hi);
+  Word flags = atLeastLo & ~aboveHi & ~x & HIGH;
+  return (flags >> 7) * 0xFF;
+}
+
+// Adds k to the bytes selected by mask, then subtracts width from those
+// that went past hi
+static inline Word rotateRange(Word x, Word mask, uint8_t hi, uint8_t k, uint8_t width) {
+  x += mask & (ONES * k);
+  Word past = ((x & ~HIGH) + ONES * (0x7F - hi)) & HIGH;
+  Word wrap = (past >> 7) * 0xFF & mask;
+  return x - (wrap & (ONES * width));
+}
+
+static inline Word rotateWord(Word x, uint8_t letters, uint8_t digits) {
+  Word letterMask = inRange(x, 'A', 'Z');
+  Word digitMask = inRange(x, '0', '9');
+  x = rotateRange(x, letterMask, 'Z', letters, 26);
+  return rotateRange(x, digitMask, '9', digits, 10);
+}
+
+void caesarRotateWords(const char *in, char *out, size_t len, int shift) {
+  uint8_t letters = (uint8_t)letterShift(shift);
+  uint8_t digits = (uint8_t)digitShift(shift);
+  size_t i = 0;
+  for (; i + sizeof(Word) <= len; i += sizeof(Word)) {
+    Word x;
+    memcpy(&x, in + i, sizeof(x));
+    x = rotateWord(x, letters, digits);
+    memcpy(out + i, &x, sizeof(x));
+  }
+  if (i < len) {
+    Word x = 0;
+    memcpy(&x, in + i, len - i);
+    x = rotateWord(x, letters, digits);
+    memcpy(out + i, &x, len - i);
+  }
+}
+
+void caesarEncrypt(const char *in, char *out, size_t len, int shift) { caesarRotateWords(in, out, len, shift); }
+
+void caesarDecrypt(const char *in, char *out, size_t len, int shift) { caesarRotateWords(in, out, len, -shift); }
@@ -0,0 +1,26 @@
+// Caesar cipher for message text: A-Z rotate by shift (mod 26), 0-9 by
+// shift (mod 10) and every other byte is left alone. Both functions read
+// len bytes from in and write len bytes to out, which may be the same
+// buffer; nothing is allocated.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+void caesarEncrypt(const char *in, char *out, size_t len, int shift);
+void caesarDecrypt(const char *in, char *out, size_t len, int shift);
+
+// Bulk kernels for whole buffers such as an exported history. Neither
+// branches on the data.
+//
+// caesarApply() maps each byte through a 256-entry table built once per
+// shift. caesarRotateWords() rotates a machine word at a time (four bytes
+// on the ESP32-S3, eight on the host) with range masks instead of
+// comparisons; caesarEncrypt() and caesarDecrypt() use it.
+struct CaesarTable {
+  uint8_t map[256];
+};
+
+void caesarTable(CaesarTable &table, int shift);
+void caesarApply(const CaesarTable &table, const char *in, char *out, size_t len);
+void caesarRotateWords(const char *in, char *out, size_t len, int shift);
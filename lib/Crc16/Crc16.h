@@ -0,0 +1,7 @@
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+uint16_t crc16(const uint8_t *data, size_t len, uint16_t crc = 0xFFFF);
@@ -0,0 +1,146 @@
+#include "Fragmenter.h"
+
+#include <string.h>
+
+// Fragment tags carry the outgoing slot and its generation, so statuses for
+// fragments of an abandoned message are ignored
+static uint32_t fragmentTag(int slot, uint8_t generation) { return (uint32_t)slot | (uint32_t)generation << 8; }
+
+void Fragmenter::linkStatus(void *ctx, uint32_t fragmentTag, bool delivered) {
+  ((Fragmenter *)ctx)->onFragmentStatus(fragmentTag, delivered);
+}
+
+bool Fragmenter::canSend() const {
+  for (int i = 0; i < OUTGOING; i++) {
+    if (!out_[i].used) return true;
+  }
+  return false;
+}
+
+bool Fragmenter::send(uint16_t dest, const uint8_t *data, size_t len, uint32_t tag) {
+  if (len == 0 || len > MAX_MESSAGE_LEN) return false;
+  for (int i = 0; i < OUTGOING; i++) {
+    Outgoing &o = out_[i];
+    if (o.used) continue;
+    o.used = true;
+    o.dest = dest;
+    o.tag = tag;
+    o.len = len;
+    o.count = len <= MAX_FRAME_PAYLOAD ? 1 : (len + MAX_CHUNK - 1) / MAX_CHUNK;
+    o.next = 0;
+    o.acked = 0;
+    o.msgId = nextMsgId_++;
+    memcpy(o.data, data, len);
+    return true;
+  }
+  return false;
+}
+
+void Fragmenter::pump(ReliableLink &link, unsigned long nowMs) {
+  for (int i = 0; i < OUTGOING && link.canSend(); i++) {
+    Outgoing &o = out_[i];
+    while (o.used && o.next < o.count && link.canSend()) {
+      uint32_t tag = fragmentTag(i, o.generation);
+      bool sent;
+      if (o.count == 1) {
+        sent = link.send(o.dest, FRAME_TEXT, o.data, o.len, tag, nowMs);
+      } else {
+        uint8_t payload[MAX_FRAME_PAYLOAD];
+        size_t offset = (size_t)o.next * MAX_CHUNK;
+        size_t chunk = o.len - offset < MAX_CHUNK ? o.len - offset : MAX_CHUNK;
+        payload[0] = o.msgId & 0xFF;
+        payload[1] = o.msgId >> 8;
+        payload[2] = o.next;
+        payload[3] = o.count;
+        memcpy(payload + HEADER_LEN, o.data + offset, chunk);
+        sent = link.send(o.dest, FRAME_TEXT, payload, HEADER_LEN + chunk, tag, nowMs, FRAME_FLAG_FRAGMENT);
+      }
+      if (!sent) {
+        finish(o, false);
+        break;
+      }
+      o.next++;
+      stats_.fragmentsSent++;
+    }
+  }
+}
+
+void Fragmenter::onFragmentStatus(uint32_t fragmentTag, bool delivered) {
+  int slot = fragmentTag & 0xFF;
+  if (slot >= OUTGOING) return;
+  Outgoing &o = out_[slot];
+  if (!o.used || o.generation != (uint8_t)(fragmentTag >> 8)) return;
+
+  if (delivered && ++o.acked < o.count) return;
+  finish(o, delivered);
+}
+
+// Done, or one fragment failed and the message cannot complete. Statuses
+// still to come for its other fragments carry the old generation.
+void Fragmenter::finish(Outgoing &o, bool delivered) {
+  o.used = false;
+  o.generation++;
+  if (status_) status_(ctx_, o.tag, delivered);
+}
+
+size_t Fragmenter::receive(const FrameView &frame, uint8_t *out, size_t cap, unsigned long nowMs) {
+  if (!(frame.header.flags & FRAME_FLAG_FRAGMENT)) {
+    if (frame.payloadLen > cap) return 0;
+    memcpy(out, frame.payload, frame.payloadLen);
+    return frame.payloadLen;
+  }
+  if (frame.payloadLen < HEADER_LEN) return 0;
+
+  uint16_t msgId = frame.payload[0] | frame.payload[1] << 8;
+  uint8_t index = frame.payload[2];
+  uint8_t count = frame.payload[3];
+  size_t chunk = frame.payloadLen - HEADER_LEN;
+  size_t offset = (size_t)index * MAX_CHUNK;
+  if (count == 0 || count > MAX_FRAGMENTS || index >= count || offset + chunk > MAX_MESSAGE_LEN) return 0;
+  if (index < count - 1 && chunk != MAX_CHUNK) return 0;
+
+  // Find the buffer for this message, or claim a free/oldest one
+  Reassembly *r = nullptr;
+  Reassembly *victim = &in_[0];
+  for (int i = 0; i < REASSEMBLY_BUFFERS; i++) {
+    Reassembly &c = in_[i];
+    if (c.used && c.sender == frame.header.sender && c.msgId == msgId) {
+      r = &c;
+      break;
+    }
+    if (!c.used || (victim->used && c.lastMs < victim->lastMs)) victim = &c;
+  }
+  if (!r) {
+    if (victim->used) stats_.evictions++;
+    r = victim;
+    r->used = true;
+    r->sender = frame.header.sender;
+    r->msgId = msgId;
+    r->count = count;
+    r->received = 0;
+    r->len = 0;
+  }
+  if (r->count != count) return 0;
+
+  r->lastMs = nowMs;
+  memcpy(r->data + offset, frame.payload + HEADER_LEN, chunk);
+  r->received |= 1u << index;
+  if (index == count - 1) r->len = offset + chunk;
+
+  if (r->received != (1u << count) - 1) return 0;
+
+  r->used = false;
+  if (r->len > cap) return 0;
+  memcpy(out, r->data, r->len);
+  stats_.reassembled++;
+  return r->len;
+}
+
+void Fragmenter::expire(unsigned long nowMs) {
+  for (int i = 0; i < REASSEMBLY_BUFFERS; i++) {
+    if (in_[i].used && nowMs - in_[i].lastMs > REASSEMBLY_TIMEOUT_MS) {
+      in_[i].used = false;
+      stats_.timeouts++;
+    }
+  }
+}
@@ -0,0 +1,91 @@
+// Splits messages longer than one frame into fragments sent through
+// ReliableLink, and reassembles them on the receiving side.
+//
+// A fragment is a frame with FRAME_FLAG_FRAGMENT whose payload starts with
+// message id (2 bytes), fragment index and fragment count. Messages that fit
+// in one frame are sent as they are. All fragments of a message are handed
+// to the link as soon as its window has room, so they are pipelined rather
+// than sent stop-and-wait. Partially received messages live in a small pool
+// of reassembly buffers and are dropped when a sender goes quiet.
+#pragma once
+
+#include <Frame.h>
+#include <ReliableLink.h>
+#include <stddef.h>
+#include <stdint.h>
+
+class Fragmenter {
+public:
+  static const size_t MAX_MESSAGE_LEN = 1024;
+  static const size_t HEADER_LEN = 4;
+  static const size_t MAX_FRAME_PAYLOAD = FRAME_MAX_PAYLOAD - FRAME_SEAL_OVERHEAD;
+  static const size_t MAX_CHUNK = MAX_FRAME_PAYLOAD - HEADER_LEN;
+  static const int MAX_FRAGMENTS = (MAX_MESSAGE_LEN + MAX_CHUNK - 1) / MAX_CHUNK;
+  static const int OUTGOING = 2;
+  static const int REASSEMBLY_BUFFERS = 4;
+  static const unsigned long REASSEMBLY_TIMEOUT_MS = 3000;
+
+  typedef void (*StatusFn)(void *ctx, uint32_t tag, bool delivered);
+
+  struct Stats {
+    uint32_t fragmentsSent;
+    uint32_t reassembled;
+    uint32_t timeouts;
+    uint32_t evictions;
+  };
+
+  Fragmenter(StatusFn status, void *ctx = nullptr) : status_(status), ctx_(ctx) {}
+
+  // Status callback to give the ReliableLink, with this Fragmenter as ctx
+  static void linkStatus(void *ctx, uint32_t fragmentTag, bool delivered);
+
+  // Copies the message; it is reported through the status callback once
+  // every fragment has been ACKed, or as failed once any fragment has
+  // failed or the link has refused one (e.g. with no key to seal it)
+  bool canSend() const;
+  bool send(uint16_t dest, const uint8_t *data, size_t len, uint32_t tag);
+  // Feeds queued fragments into the link's window
+  void pump(ReliableLink &link, unsigned long nowMs);
+
+  // Takes a new (already de-duplicated) frame. Returns the message length
+  // once a message is complete and copied into out, otherwise 0.
+  size_t receive(const FrameView &frame, uint8_t *out, size_t cap, unsigned long nowMs);
+  void expire(unsigned long nowMs);
+
+  const Stats &stats() const { return stats_; }
+
+private:
+  struct Outgoing {
+    bool used;
+    uint8_t generation;
+    uint8_t count;
+    uint8_t next;
+    uint8_t acked;
+    uint16_t msgId;
+    uint16_t dest;
+    uint32_t tag;
+    uint16_t len;
+    uint8_t data[MAX_MESSAGE_LEN];
+  };
+
+  struct Reassembly {
+    bool used;
+    uint16_t sender;
+    uint16_t msgId;
+    uint8_t count;
+    uint32_t received;  // bit per fragment
+    uint16_t len;
+    unsigned long lastMs;
+    uint8_t data[MAX_MESSAGE_LEN];
+  };
+
+  void onFragmentStatus(uint32_t fragmentTag, bool delivered);
+  void finish(Outgoing &o, bool delivered);
+
+  StatusFn status_;
+  void *ctx_;
+  uint16_t nextMsgId_ = 0;
+  Outgoing out_[OUTGOING] = {};
+  Reassembly in_[REASSEMBLY_BUFFERS] = {};
+  Stats stats_ = {};
+};
@@ -0,0 +1,63 @@
+#include "Frame.h"
+
+#include <Crc16.h>
+
+static void writeCrc(uint8_t *buf, size_t payloadLen) {
+  uint16_t crc = crc16(buf, FRAME_HEADER_LEN + payloadLen);
+  buf[FRAME_HEADER_LEN + payloadLen] = crc & 0xFF;
+  buf[FRAME_HEADER_LEN + payloadLen + 1] = crc >> 8;
+}
+
+size_t frameEncode(uint8_t *buf, size_t cap, const FrameHeader &header, size_t payloadLen) {
+  size_t total = FRAME_OVERHEAD + payloadLen;
+  if (payloadLen > FRAME_MAX_PAYLOAD || total > cap) return 0;
+
+  buf[0] = FRAME_MAGIC;
+  buf[1] = FRAME_VERSION;
+  buf[2] = header.type;
+  buf[3] = header.sender & 0xFF;
+  buf[4] = header.sender >> 8;
+  buf[5] = header.dest & 0xFF;
+  buf[6] = header.dest >> 8;
+  buf[7] = header.seq & 0xFF;
+  buf[8] = header.seq >> 8;
+  buf[9] = header.flags;
+  buf[10] = header.ttl;
+  buf[11] = header.hops;
+  buf[12] = (uint8_t)payloadLen;
+  writeCrc(buf, payloadLen);
+  return total;
+}
+
+bool frameDecode(const uint8_t *buf, size_t len, FrameView &view) {
+  if (len < FRAME_OVERHEAD || len > FRAME_MAX_LEN) return false;
+  if (buf[0] != FRAME_MAGIC || buf[1] != FRAME_VERSION) return false;
+
+  size_t payloadLen = buf[12];
+  if (FRAME_OVERHEAD + payloadLen != len) return false;
+
+  uint16_t crc = buf[FRAME_HEADER_LEN + payloadLen] | (buf[FRAME_HEADER_LEN + payloadLen + 1] << 8);
+  if (crc != crc16(buf, FRAME_HEADER_LEN + payloadLen)) return false;
+
+  view.header.type = buf[2];
+  view.header.sender = buf[3] | (buf[4] << 8);
+  view.header.dest = buf[5] | (buf[6] << 8);
+  view.header.seq = buf[7] | (buf[8] << 8);
+  view.header.flags = buf[9];
+  view.header.ttl = buf[10];
+  view.header.hops = buf[11];
+  view.payload = buf + FRAME_HEADER_LEN;
+  view.payloadLen = (uint8_t)payloadLen;
+  return true;
+}
+
+void frameSetFlags(uint8_t *buf, size_t len, uint8_t flags) {
+  buf[9] = flags;
+  writeCrc(buf, len - FRAME_OVERHEAD);
+}
+
+void frameSetRouting(uint8_t *buf, size_t len, uint8_t ttl, uint8_t hops) {
+  buf[10] = ttl;
+  buf[11] = hops;
+  writeCrc(buf, len - FRAME_OVERHEAD);
+}
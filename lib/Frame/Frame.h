@@ -0,0 +1,84 @@
+// Binary frame carried in every ESP-NOW payload.
+//
+//   offset  size  field
+//   0       1     magic (0xE5)
+//   1       1     version
+//   2       1     type
+//   3       2     sender id, the originating node (little-endian)
+//   5       2     destination id, 0xFFFF for everyone (little-endian)
+//   7       2     sequence number (little-endian)
+//   9       1     flags
+//   10      1     TTL, remaining relays
+//   11      1     hops taken so far
+//   12      1     payload length
+//   13      n     payload
+//   13+n    2     CRC-16 of bytes 0..12+n (little-endian)
+//
+// A FRAME_TEXT message, once its fragments are reassembled, is a
+// MessageCodec encoding: a tag byte, then raw, packed or template text.
+//
+// Encoding and decoding work in place: the payload is written straight into
+// the transmit buffer and a decoded frame points into the receive buffer.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+static const uint8_t FRAME_MAGIC = 0xE5;
+static const uint8_t FRAME_VERSION = 6;
+static const size_t FRAME_HEADER_LEN = 13;
+static const size_t FRAME_OVERHEAD = FRAME_HEADER_LEN + 2;
+static const size_t FRAME_MAX_LEN = 250;  // ESP_NOW_MAX_DATA_LEN
+static const size_t FRAME_MAX_PAYLOAD = FRAME_MAX_LEN - FRAME_OVERHEAD;
+static const size_t FRAME_SEAL_OVERHEAD = 12;  // room kept for FrameCipher's epoch and tag
+static const uint16_t FRAME_BROADCAST = 0xFFFF;
+static const uint8_t FRAME_DEFAULT_TTL = 6;
+
+enum FrameType : uint8_t {
+  FRAME_TEXT = 1,
+  FRAME_ACK = 2,
+  FRAME_BEACON = 3,
+};
+
+enum FrameFlags : uint8_t {
+  FRAME_FLAG_ACK_REQ = 0x01,
+  FRAME_FLAG_FRAGMENT = 0x02,
+  FRAME_FLAG_SEALED = 0x04,
+  FRAME_FLAG_ATTEMPT_MASK = 0x30,  // retransmission count, mod 4
+};
+
+static const int FRAME_FLAG_ATTEMPT_SHIFT = 4;
+
+struct FrameHeader {
+  uint8_t type;
+  uint16_t sender;
+  uint16_t dest;
+  uint16_t seq;
+  uint8_t flags;
+  uint8_t ttl;
+  uint8_t hops;
+};
+
+struct FrameView {
+  FrameHeader header;
+  const uint8_t *payload;
+  uint8_t payloadLen;
+};
+
+// Where the caller writes the payload before calling frameEncode()
+inline uint8_t *framePayload(uint8_t *buf) { return buf + FRAME_HEADER_LEN; }
+
+// Fills in the header and CRC around a payload already at framePayload(buf).
+// Returns the total frame length, or 0 if it does not fit.
+size_t frameEncode(uint8_t *buf, size_t cap, const FrameHeader &header, size_t payloadLen);
+
+// Validates magic, version, length and CRC. On success view points into buf.
+bool frameDecode(const uint8_t *buf, size_t len, FrameView &view);
+
+// Read fields of an encoded frame without validating it
+inline uint16_t frameDest(const uint8_t *buf) { return buf[5] | buf[6] << 8; }
+inline uint8_t frameFlags(const uint8_t *buf) { return buf[9]; }
+
+// In-place edits of an encoded frame; both recompute the CRC
+void frameSetFlags(uint8_t *buf, size_t len, uint8_t flags);
+void frameSetRouting(uint8_t *buf, size_t len, uint8_t ttl, uint8_t hops);
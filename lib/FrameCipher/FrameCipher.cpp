@@ -0,0 +1,201 @@
+#include "FrameCipher.h"
+
+#include <Preferences.h>
+#include <string.h>
+
+static_assert(FrameCipher::OVERHEAD == FRAME_SEAL_OVERHEAD, "frame layout reserves room for the cipher");
+
+static void put32(uint8_t *p, uint32_t v) {
+  p[0] = v & 0xFF;
+  p[1] = v >> 8 & 0xFF;
+  p[2] = v >> 16 & 0xFF;
+  p[3] = v >> 24;
+}
+
+static uint32_t get32(const uint8_t *p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+
+FrameCipher::FrameCipher() {
+  for (int i = 0; i < KEY_CACHE; i++) {
+    keys_[i].used = false;
+    mbedtls_gcm_init(&keys_[i].gcm);
+  }
+}
+
+FrameCipher::~FrameCipher() {
+  for (int i = 0; i < KEY_CACHE; i++) mbedtls_gcm_free(&keys_[i].gcm);
+}
+
+void FrameCipher::setEpochSource(EpochFn next, void *ctx) {
+  nextEpoch_ = next ? next : nextStoredEpoch;
+  epochCtx_ = ctx;
+}
+
+bool FrameCipher::begin(const uint8_t networkKey[KEY_LEN], uint16_t nodeId) {
+  nodeId_ = nodeId;
+  if (networkKey) setKey(networkKey);
+  epoch_ = nextEpoch_(epochCtx_);
+  sealedInEpoch_ = 0;
+  return true;
+}
+
+void FrameCipher::setKey(const uint8_t networkKey[KEY_LEN]) {
+  memcpy(networkKey_, networkKey, KEY_LEN);
+  for (int i = 0; i < KEY_CACHE; i++) keys_[i].used = false;
+  keyed_ = true;
+}
+
+uint32_t FrameCipher::nextStoredEpoch(void *) {
+  Preferences prefs;
+  prefs.begin("crypto", false);
+  uint32_t epoch = prefs.getUInt("epoch", 0) + 1;
+  prefs.putUInt("epoch", epoch);
+  prefs.end();
+  return epoch;
+}
+
+// Pair keys are AES_networkKey('P', lower id, higher id), the group key
+// AES_networkKey('G')
+mbedtls_gcm_context *FrameCipher::keyFor(uint16_t peer) {
+  useCounter_++;
+  Key *oldest = &keys_[0];
+  for (int i = 0; i < KEY_CACHE; i++) {
+    if (keys_[i].used && keys_[i].peer == peer) {
+      keys_[i].lastUse = useCounter_;
+      return &keys_[i].gcm;
+    }
+    if (!keys_[i].used || (oldest->used && keys_[i].lastUse < oldest->lastUse)) oldest = &keys_[i];
+  }
+
+  uint8_t block[16] = {0};
+  if (peer == FRAME_BROADCAST) {
+    block[0] = 'G';
+  } else {
+    uint16_t low = nodeId_ < peer ? nodeId_ : peer;
+    uint16_t high = nodeId_ < peer ? peer : nodeId_;
+    block[0] = 'P';
+    block[1] = low & 0xFF;
+    block[2] = low >> 8;
+    block[3] = high & 0xFF;
+    block[4] = high >> 8;
+  }
+  uint8_t key[KEY_LEN];
+  mbedtls_aes_context aes;
+  mbedtls_aes_init(&aes);
+  mbedtls_aes_setkey_enc(&aes, networkKey_, 128);
+  mbedtls_aes_crypt_ecb(&aes, MBEDTLS_AES_ENCRYPT, block, key);
+  mbedtls_aes_free(&aes);
+
+  oldest->used = mbedtls_gcm_setkey(&oldest->gcm, MBEDTLS_CIPHER_ID_AES, key, 128) == 0;
+  memset(key, 0, sizeof(key));
+  if (!oldest->used) return nullptr;
+  oldest->peer = peer;
+  oldest->lastUse = useCounter_;
+  return &oldest->gcm;
+}
+
+void FrameCipher::buildIv(const FrameHeader &header, uint32_t epoch, uint8_t iv[12]) const {
+  iv[0] = header.sender & 0xFF;
+  iv[1] = header.sender >> 8;
+  iv[2] = header.dest & 0xFF;
+  iv[3] = header.dest >> 8;
+  iv[4] = header.seq & 0xFF;
+  iv[5] = header.seq >> 8;
+  put32(iv + 6, epoch);
+  iv[10] = header.type;
+  iv[11] = 0;
+}
+
+void FrameCipher::buildAad(const FrameHeader &header, uint8_t aad[8]) const {
+  aad[0] = header.type;
+  aad[1] = header.sender & 0xFF;
+  aad[2] = header.sender >> 8;
+  aad[3] = header.dest & 0xFF;
+  aad[4] = header.dest >> 8;
+  aad[5] = header.seq & 0xFF;
+  aad[6] = header.seq >> 8;
+  aad[7] = header.flags & ~FRAME_FLAG_ATTEMPT_MASK;
+}
+
+size_t FrameCipher::seal(FrameHeader &header, uint8_t *payload, size_t len, size_t cap, uint32_t *epoch) {
+  if (!keyed_ || len + OVERHEAD > cap) return 0;
+  mbedtls_gcm_context *gcm = keyFor(header.dest == FRAME_BROADCAST ? FRAME_BROADCAST : header.dest);
+  if (!gcm) return 0;
+
+  // Sequence numbers are 16 bits, so move to a new epoch before they can wrap
+  if (sealedInEpoch_ == FRAMES_PER_EPOCH) {
+    epoch_ = nextEpoch_(epochCtx_);
+    sealedInEpoch_ = 0;
+  }
+  sealedInEpoch_++;
+
+  header.flags |= FRAME_FLAG_SEALED;
+  uint8_t iv[12];
+  uint8_t aad[8];
+  buildIv(header, epoch_, iv);
+  buildAad(header, aad);
+
+  memmove(payload + EPOCH_LEN, payload, len);
+  put32(payload, epoch_);
+  uint8_t *data = payload + EPOCH_LEN;
+  if (mbedtls_gcm_crypt_and_tag(gcm, MBEDTLS_GCM_ENCRYPT, len, iv, sizeof(iv), aad, sizeof(aad), data, data,
+                                TAG_LEN, data + len) != 0) {
+    return 0;
+  }
+  stats_.sealed++;
+  if (epoch) *epoch = epoch_;
+  return len + OVERHEAD;
+}
+
+size_t FrameCipher::sealFrame(void *ctx, FrameHeader &header, uint8_t *payload, size_t len, size_t cap,
+                              uint32_t *epoch) {
+  return ((FrameCipher *)ctx)->seal(header, payload, len, cap, epoch);
+}
+
+// Only authenticated frames may add a sender, so forgeries cannot push
+// real senders out of the table
+FrameCipher::PeerEpoch *FrameCipher::peerEpoch(uint16_t sender, bool add) {
+  PeerEpoch *oldest = &epochs_[0];
+  for (int i = 0; i < EPOCH_PEERS; i++) {
+    if (epochs_[i].used && epochs_[i].sender == sender) return &epochs_[i];
+    if (!epochs_[i].used || (oldest->used && epochs_[i].lastUse < oldest->lastUse)) oldest = &epochs_[i];
+  }
+  if (!add) return nullptr;
+  oldest->used = true;
+  oldest->sender = sender;
+  oldest->epoch = 0;
+  return oldest;
+}
+
+int FrameCipher::open(const FrameView &frame, uint8_t *out, uint32_t *epoch) {
+  const FrameHeader &header = frame.header;
+  if (!keyed_ || !(header.flags & FRAME_FLAG_SEALED) || frame.payloadLen < OVERHEAD) {
+    stats_.rejected++;
+    return -1;
+  }
+  uint32_t sealedEpoch = get32(frame.payload);
+  PeerEpoch *known = peerEpoch(header.sender, false);
+  if (known && sealedEpoch < known->epoch) {
+    stats_.replays++;
+    return -1;
+  }
+
+  mbedtls_gcm_context *gcm = keyFor(header.dest == FRAME_BROADCAST ? FRAME_BROADCAST : header.sender);
+  if (!gcm) return -1;
+  uint8_t iv[12];
+  uint8_t aad[8];
+  buildIv(header, sealedEpoch, iv);
+  buildAad(header, aad);
+
+  size_t len = frame.payloadLen - OVERHEAD;
+  const uint8_t *data = frame.payload + EPOCH_LEN;
+  if (mbedtls_gcm_auth_decrypt(gcm, len, iv, sizeof(iv), aad, sizeof(aad), data + len, TAG_LEN, data, out) != 0) {
+    stats_.rejected++;
+    return -1;
+  }
+  PeerEpoch *peer = peerEpoch(header.sender, true);
+  peer->epoch = sealedEpoch;
+  peer->lastUse = ++useCounter_;
+  stats_.opened++;
+  if (epoch) *epoch = sealedEpoch;
+  return (int)len;
+}
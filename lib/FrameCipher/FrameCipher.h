@@ -0,0 +1,110 @@
+// AES-128-GCM for frame payloads.
+//
+// Every node holds the same network key, provisioned per deployment; until
+// one is set nothing is sealed or opened. Each pair of nodes encrypts with
+// its own key derived from it, and broadcasts use a group key. The nonce is
+// built from the sender, destination, type and sequence number of the frame
+// plus the sender's epoch, a counter kept in flash that moves on every boot
+// and whenever the 16-bit sequence number could wrap, so a nonce is never
+// reused. setEpochSource() keeps the counter elsewhere, e.g. per node when
+// simulated nodes share one process. The routing fields relays change
+// (TTL, hops, attempt bits) are left out of the authenticated data.
+//
+// A sealed payload is the epoch (4 bytes), the ciphertext and an 8-byte tag.
+// Frames from an epoch older than the last one seen from that sender are
+// rejected here as replays. Replays within an epoch are ReliableLink's to
+// catch: its per-sender window, keyed on the epoch open() authenticates,
+// refuses repeated sequence numbers of unicasts and broadcasts alike, and
+// ACKs are sealed and name the epoch and sequence number they answer. On
+// the ESP32-S3 mbedTLS runs AES on the hardware accelerator; the host build
+// links a software stand-in.
+#pragma once
+
+#include <Frame.h>
+#include <mbedtls/gcm.h>
+#include <stddef.h>
+#include <stdint.h>
+
+class FrameCipher {
+public:
+  static const size_t KEY_LEN = 16;
+  static const size_t EPOCH_LEN = 4;
+  static const size_t TAG_LEN = 8;
+  static const size_t OVERHEAD = EPOCH_LEN + TAG_LEN;
+  static const int KEY_CACHE = 4;
+  static const int EPOCH_PEERS = 16;
+  // Half the sequence space, so a sender's frames within one epoch compare
+  // unambiguously in the receiver's window
+  static const uint32_t FRAMES_PER_EPOCH = 0x8000;
+
+  struct Stats {
+    uint32_t sealed;
+    uint32_t opened;
+    uint32_t rejected;  // failed authentication
+    uint32_t replays;   // stale epoch
+  };
+
+  // Returns an epoch higher than any it returned before for this node
+  typedef uint32_t (*EpochFn)(void *ctx);
+
+  FrameCipher();
+  ~FrameCipher();
+
+  // Without an epoch source, epochs come from "epoch" in the "crypto"
+  // Preferences namespace. Set before begin().
+  void setEpochSource(EpochFn next, void *ctx);
+  // Takes a new epoch. networkKey may be null until the device is
+  // provisioned.
+  bool begin(const uint8_t networkKey[KEY_LEN], uint16_t nodeId);
+  void setKey(const uint8_t networkKey[KEY_LEN]);
+  bool keyed() const { return keyed_; }
+
+  // Encrypts payload[0..len) in place, appends epoch and tag and marks the
+  // header FRAME_FLAG_SEALED. Returns the sealed length, or 0 if it would
+  // not fit in cap or there is no key. The epoch sealed in goes to *epoch.
+  size_t seal(FrameHeader &header, uint8_t *payload, size_t len, size_t cap, uint32_t *epoch = nullptr);
+  // For ReliableLink::setSealer(), with this FrameCipher as ctx
+  static size_t sealFrame(void *ctx, FrameHeader &header, uint8_t *payload, size_t len, size_t cap,
+                          uint32_t *epoch);
+
+  // Checks and decrypts a sealed frame into out, which needs room for
+  // frame.payloadLen bytes. Returns the plaintext length, or -1. The
+  // sender's epoch goes to *epoch, for ReliableLink::receive().
+  int open(const FrameView &frame, uint8_t *out, uint32_t *epoch = nullptr);
+
+  uint32_t epoch() const { return epoch_; }
+  const Stats &stats() const { return stats_; }
+
+private:
+  struct Key {
+    bool used;
+    uint16_t peer;  // the other node, or FRAME_BROADCAST for the group key
+    uint32_t lastUse;
+    mbedtls_gcm_context gcm;
+  };
+
+  struct PeerEpoch {
+    bool used;
+    uint16_t sender;
+    uint32_t epoch;
+    uint32_t lastUse;
+  };
+
+  mbedtls_gcm_context *keyFor(uint16_t peer);
+  void buildIv(const FrameHeader &header, uint32_t epoch, uint8_t iv[12]) const;
+  void buildAad(const FrameHeader &header, uint8_t aad[8]) const;
+  PeerEpoch *peerEpoch(uint16_t sender, bool add);
+  static uint32_t nextStoredEpoch(void *ctx);
+
+  uint8_t networkKey_[KEY_LEN] = {};
+  bool keyed_ = false;
+  uint16_t nodeId_ = 0;
+  EpochFn nextEpoch_ = nextStoredEpoch;
+  void *epochCtx_ = nullptr;
+  uint32_t epoch_ = 0;
+  uint32_t sealedInEpoch_ = 0;
+  uint32_t useCounter_ = 0;
+  Key keys_[KEY_CACHE];
+  PeerEpoch epochs_[EPOCH_PEERS] = {};
+  Stats stats_ = {};
+};
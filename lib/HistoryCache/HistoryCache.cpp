@@ -0,0 +1,55 @@
+#include "HistoryCache.h"
+
+HistoryCache::Entry *HistoryCache::find(uint32_t index) {
+  for (int i = 0; i < ENTRIES; i++) {
+    if (entries_[i].valid && entries_[i].index == index) return &entries_[i];
+  }
+  return nullptr;
+}
+
+// Evicts the least recently used entry (or a free one) and fills it
+HistoryCache::Entry *HistoryCache::load(uint32_t index) {
+  Entry *victim = &entries_[0];
+  for (int i = 0; i < ENTRIES; i++) {
+    if (!entries_[i].valid) {
+      victim = &entries_[i];
+      break;
+    }
+    if (entries_[i].lastUse < victim->lastUse) victim = &entries_[i];
+  }
+
+  HistoryRecord &record = victim->record;
+  if (!loader_(index, record)) {
+    record.time = 0;
+    record.peer = 0;
+    record.kind = HISTORY_OTHER;
+    record.flags = 0;
+    record.textLen = 0;
+    record.text[0] = '\0';
+  }
+  victim->index = index;
+  victim->valid = true;
+  return victim;
+}
+
+const HistoryRecord &HistoryCache::get(uint32_t index) {
+  Entry *entry = find(index);
+  if (entry) {
+    hits_++;
+  } else {
+    misses_++;
+    entry = load(index);
+  }
+  entry->lastUse = ++clock_;
+  return entry->record;
+}
+
+void HistoryCache::prefetch(uint32_t index) {
+  if (find(index)) return;
+  prefetches_++;
+  load(index)->lastUse = ++clock_;
+}
+
+void HistoryCache::invalidate() {
+  for (int i = 0; i < ENTRIES; i++) entries_[i].valid = false;
+}
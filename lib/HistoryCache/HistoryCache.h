@@ -0,0 +1,44 @@
+// Small LRU cache of history records, keyed by history index.
+#pragma once
+
+#include <HistoryRecord.h>
+#include <stddef.h>
+#include <stdint.h>
+
+class HistoryCache {
+public:
+  static const int ENTRIES = 6;
+
+  // Fills in the record at index; false if it is missing or damaged
+  typedef bool (*Loader)(uint32_t index, HistoryRecord &record);
+
+  explicit HistoryCache(Loader loader) : loader_(loader) { invalidate(); }
+
+  // Returns the record, valid until the next get/prefetch/invalidate. A
+  // missing record comes back empty, with kind HISTORY_OTHER.
+  const HistoryRecord &get(uint32_t index);
+  void prefetch(uint32_t index);
+  void invalidate();
+
+  uint32_t hits() const { return hits_; }
+  uint32_t misses() const { return misses_; }
+  uint32_t prefetches() const { return prefetches_; }
+
+private:
+  struct Entry {
+    bool valid;
+    uint32_t index;
+    uint32_t lastUse;
+    HistoryRecord record;
+  };
+
+  Entry *find(uint32_t index);
+  Entry *load(uint32_t index);
+
+  Loader loader_;
+  Entry entries_[ENTRIES];
+  uint32_t clock_ = 0;
+  uint32_t hits_ = 0;
+  uint32_t misses_ = 0;
+  uint32_t prefetches_ = 0;
+};
@@ -0,0 +1,274 @@
+#include "HistoryIndex.h"
+
+#include <Crc16.h>
+#include <string.h>
+
+uint8_t HistoryIndex::checkOf(const Entry &e) {
+  uint8_t bytes[sizeof(Entry)];
+  memcpy(bytes, &e, sizeof(e));
+  bytes[offsetof(Entry, check)] = 0;
+  return (uint8_t)crc16(bytes, sizeof(bytes));
+}
+
+uint64_t HistoryIndex::signature(const char *text, size_t len) {
+  uint64_t grams = 0;
+  for (size_t i = 0; i + 3 <= len; i++) {
+    uint32_t h = ((uint8_t)text[i] * 31u + (uint8_t)text[i + 1]) * 31u + (uint8_t)text[i + 2];
+    grams |= 1ull << ((h * 2654435761u) >> 26);
+  }
+  return grams;
+}
+
+bool HistoryIndex::begin(const char *label) {
+  partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+  if (!partition_) return false;
+
+  numSectors_ = partition_->size / SECTOR_SIZE;
+  if (numSectors_ > MAX_SECTORS) numSectors_ = MAX_SECTORS;
+  if (numSectors_ < 2) {
+    partition_ = nullptr;
+    return false;
+  }
+
+  bool found = false;
+  headSector_ = 0;
+  for (uint16_t s = 0; s < numSectors_; s++) {
+    summary_[s] = {0, 0};
+    if (!readSectorHeader(s, sectorSeq_[s])) {
+      sectorSeq_[s] = EMPTY;
+      continue;
+    }
+    if (!found || sectorSeq_[s] > sectorSeq_[headSector_]) headSector_ = s;
+    found = true;
+  }
+  pending_ = 0;
+  headCount_ = 0;
+  sealed_ = false;
+  nextSeq_ = 0;
+  lastTime_ = 0;
+  tailSector_ = headSector_;
+  if (!found) return true;
+
+  for (uint16_t s = prevSector(headSector_); s != headSector_; s = prevSector(s)) {
+    if (sectorSeq_[s] == EMPTY || sectorSeq_[s] >= sectorSeq_[tailSector_]) break;
+    tailSector_ = s;
+  }
+
+  // Summaries and the head's fill level come from reading every entry once
+  Entry chunk[CHUNK];
+  for (uint16_t s = tailSector_;; s = nextSector(s)) {
+    bool head = s == headSector_;
+    int count = head ? ENTRIES_PER_SECTOR : sectorEnd(s) - sectorSeq_[s];
+    for (int i = 0; i < count; i += CHUNK) {
+      int n = count - i < CHUNK ? count - i : CHUNK;
+      size_t offset = (size_t)s * SECTOR_SIZE + sizeof(SectorHeader) + i * sizeof(Entry);
+      if (esp_partition_read(partition_, offset, chunk, n * sizeof(Entry)) != ESP_OK) return false;
+      for (int j = 0; j < n; j++) {
+        const Entry &e = chunk[j];
+        if (head && !valid(e)) {
+          // End of the head; anything but an erased slot is a torn write
+          headCount_ = i + j;
+          sealed_ = e.kind != 0xFF || e.time != 0xFFFFFFFF;
+          count = 0;
+          break;
+        }
+        if (!valid(e)) continue;
+        summary_[s].kinds |= e.kind;
+        summary_[s].peers |= peerBit(e.peer);
+        lastTime_ = e.time;
+        if (head) headCount_ = i + j + 1;
+      }
+    }
+    if (head) break;
+  }
+  nextSeq_ = sectorSeq_[headSector_] + headCount_;
+  return true;
+}
+
+bool HistoryIndex::readSectorHeader(uint16_t sector, uint32_t &firstSeq) {
+  SectorHeader header;
+  if (esp_partition_read(partition_, (size_t)sector * SECTOR_SIZE, &header, sizeof(header)) != ESP_OK) return false;
+  if (header.magic != SECTOR_MAGIC) return false;
+  if (header.crc != crc16((const uint8_t *)&header, offsetof(SectorHeader, crc))) return false;
+  firstSeq = header.firstSeq;
+  return true;
+}
+
+bool HistoryIndex::startSector(uint32_t seq) {
+  uint16_t sector = started() ? nextSector(headSector_) : headSector_;
+  if (started() && sector == tailSector_) tailSector_ = nextSector(sector);
+
+  size_t base = (size_t)sector * SECTOR_SIZE;
+  if (esp_partition_erase_range(partition_, base, SECTOR_SIZE) != ESP_OK) return false;
+  SectorHeader header;
+  header.magic = SECTOR_MAGIC;
+  header.firstSeq = seq;
+  header.crc = crc16((const uint8_t *)&header, offsetof(SectorHeader, crc));
+  header.reserved = 0xFFFF;
+  header.reserved2 = 0xFFFFFFFF;
+  if (esp_partition_write(partition_, base, &header, sizeof(header)) != ESP_OK) return false;
+
+  sectorSeq_[sector] = seq;
+  summary_[sector] = {0, 0};
+  headSector_ = sector;
+  headCount_ = 0;
+  sealed_ = false;
+  return true;
+}
+
+bool HistoryIndex::add(uint32_t seq, uint32_t time, uint16_t peer, uint8_t kind, const char *text, size_t len) {
+  if (!partition_ || (started() && seq < nextSeq_)) return false;
+  bool newSector = !started() || sealed_ || seq != nextSeq_ || headCount_ == ENTRIES_PER_SECTOR;
+  if (newSector ? pending_ > 0 : pending_ == BUFFER_ENTRIES) return false;
+  if (newSector && !startSector(seq)) return false;
+
+  if (time < lastTime_) time = lastTime_;  // keeps times sorted for the range search
+  Entry &e = buffer_[pending_++];
+  e.time = time;
+  e.peer = peer;
+  e.kind = kind;
+  e.grams = signature(text, len);
+  e.check = checkOf(e);
+
+  summary_[headSector_].kinds |= kind;
+  summary_[headSector_].peers |= peerBit(peer);
+  headCount_++;
+  nextSeq_ = seq + 1;
+  lastTime_ = time;
+  return true;
+}
+
+bool HistoryIndex::flush() {
+  if (!partition_ || pending_ == 0) return true;
+  size_t offset = (size_t)headSector_ * SECTOR_SIZE + sizeof(SectorHeader) + (headCount_ - pending_) * sizeof(Entry);
+  if (esp_partition_write(partition_, offset, buffer_, pending_ * sizeof(Entry)) != ESP_OK) return false;
+  pending_ = 0;
+  return true;
+}
+
+bool HistoryIndex::reset() {
+  if (!partition_) return false;
+  if (esp_partition_erase_range(partition_, 0, (size_t)numSectors_ * SECTOR_SIZE) != ESP_OK) return false;
+  for (uint16_t s = 0; s < numSectors_; s++) {
+    sectorSeq_[s] = EMPTY;
+    summary_[s] = {0, 0};
+  }
+  headSector_ = tailSector_ = 0;
+  headCount_ = 0;
+  sealed_ = false;
+  pending_ = 0;
+  nextSeq_ = 0;
+  return true;
+}
+
+// Sectors from tail to head hold increasing sequence numbers
+int HistoryIndex::findSector(uint32_t seq) const {
+  int lo = 0;
+  int hi = (headSector_ - tailSector_ + numSectors_) % numSectors_;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if (sectorSeq_[(tailSector_ + mid) % numSectors_] <= seq) lo = mid;
+    else hi = mid - 1;
+  }
+  return (tailSector_ + lo) % numSectors_;
+}
+
+// One past the last sequence number with an entry slot in a sector
+uint32_t HistoryIndex::sectorEnd(uint16_t sector) const {
+  if (sector == headSector_) return sectorSeq_[sector] + headCount_;
+  uint32_t end = sectorSeq_[sector] + ENTRIES_PER_SECTOR;
+  uint32_t next = sectorSeq_[nextSector(sector)];
+  return next < end ? next : end;
+}
+
+// Entries [seq, seq + n) of a sector, from flash or the batch
+bool HistoryIndex::readEntries(uint16_t sector, uint32_t seq, Entry *out, int n) {
+  int slot = seq - sectorSeq_[sector];
+  int flushed = sector == headSector_ ? headCount_ - pending_ : ENTRIES_PER_SECTOR;
+  int fromFlash = slot + n <= flushed ? n : slot < flushed ? flushed - slot : 0;
+  if (fromFlash > 0) {
+    size_t offset = (size_t)sector * SECTOR_SIZE + sizeof(SectorHeader) + slot * sizeof(Entry);
+    if (esp_partition_read(partition_, offset, out, fromFlash * sizeof(Entry)) != ESP_OK) return false;
+  }
+  if (fromFlash < n) memcpy(out + fromFlash, buffer_ + (slot + fromFlash - flushed), (n - fromFlash) * sizeof(Entry));
+  return true;
+}
+
+bool HistoryIndex::firstEntryTime(uint16_t sector, uint32_t &time) {
+  Entry e;
+  if (sectorEnd(sector) == sectorSeq_[sector] || !readEntries(sector, sectorSeq_[sector], &e, 1) || !valid(e)) {
+    return false;
+  }
+  time = e.time;
+  return true;
+}
+
+static bool contains(const char *text, size_t len, const char *needle, size_t needleLen) {
+  if (needleLen > len) return false;
+  for (size_t i = 0; i + needleLen <= len; i++) {
+    if (memcmp(text + i, needle, needleLen) == 0) return true;
+  }
+  return false;
+}
+
+int HistoryIndex::search(const Query &query, uint32_t from, uint32_t to, uint32_t *out, int max, TextFn text,
+                         void *ctx) {
+  if (!partition_ || !started() || max <= 0) return 0;
+  if (from < firstSeq()) from = firstSeq();
+  if (to > nextSeq_) to = nextSeq_;
+
+  // Narrow to the sectors whose first entries bracket the time range
+  int sectors = (headSector_ - tailSector_ + numSectors_) % numSectors_ + 1;
+  for (int i = 0; i < sectors; i++) {
+    uint16_t s = (tailSector_ + i) % numSectors_;
+    uint32_t t;
+    if (!firstEntryTime(s, t)) continue;
+    if (t > query.toTime && sectorSeq_[s] < to) to = sectorSeq_[s];
+    uint16_t next = nextSector(s);
+    uint32_t nextTime;
+    if (s != headSector_ && firstEntryTime(next, nextTime) && nextTime < query.fromTime && sectorSeq_[next] > from) {
+      from = sectorSeq_[next];
+    }
+  }
+
+  size_t needleLen = query.text ? strlen(query.text) : 0;
+  uint64_t grams = signature(query.text, needleLen);
+  char buf[512];
+  int found = 0;
+  Entry chunk[CHUNK];
+
+  for (uint32_t seq = to; seq > from && found < max;) {
+    uint16_t s = findSector(seq - 1);
+    uint32_t end = sectorEnd(s);
+    uint32_t start = sectorSeq_[s] > from ? sectorSeq_[s] : from;
+    if (seq > end) seq = end;  // a gap in the index
+    if (seq <= start) {
+      if (sectorSeq_[s] <= from || s == tailSector_) break;
+      seq = sectorSeq_[s];
+      continue;
+    }
+    const Summary &sum = summary_[s];
+    if ((query.kinds && !(sum.kinds & query.kinds)) || (!query.anyPeer && !(sum.peers & peerBit(query.peer)))) {
+      seq = start;
+      continue;
+    }
+
+    int n = seq - start < (uint32_t)CHUNK ? seq - start : CHUNK;
+    if (!readEntries(s, seq - n, chunk, n)) return found;
+    for (int i = n - 1; i >= 0 && found < max; i--) {
+      const Entry &e = chunk[i];
+      uint32_t entrySeq = seq - n + i;
+      if (!valid(e) || e.time < query.fromTime || e.time > query.toTime) continue;
+      if (query.kinds && !(e.kind & query.kinds)) continue;
+      if (!query.anyPeer && e.peer != query.peer) continue;
+      if (needleLen > 0) {
+        if ((e.grams & grams) != grams || !text) continue;
+        size_t len = text(ctx, entrySeq, buf, sizeof(buf));
+        if (!contains(buf, len, query.text, needleLen)) continue;
+      }
+      out[found++] = entrySeq;
+    }
+    seq -= n;
+  }
+  return found;
+}
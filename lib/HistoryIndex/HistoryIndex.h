@@ -0,0 +1,128 @@
+// Secondary index over the message log, on its own flash partition.
+//
+// One 16-byte entry per log record, in log order: time, peer, direction and
+// a 64-bit signature with one bit set per hashed trigram of the text. Like
+// MessageLog the partition is a ring of sectors, each starting with a
+// header holding the sequence number of its first entry, so the entry for
+// a sequence number is found without scanning; a sequence number that
+// skips ahead, or a torn entry at the head, starts a new sector.
+//
+// Times never go backwards, so a time range narrows the search to a span of
+// sectors. Within it entries are scanned newest first, skipping sectors
+// whose summary (directions and a small Bloom filter of peers, kept in RAM)
+// rules them out. Only entries whose signature holds every trigram of the
+// query text are read back from the log to check the text itself.
+//
+// Entries are batched in RAM like the log's records. The owner writes them
+// with flush() only after flushing the log, so the index never gets ahead
+// of it; an index left behind by a power cut is caught up from the log.
+//
+// The 384 KB msgidx partition holds about 24k entries, while the 1.375 MB
+// log holds about 34k records of typical length (36 bytes) and more when
+// they are short. Records older than firstSeq() are not searched; the owner
+// says so when a search fails.
+#pragma once
+
+#include <HistoryRecord.h>
+#include <esp_partition.h>
+#include <stddef.h>
+#include <stdint.h>
+
+class HistoryIndex {
+public:
+  static const uint8_t KIND_SENT = HISTORY_SENT;
+  static const uint8_t KIND_RECEIVED = HISTORY_RECEIVED;
+  static const uint8_t KIND_OTHER = HISTORY_OTHER;
+  static const uint16_t PEER_UNKNOWN = 0;
+  static const uint16_t MAX_SECTORS = 128;
+  static const int BUFFER_ENTRIES = 16;  // one flash page
+
+  struct Query {
+    uint32_t fromTime = 0;
+    uint32_t toTime = UINT32_MAX;  // inclusive
+    uint8_t kinds = 0;             // any if 0
+    bool anyPeer = true;
+    uint16_t peer = PEER_UNKNOWN;
+    const char *text = nullptr;    // substring, any if null or empty
+  };
+
+  // Reads the text of the record with a sequence number back from the log
+  typedef size_t (*TextFn)(void *ctx, uint32_t seq, char *buf, size_t cap);
+
+  bool begin(const char *label = "msgidx");
+  bool ready() const { return partition_ != nullptr; }
+
+  // Sequence numbers must increase. Returns false when flush() has to be
+  // called first (the batch is full or the entry starts a new sector).
+  bool add(uint32_t seq, uint32_t time, uint16_t peer, uint8_t kind, const char *text, size_t len);
+  bool flush();
+  int pending() const { return pending_; }
+  // Erases the whole index, for a log that was replaced
+  bool reset();
+
+  // Entries cover [firstSeq(), nextSeq()), minus any gaps
+  uint32_t firstSeq() const { return started() ? sectorSeq_[tailSector_] : 0; }
+  uint32_t nextSeq() const { return nextSeq_; }
+  uint32_t lastTime() const { return lastTime_; }
+
+  // Fills out with up to max sequence numbers in [from, to) matching the
+  // query, newest first, and returns how many
+  int search(const Query &query, uint32_t from, uint32_t to, uint32_t *out, int max, TextFn text, void *ctx);
+
+  static uint64_t signature(const char *text, size_t len);
+
+private:
+  struct Entry {
+    uint32_t time;
+    uint16_t peer;
+    uint8_t kind;   // 0xFF while erased
+    uint8_t check;  // low byte of a CRC-16 over the other fields
+    uint64_t grams;
+  } __attribute__((packed));
+
+  struct SectorHeader {
+    uint32_t magic;
+    uint32_t firstSeq;
+    uint16_t crc;
+    uint16_t reserved;
+    uint32_t reserved2;
+  };
+
+  struct Summary {
+    uint8_t kinds;
+    uint32_t peers;  // Bloom filter, one bit per peer
+  };
+
+  static const uint32_t SECTOR_SIZE = SPI_FLASH_SEC_SIZE;
+  static const uint32_t SECTOR_MAGIC = 0x5844494D;  // "MIDX"
+  static const int ENTRIES_PER_SECTOR = (SECTOR_SIZE - sizeof(SectorHeader)) / sizeof(Entry);
+  static const int CHUNK = 32;  // entries read at a time while scanning
+  static const uint32_t EMPTY = 0xFFFFFFFF;
+
+  static uint8_t checkOf(const Entry &e);
+  static bool valid(const Entry &e) { return e.kind != 0xFF && e.check == checkOf(e); }
+  static uint32_t peerBit(uint16_t peer) { return 1u << ((peer * 40503u) >> 11 & 31); }
+
+  bool started() const { return sectorSeq_[headSector_] != EMPTY; }
+  bool readSectorHeader(uint16_t sector, uint32_t &firstSeq);
+  bool startSector(uint32_t seq);
+  int findSector(uint32_t seq) const;
+  uint32_t sectorEnd(uint16_t sector) const;
+  bool readEntries(uint16_t sector, uint32_t seq, Entry *out, int n);
+  bool firstEntryTime(uint16_t sector, uint32_t &time);
+  uint16_t prevSector(uint16_t sector) const { return sector == 0 ? numSectors_ - 1 : sector - 1; }
+  uint16_t nextSector(uint16_t sector) const { return sector + 1 == numSectors_ ? 0 : sector + 1; }
+
+  const esp_partition_t *partition_ = nullptr;
+  uint32_t sectorSeq_[MAX_SECTORS];
+  Summary summary_[MAX_SECTORS];
+  uint16_t numSectors_ = 0;
+  uint16_t headSector_ = 0;
+  uint16_t tailSector_ = 0;
+  int headCount_ = 0;     // entries in the head sector, pending ones included
+  bool sealed_ = false;   // the head has a torn entry and takes no more
+  uint32_t nextSeq_ = 0;
+  uint32_t lastTime_ = 0;
+  Entry buffer_[BUFFER_ENTRIES];
+  int pending_ = 0;
+};
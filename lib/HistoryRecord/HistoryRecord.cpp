@@ -0,0 +1,114 @@
+#include "HistoryRecord.h"
+
+#include <MessageCodec.h>
+#include <MessageLog.h>
+#include <Preferences.h>
+#include <stdio.h>
+#include <string.h>
+
+size_t historyPack(const HistoryRecord &record, uint8_t *out, size_t cap) {
+  if (cap < HISTORY_HEADER_LEN) return 0;
+  out[0] = HISTORY_SCHEMA;
+  out[1] = record.kind;
+  out[2] = record.peer;
+  out[3] = record.peer >> 8;
+  for (int i = 0; i < 4; i++) out[4 + i] = record.time >> (8 * i);
+  size_t len = messageEncode(record.text, record.textLen, out + HISTORY_HEADER_LEN, cap - HISTORY_HEADER_LEN);
+  return len ? HISTORY_HEADER_LEN + len : 0;
+}
+
+bool historyUnpack(const uint8_t *in, size_t len, HistoryRecord &record) {
+  if (len > 0 && in[0] >= ' ') return historyFromString(in, len, record);
+  if (len < HISTORY_HEADER_LEN || in[0] != HISTORY_SCHEMA) return false;
+
+  record.kind = in[1];
+  record.peer = in[2] | in[3] << 8;
+  record.time = 0;
+  for (int i = 0; i < 4; i++) record.time |= (uint32_t)in[4 + i] << (8 * i);
+  size_t encodedLen = len - HISTORY_HEADER_LEN;
+  size_t textLen =
+      encodedLen ? messageDecode(in + HISTORY_HEADER_LEN, encodedLen, record.text, HistoryRecord::MAX_TEXT) : 0;
+  if (textLen == 0 && encodedLen > 1) return false;  // only a tag decodes to no text
+  record.textLen = textLen;
+  record.text[textLen] = '\0';
+  return true;
+}
+
+bool historyFromString(const uint8_t *in, size_t len, HistoryRecord &record) {
+  record.time = 0;
+  record.peer = 0;
+  record.kind = HISTORY_OTHER;
+
+  const uint8_t *colon = (const uint8_t *)memchr(in, ':', len);
+  size_t typeLen = colon ? colon - in : len;
+  if (typeLen == 4 && !memcmp(in, "Sent", 4)) record.kind = HISTORY_SENT;
+  if (typeLen == 8 && !memcmp(in, "Received", 8)) record.kind = HISTORY_RECEIVED;
+
+  // Other types keep their prefix, as there is no field for it
+  size_t skip = record.kind != HISTORY_OTHER && typeLen + 2 <= len ? typeLen + 2 : 0;
+  const uint8_t *text = in + skip;
+  size_t textLen = len - skip;
+  if (skip > 0 && textLen > 0 && text[0] < ' ') {
+    size_t encodedLen = textLen;
+    textLen = messageDecode(text, encodedLen, record.text, HistoryRecord::MAX_TEXT);
+    if (textLen == 0 && encodedLen > 1) return false;
+  } else {
+    if (textLen > HistoryRecord::MAX_TEXT) textLen = HistoryRecord::MAX_TEXT;
+    memcpy(record.text, text, textLen);
+  }
+  record.textLen = textLen;
+  record.text[textLen] = '\0';
+  return true;
+}
+
+const char *historyKindName(uint8_t kind) {
+  if (kind == HISTORY_SENT) return "Sent";
+  if (kind == HISTORY_RECEIVED) return "Received";
+  return "";
+}
+
+bool historyMigrate(MessageLog &log, int stopAfter) {
+  Preferences prefs;
+  if (!prefs.begin("messages", false)) return false;
+  int count = prefs.getInt("count", 0);
+  if (count <= 0) {
+    prefs.end();
+    return true;
+  }
+
+  // Records already flushed by an earlier run are skipped
+  uint32_t start = prefs.getUInt("logStart", UINT32_MAX);
+  if (start > log.nextSeq()) {
+    start = log.nextSeq();
+    prefs.putUInt("logStart", start);
+  }
+  uint32_t skip = log.nextSeq() - start;
+
+  static HistoryRecord record;
+  uint8_t data[MessageLog::MAX_RECORD_LEN];
+  int appended = 0;
+  for (int i = 0; i < count; i++) {
+    char key[16];
+    snprintf(key, sizeof(key), "msg%d", i);
+    if (!prefs.isKey(key)) continue;
+    String msg = prefs.getString(key, "");
+    size_t len = 0;
+    if (historyFromString((const uint8_t *)msg.c_str(), msg.length(), record)) {
+      len = historyPack(record, data, sizeof(data));
+    }
+    if (len == 0) continue;
+    if (skip > 0) {
+      skip--;
+      continue;
+    }
+    if (appended == stopAfter || !log.append(data, len)) {
+      prefs.end();
+      return false;
+    }
+    appended++;
+  }
+
+  bool done = log.flush() && prefs.clear();
+  prefs.end();
+  return done;
+}
@@ -0,0 +1,63 @@
+// Message history records, as stored in the MessageLog.
+//
+// Schema 1 (little-endian):
+//
+//   offset  size  field
+//   0       1     schema version (1)
+//   1       1     kind: HISTORY_SENT, HISTORY_RECEIVED or HISTORY_OTHER
+//   2       2     peer node id: the sender of a received message, the
+//                 destination of a sent one
+//   4       4     time in seconds
+//   8       n     text, as a MessageCodec encoding
+//
+// The delivery state changes after a record is written, so it stays in the
+// log's status flags and is filled in on load, as is the log sequence
+// number. Records from before the schema are "Type: text" strings, the
+// text plain or MessageCodec-encoded. They start with a printable
+// character, never a schema version, and are converted on load.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+class MessageLog;
+
+static const uint8_t HISTORY_SCHEMA = 1;
+static const size_t HISTORY_HEADER_LEN = 8;
+
+enum HistoryKind : uint8_t {
+  HISTORY_SENT = 0x01,
+  HISTORY_RECEIVED = 0x02,
+  HISTORY_OTHER = 0x04,
+};
+
+struct HistoryRecord {
+  static const size_t MAX_TEXT = 512;  // as much as an old string record holds
+
+  uint32_t seq;
+  uint32_t time;
+  uint16_t peer;
+  uint8_t kind;
+  uint8_t flags;
+  uint16_t textLen;
+  char text[MAX_TEXT + 1];  // NUL-terminated
+};
+
+// Returns the stored length, or 0 if it does not fit in cap
+size_t historyPack(const HistoryRecord &record, uint8_t *out, size_t cap);
+// Fills in everything but seq and flags. Returns false for a record that
+// does not parse; old string records are converted.
+bool historyUnpack(const uint8_t *in, size_t len, HistoryRecord &record);
+// Converts a "Type: text" string, with no time or peer
+bool historyFromString(const uint8_t *in, size_t len, HistoryRecord &record);
+// "Sent", "Received", or "" for anything else
+const char *historyKindName(uint8_t kind);
+
+// Moves history kept as "msgN" string keys in the "messages" Preferences
+// namespace, from before the log, into log as records. The keys go only
+// once every record is flushed to flash. A run cut short resumes where the
+// flushed records end, counted from the log sequence number noted when the
+// migration began, so no entry is lost or copied twice. Returns false if it
+// did not finish; stopAfter >= 0 makes it return after appending that many
+// records without flushing them, as a power cut would.
+bool historyMigrate(MessageLog &log, int stopAfter = -1);
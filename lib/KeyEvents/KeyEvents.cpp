@@ -0,0 +1,51 @@
+#include "KeyEvents.h"
+
+#include <Arduino.h>
+
+KeyEvents::KeyEvents(Keypad &keypad, uint32_t holdMs, uint32_t repeatMs) : keypad_(keypad), repeatUs_(repeatMs * 1000) {
+  keypad_.setHoldTime(holdMs);
+}
+
+void KeyEvents::push(char key, KeyEventType type, uint32_t nowUs) {
+  KeyEvent *event = queue_.beginPush();
+  if (!event) return;
+  event->key = key;
+  event->type = type;
+  event->timeUs = nowUs;
+  queue_.commitPush();
+}
+
+void KeyEvents::scan(uint32_t nowUs) {
+  scans_++;
+  if (keypad_.getKeys()) {
+    for (int i = 0; i < LIST_MAX; i++) {
+      const Key &k = keypad_.key[i];
+      if (!k.stateChanged) continue;
+      if (k.kstate == PRESSED) {
+        push(k.kchar, KEY_PRESS, nowUs);
+      } else if (k.kstate == HOLD) {
+        push(k.kchar, KEY_HOLD, nowUs);
+        nextRepeatUs_[i] = nowUs + repeatUs_;
+      } else if (k.kstate == RELEASED) {
+        push(k.kchar, KEY_RELEASE, nowUs);
+      }
+    }
+  }
+
+  for (int i = 0; i < LIST_MAX; i++) {
+    const Key &k = keypad_.key[i];
+    if (k.kstate != HOLD || (int32_t)(nowUs - nextRepeatUs_[i]) < 0) continue;
+    push(k.kchar, KEY_REPEAT, nowUs);
+    nextRepeatUs_[i] += repeatUs_;
+  }
+}
+
+void KeyEvents::scanTimer(void *arg) { ((KeyEvents *)arg)->scan(micros()); }
+
+bool KeyEvents::next(KeyEvent &event) {
+  const KeyEvent *front = queue_.peek();
+  if (!front) return false;
+  event = *front;
+  queue_.pop();
+  return true;
+}
@@ -0,0 +1,52 @@
+// Timestamped key events from a Keypad scanned off the main loop.
+//
+// scan() is called from a periodic timer (the esp_timer task). It lets the
+// Keypad library debounce the matrix, turns its PRESSED, HOLD and RELEASED
+// transitions into events, and adds a REPEAT event every repeatMs while a
+// key stays held. Events go through an SPSC queue to loop(), which pops
+// them with next(); a full queue drops the event and counts it.
+#pragma once
+
+#include <Keypad.h>
+#include <SpscQueue.h>
+#include <stdint.h>
+
+enum KeyEventType : uint8_t {
+  KEY_PRESS,
+  KEY_HOLD,
+  KEY_REPEAT,
+  KEY_RELEASE,
+};
+
+struct KeyEvent {
+  char key;
+  KeyEventType type;
+  uint32_t timeUs;  // micros() when the scan saw it
+};
+
+class KeyEvents {
+public:
+  static const int QUEUE = 32;
+
+  KeyEvents(Keypad &keypad, uint32_t holdMs, uint32_t repeatMs);
+
+  // Timer side
+  void scan(uint32_t nowUs);
+  // For esp_timer_create(), with this KeyEvents as arg
+  static void scanTimer(void *arg);
+
+  // loop() side
+  bool next(KeyEvent &event);
+
+  uint32_t scans() const { return scans_; }
+  uint32_t dropped() const { return queue_.overflows(); }
+
+private:
+  void push(char key, KeyEventType type, uint32_t nowUs);
+
+  Keypad &keypad_;
+  uint32_t repeatUs_;
+  uint32_t nextRepeatUs_[LIST_MAX] = {};
+  uint32_t scans_ = 0;
+  SpscQueue<KeyEvent, QUEUE> queue_;
+};
@@ -0,0 +1,39 @@
+#include "KnobFilter.h"
+
+KnobFilter::KnobFilter(int slots, int hysteresis) : slots_(slots), hysteresis_((int32_t)hysteresis << FRACTION_BITS) {}
+
+static uint16_t median3(uint16_t a, uint16_t b, uint16_t c) {
+  if (a > b) {
+    uint16_t t = a;
+    a = b;
+    b = t;
+  }
+  if (b > c) b = c;
+  return a > b ? a : b;
+}
+
+int KnobFilter::slotOf(int32_t avg) const {
+  int slot = (int)(((int64_t)avg * slots_) >> (12 + FRACTION_BITS));
+  if (slot < 0) return 0;
+  return slot < slots_ ? slot : slots_ - 1;
+}
+
+void KnobFilter::sample(uint16_t raw) {
+  if (raw >= CODES) raw = CODES - 1;
+  if (samples_++ == 0) {
+    prev_[0] = prev_[1] = raw;
+    avg_ = (int32_t)raw << FRACTION_BITS;
+    index_ = slotOf(avg_);
+    return;
+  }
+
+  uint16_t m = median3(prev_[0], prev_[1], raw);
+  prev_[0] = prev_[1];
+  prev_[1] = raw;
+  avg_ += (((int32_t)m << FRACTION_BITS) - avg_) >> SMOOTHING_SHIFT;
+
+  // Leave the current slot only when clearly past one of its edges
+  int32_t low = ((int32_t)index_ * CODES << FRACTION_BITS) / slots_;
+  int32_t high = ((int32_t)(index_ + 1) * CODES << FRACTION_BITS) / slots_;
+  if (avg_ < low - hysteresis_ || avg_ >= high + hysteresis_) index_ = slotOf(avg_);
+}
@@ -0,0 +1,43 @@
+// Turns raw 12-bit potentiometer samples into a stable slot index.
+//
+// Each sample goes through a median of three, which drops single-sample
+// ADC spikes, then an exponential moving average that moves 1/8 of the way
+// to it. The 4096 raw codes are split into equal slots, and the index only
+// changes once the average is more than hysteresis codes past the edge of
+// the current slot, so a knob resting on a boundary cannot chatter between
+// a character and the dead slots next to it. sample() is cheap enough to
+// run for every conversion; index() is a plain read of the last result.
+#pragma once
+
+#include <stdint.h>
+
+class KnobFilter {
+public:
+  static const int CODES = 4096;
+
+  KnobFilter(int slots, int hysteresis);
+
+  void sample(uint16_t raw);
+
+  // -1 until the first sample
+  int index() const { return index_; }
+  // Filtered raw value
+  int value() const { return (avg_ + (1 << (FRACTION_BITS - 1))) >> FRACTION_BITS; }
+  uint32_t samples() const { return samples_; }
+
+  // Raw value in the middle of a slot, for tests and the host driver
+  static int slotCentre(int slot, int slots) { return (int)(((2L * slot + 1) * CODES) / (2L * slots)); }
+
+private:
+  static const int FRACTION_BITS = 4;
+  static const int SMOOTHING_SHIFT = 3;
+
+  int slotOf(int32_t avg) const;
+
+  int slots_;
+  int32_t hysteresis_;  // in avg_ units
+  int32_t avg_ = 0;     // raw << FRACTION_BITS
+  uint16_t prev_[2] = {};
+  int index_ = -1;
+  uint32_t samples_ = 0;
+};
@@ -0,0 +1,205 @@
+#include "Mesh.h"
+
+#include <string.h>
+
+const uint8_t Mesh::BROADCAST_MAC[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+void Mesh::begin(uint16_t nodeId, unsigned long nowMs) {
+  nodeId_ = nodeId;
+  rng_ = 0x9E3779B9u ^ nodeId;
+  // Announce soon after boot, but not in step with nodes powered on together
+  nextBeaconMs_ = nowMs + random() % 1000;
+}
+
+uint32_t Mesh::random() {
+  rng_ ^= rng_ << 13;
+  rng_ ^= rng_ >> 17;
+  rng_ ^= rng_ << 5;
+  return rng_;
+}
+
+const Mesh::Route *Mesh::findRoute(uint16_t id) const {
+  for (int i = 0; i < MAX_ROUTES; i++) {
+    if (routes_[i].used && routes_[i].id == id) return &routes_[i];
+  }
+  return nullptr;
+}
+
+int Mesh::routeHops(uint16_t id) const {
+  const Route *route = findRoute(id);
+  return route ? route->hops : -1;
+}
+
+int Mesh::destinations(uint16_t *ids, int max) const {
+  int n = 0;
+  for (int i = 0; i < MAX_ROUTES && n < max; i++) {
+    if (routes_[i].used) ids[n++] = routes_[i].id;
+  }
+  return n;
+}
+
+// Keeps the shortest path heard, and the current one on a tie so flood
+// copies from other neighbours do not churn the peer list, but moves to a
+// longer one if the current next hop has gone quiet for a couple of beacon
+// intervals
+void Mesh::learn(uint16_t id, const uint8_t *mac, uint8_t hops, unsigned long nowMs) {
+  Route *route = nullptr;
+  Route *oldest = &routes_[0];
+  for (int i = 0; i < MAX_ROUTES; i++) {
+    if (routes_[i].used && routes_[i].id == id) {
+      route = &routes_[i];
+      break;
+    }
+    if (!routes_[i].used || (oldest->used && routes_[i].lastMs < oldest->lastMs)) oldest = &routes_[i];
+  }
+
+  if (route) {
+    bool sameHop = memcmp(route->mac, mac, 6) == 0;
+    bool stale = nowMs - route->lastMs > 2 * BEACON_INTERVAL_MS;
+    if (!sameHop && hops >= route->hops && !stale) return;
+    if (sameHop) {
+      route->hops = hops;
+      route->lastMs = nowMs;
+      // Room may have been made since
+      if (!route->peered && addPeer(mac)) {
+        for (int i = 0; i < MAX_ROUTES; i++) {
+          if (routes_[i].used && memcmp(routes_[i].mac, mac, 6) == 0) routes_[i].peered = true;
+        }
+      }
+      return;
+    }
+    dropRoute(*route);
+  } else {
+    route = oldest;
+    if (route->used) dropRoute(*route);
+  }
+
+  const Route *sameMac = nullptr;
+  for (int i = 0; i < MAX_ROUTES && !sameMac; i++) {
+    if (routes_[i].used && memcmp(routes_[i].mac, mac, 6) == 0) sameMac = &routes_[i];
+  }
+  route->used = true;
+  route->id = id;
+  memcpy(route->mac, mac, 6);
+  route->hops = hops;
+  route->lastMs = nowMs;
+  route->peered = sameMac ? sameMac->peered : addPeer(mac);
+}
+
+bool Mesh::addPeer(const uint8_t *mac) {
+  if (!peer_ || peer_(ctx_, mac, true)) return true;
+  stats_.peersRefused++;
+  return false;
+}
+
+// Routes through the same next hop share its peer entry
+void Mesh::dropRoute(Route &route) {
+  route.used = false;
+  for (int i = 0; i < MAX_ROUTES; i++) {
+    if (routes_[i].used && memcmp(routes_[i].mac, route.mac, 6) == 0) return;
+  }
+  if (peer_ && route.peered) peer_(ctx_, route.mac, false);
+}
+
+// Returns true if the frame was seen recently, otherwise remembers it
+bool Mesh::checkSeen(const FrameHeader &header, unsigned long nowMs) {
+  uint8_t typeAttempt = header.type << 2 | (header.flags & FRAME_FLAG_ATTEMPT_MASK) >> FRAME_FLAG_ATTEMPT_SHIFT;
+  for (int i = 0; i < SEEN_CACHE; i++) {
+    const Seen &s = seen_[i];
+    if (s.sender == header.sender && s.seq == header.seq && s.typeAttempt == typeAttempt &&
+        nowMs - s.ms < SEEN_TIMEOUT_MS) {
+      return true;
+    }
+  }
+  Seen &s = seen_[seenNext_];
+  seenNext_ = (seenNext_ + 1) % SEEN_CACHE;
+  s.sender = header.sender;
+  s.seq = header.seq;
+  s.typeAttempt = typeAttempt;
+  s.ms = nowMs;
+  return false;
+}
+
+// from is the neighbour a relayed frame came from; sending it back there
+// would loop, so it is flooded instead
+bool Mesh::send(const uint8_t *frame, size_t len, bool forwarded, const uint8_t *from) {
+  uint16_t dest = frameDest(frame);
+  const Route *route = nullptr;
+  // A retransmission may mean the route is broken, so flood it
+  if (routing_ && dest != FRAME_BROADCAST && !(frameFlags(frame) & FRAME_FLAG_ATTEMPT_MASK)) route = findRoute(dest);
+  if (route && from && memcmp(route->mac, from, 6) == 0) route = nullptr;
+  if (route && !route->peered) route = nullptr;
+
+  if (route) {
+    stats_.unicasts++;
+    return send_(ctx_, route->mac, frame, len, forwarded);
+  }
+  stats_.floods++;
+  return send_(ctx_, BROADCAST_MAC, frame, len, forwarded);
+}
+
+bool Mesh::transmit(const uint8_t *frame, size_t len) { return send(frame, len, false, nullptr); }
+
+bool Mesh::receive(const uint8_t *mac, const uint8_t *buf, size_t len, const FrameView &frame,
+                   unsigned long nowMs) {
+  const FrameHeader &h = frame.header;
+  if (h.sender == nodeId_) return false;  // our own flood coming back
+
+  if (checkSeen(h, nowMs)) {
+    stats_.duplicates++;
+    return false;
+  }
+
+  if (h.dest != nodeId_) {
+    if (h.ttl == 0) {
+      stats_.ttlExpired++;
+    } else {
+      Relay *relay = nullptr;
+      for (int i = 0; i < RELAY_QUEUE && !relay; i++) {
+        if (!relays_[i].used) relay = &relays_[i];
+      }
+      if (relay) {
+        memcpy(relay->frame, buf, len);
+        memcpy(relay->from, mac, 6);
+        relay->len = len;
+        frameSetRouting(relay->frame, len, h.ttl - 1, h.hops + 1);
+        relay->dueMs = nowMs + random() % (MAX_RELAY_JITTER_MS + 1);
+        relay->used = true;
+      } else {
+        stats_.relayOverflows++;
+      }
+    }
+  }
+
+  return h.dest == nodeId_ || h.dest == FRAME_BROADCAST;
+}
+
+void Mesh::heard(const uint8_t *mac, const FrameHeader &header, unsigned long nowMs) {
+  if (header.sender != nodeId_) learn(header.sender, mac, header.hops + 1, nowMs);
+}
+
+void Mesh::tick(unsigned long nowMs) {
+  for (int i = 0; i < RELAY_QUEUE; i++) {
+    Relay &relay = relays_[i];
+    if (!relay.used || (long)(nowMs - relay.dueMs) < 0) continue;
+    relay.used = false;
+    if (send(relay.frame, relay.len, true, relay.from)) stats_.relayed++;
+  }
+
+  if ((long)(nowMs - nextBeaconMs_) >= 0) {
+    uint8_t frame[FRAME_OVERHEAD + FRAME_SEAL_OVERHEAD];
+    FrameHeader header = {FRAME_BEACON, nodeId_, FRAME_BROADCAST, beaconSeq_++, 0, FRAME_DEFAULT_TTL, 0};
+    size_t payloadLen = 0;
+    uint32_t epoch;
+    if (seal_) payloadLen = seal_(sealCtx_, header, framePayload(frame), 0, FRAME_SEAL_OVERHEAD, &epoch);
+    if (!seal_ || payloadLen > 0) {
+      size_t len = frameEncode(frame, sizeof(frame), header, payloadLen);
+      if (send(frame, len, true, nullptr)) stats_.beacons++;
+    }
+    nextBeaconMs_ = nowMs + BEACON_INTERVAL_MS - MAX_RELAY_JITTER_MS + random() % (2 * MAX_RELAY_JITTER_MS);
+  }
+
+  for (int i = 0; i < MAX_ROUTES; i++) {
+    if (routes_[i].used && nowMs - routes_[i].lastMs > ROUTE_TIMEOUT_MS) dropRoute(routes_[i]);
+  }
+}
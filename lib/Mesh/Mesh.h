@@ -0,0 +1,144 @@
+// Multi-hop forwarding of frames between ESP-NOW nodes.
+//
+// Every node broadcasts a FRAME_BEACON now and then, and every new frame
+// that authenticates teaches the receiver which neighbour (MAC address)
+// leads back to the frame's sender and in how many hops. receive() only
+// filters; the caller hands a frame to heard() once FrameCipher has opened
+// it, and beacons are sealed like any other frame. A frame for a node with
+// a known route goes unicast to that next hop; broadcasts, frames for
+// unknown nodes and retransmissions (in case the route has broken) are
+// flooded instead. Frames for other nodes are relayed while their TTL
+// lasts, each at most once: a small cache remembers (sender, seq, type,
+// attempt) of recent frames. Relays wait a short random time so neighbours
+// that heard the same flood do not all transmit at once.
+//
+// Known limitations: frames are relayed without being authenticated, as a
+// relay cannot open frames between other pairs of nodes, so a forger can
+// still spend the relays' airtime. The hop count is not authenticated either
+// (relays change it), so a node that re-sends genuine frames with fewer hops
+// can still draw routes through itself, and then drop what it is sent.
+//
+// Unicast needs the next hop in ESP-NOW's peer list, which holds about 20
+// entries. A next hop the peer callback could not add is still remembered,
+// but frames routed through it are flooded until a later attempt succeeds.
+#pragma once
+
+#include <Frame.h>
+#include <stddef.h>
+#include <stdint.h>
+
+class Mesh {
+public:
+  static const int MAX_ROUTES = 32;
+  static const int SEEN_CACHE = 64;
+  static const int RELAY_QUEUE = 8;
+  static const unsigned long BEACON_INTERVAL_MS = 10000;
+  static const unsigned long ROUTE_TIMEOUT_MS = 35000;
+  static const unsigned long SEEN_TIMEOUT_MS = 500;
+  static const unsigned long MAX_RELAY_JITTER_MS = 8;
+
+  // forwarded is true for frames the mesh sends by itself (relays and
+  // beacons) rather than ones handed to transmit()
+  typedef bool (*SendFn)(void *ctx, const uint8_t *mac, const uint8_t *frame, size_t len, bool forwarded);
+  // Called when a neighbour starts or stops being used as a next hop, so it
+  // can be added to or removed from the ESP-NOW peer list. Returns whether
+  // an added peer can be sent to (ignored on removal).
+  typedef bool (*PeerFn)(void *ctx, const uint8_t *mac, bool add);
+  // As ReliableLink::SealFn, for beacons; returns 0 to refuse the send
+  typedef size_t (*SealFn)(void *ctx, FrameHeader &header, uint8_t *payload, size_t len, size_t cap,
+                           uint32_t *epoch);
+
+  struct Stats {
+    uint32_t unicasts;
+    uint32_t floods;
+    uint32_t relayed;
+    uint32_t duplicates;
+    uint32_t ttlExpired;
+    uint32_t relayOverflows;
+    uint32_t beacons;
+    uint32_t peersRefused;  // attempts to add a next hop the peer list had no room for
+  };
+
+  static const uint8_t BROADCAST_MAC[6];
+
+  Mesh(SendFn send, PeerFn peer, void *ctx = nullptr) : send_(send), peer_(peer), ctx_(ctx) {}
+
+  void begin(uint16_t nodeId, unsigned long nowMs);
+  // Flooding only, for comparison with routed delivery
+  void setRouting(bool enabled) { routing_ = enabled; }
+  // Without a sealer beacons go out as they are
+  void setSealer(SealFn seal, void *ctx) {
+    seal_ = seal;
+    sealCtx_ = ctx;
+  }
+
+  // Sends one of our own encoded frames towards frameDest(frame)
+  bool transmit(const uint8_t *frame, size_t len);
+
+  // Takes every decoded frame from the radio, with the MAC it came from, and
+  // queues the relay if it is for another node. Returns true when the frame
+  // is new and addressed to this node or to everyone, beacons included, and
+  // should be authenticated and, unless a beacon, processed by the caller.
+  bool receive(const uint8_t *mac, const uint8_t *buf, size_t len, const FrameView &frame, unsigned long nowMs);
+  // Learns the route back to the sender of a frame receive() passed and
+  // the cipher has opened
+  void heard(const uint8_t *mac, const FrameHeader &header, unsigned long nowMs);
+
+  // Sends due relays and beacons and forgets stale routes
+  void tick(unsigned long nowMs);
+
+  // Nodes with a route, in no particular order. Returns how many were written.
+  int destinations(uint16_t *ids, int max) const;
+  int routeHops(uint16_t id) const;
+
+  const Stats &stats() const { return stats_; }
+
+private:
+  struct Route {
+    bool used;
+    uint16_t id;
+    uint8_t mac[6];
+    bool peered;  // the next hop is in the peer list, so unicast works
+    uint8_t hops;
+    unsigned long lastMs;
+  };
+
+  struct Seen {
+    uint16_t sender;
+    uint16_t seq;
+    uint8_t typeAttempt;
+    unsigned long ms;
+  };
+
+  struct Relay {
+    bool used;
+    unsigned long dueMs;
+    uint8_t from[6];
+    uint8_t len;
+    uint8_t frame[FRAME_MAX_LEN];
+  };
+
+  const Route *findRoute(uint16_t id) const;
+  void learn(uint16_t id, const uint8_t *mac, uint8_t hops, unsigned long nowMs);
+  void dropRoute(Route &route);
+  bool addPeer(const uint8_t *mac);
+  bool checkSeen(const FrameHeader &header, unsigned long nowMs);
+  bool send(const uint8_t *frame, size_t len, bool forwarded, const uint8_t *from);
+  uint32_t random();
+
+  SendFn send_;
+  PeerFn peer_;
+  void *ctx_;
+  SealFn seal_ = nullptr;
+  void *sealCtx_ = nullptr;
+  uint16_t nodeId_ = 0;
+  bool routing_ = true;
+  uint32_t rng_ = 1;
+  uint16_t beaconSeq_ = 0;
+  unsigned long nextBeaconMs_ = 0;
+  Route routes_[MAX_ROUTES] = {};
+  Seen seen_[SEEN_CACHE] = {};
+  int seenNext_ = 0;
+  Relay relays_[RELAY_QUEUE] = {};
+  Stats stats_ = {};
+};
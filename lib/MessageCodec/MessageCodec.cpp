@@ -0,0 +1,262 @@
+#include "MessageCodec.h"
+
+#include <string.h>
+
+const char MESSAGE_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 ";
+static const int SYMBOLS = sizeof(MESSAGE_ALPHABET) - 1;
+
+// Quick replies. The position is the ID sent on the wire, so only append.
+static const char *const quickReplies[] = {
+  "OK", "YES", "NO", "ON MY WAY", "RUNNING {} MIN LATE", "BACK IN {} MIN", "MEET AT {}", "WHERE ARE YOU",
+  "I AM SAFE", "NEED HELP AT {}", "CALL ME", "ARRIVED", "THANKS", "SEE YOU SOON", "WAIT FOR ME", "BATTERY LOW",
+};
+static const int QUICK_REPLIES = sizeof(quickReplies) / sizeof(quickReplies[0]);
+
+// Codebook for MSG_PACKED: byte 37 + i stands for entry i. Generated by
+// tools/mkcodebook.py from tools/t9words.txt and the quick replies.
+// Sorted by first letter, longest first, so the encoder only scans
+// entries that start with the next character. Changing it breaks decoding
+// of older messages.
+static const char *const codebook[] = {
+  "ARRIVED ", "ARRIVED", "ABOUT ", "AFTER ", "ALSO ", "ALL ", "ALSO", "AND ", "ANY ", "ARE ", "AN ",
+  "AR ", "AS ", "AT ", "AY ", "A ", "AL", "AN", "AR", "AS", "BATTERY ", "BECAUSE ", "BELIEVE ",
+  "BACK ", "BUT ", "BE ", "BY ", "BE", "CONTINUE", "COMING ", "COULD ", "CALL ", "COME ", "CAN ",
+  "CE ", "CH ", "CA", "CH", "DAY ", "DE ", "DO ", "D ", "EVEN ", "EET ", "EVER", "ED ", "EN ",
+  "ER ", "E ", "EV", "FIRST ", "FROM ", "FOR ", "FIR", "FOR", "FE", "FI", "GIVE ", "GOOD ", "GET ",
+  "GE ", "GHT", "GO", "HELLO ", "HAVE ", "HELP ", "HELP", "HER ", "HIM ", "HIS ", "HOW ", "HE ",
+  "HA", "HE", "HI", "HO", "INTO ", "IDE ", "ING ", "ID ", "IF ", "IN ", "IT ", "I ", "IN", "IT",
+  "JUST ", "KING ", "KNOW ", "KNO", "K ", "LEAVING ", "LIKE ", "LLOW ", "LOOK ", "LATE", "LOW ",
+  "LD ", "LEA", "LL ", "LY ", "L ", "LI", "LO", "MESSAGE ", "MEMBER ", "MAKE ", "MEET ", "MOST ",
+  "ME ", "MIN", "MY ", "M ", "MA", "ME", "MO", "NEED ", "NOT ", "NOW ", "ND ", "NG ", "NT ", "N ",
+  "NE", "NO", "OTHER ", "ONLY ", "OVER ", "ONE ", "OUR ", "OUT ", "OF ", "ON ", "OR ", "OK",
+  "PEOPLE ", "PLEASE ", "PE", "RUNNING ", "RUNNIN", "RE ", "REA", "RY ", "R ", "RE", "RI", "RO",
+  "SORRY ", "SSAGE ", "SOME ", "SAY ", "SEE ", "SHE ", "SIDE", "SOME", "SOON", "SE ", "SO ", "ST ",
+  "STA", "STO", "S ", "SA", "SE", "ST", "TOMORROW", "TONIGHT ", "THANKS ", "THANK ", "THANKS",
+  "THEIR ", "THERE ", "THESE ", "THING ", "THINK ", "TAKE ", "THAN ", "THAT ", "THEM ", "THEN ",
+  "THEY ", "THING", "THIS ", "TIME ", "TION ", "THE ", "THE", "TO ", "T ", "TE", "TO", "UNDERSTA",
+  "UNNING", "USE ", "UP ", "VEN ", "VE ", "WHERE ", "WHICH ", "WOULD ", "WAIT ", "WANT ", "WELL ",
+  "WHAT ", "WHEN ", "WILL ", "WITH ", "WORK ", "WAY ", "WHO ", "WITH", "WE ", "WA", "WE", "YEAR ",
+  "YOUR ", "YOU ", "Y ", "YE",
+};
+static const int CODEBOOK = sizeof(codebook) / sizeof(codebook[0]);
+static_assert(SYMBOLS + CODEBOOK <= 256, "codebook must fit in a byte with the alphabet");
+
+static int symbolOf(char c) {
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= '0' && c <= '9') return 26 + c - '0';
+  return c == ' ' ? 36 : -1;
+}
+
+// First codebook entry for each symbol (and the end), built on first use
+static uint8_t bucketStart[SYMBOLS + 1];
+
+static void buildBuckets() {
+  static bool built = false;
+  if (built) return;
+  int entry = 0;
+  for (int s = 0; s < SYMBOLS; s++) {
+    bucketStart[s] = entry;
+    while (entry < CODEBOOK && symbolOf(codebook[entry][0]) == s) entry++;
+  }
+  bucketStart[SYMBOLS] = entry;
+  built = true;
+}
+
+// Greedy longest match; returns 0 if the text has a character outside the
+// alphabet or does not fit
+static size_t pack(const char *text, size_t len, uint8_t *out, size_t cap) {
+  buildBuckets();
+  size_t n = 0;
+  for (size_t i = 0; i < len;) {
+    int symbol = symbolOf(text[i]);
+    if (symbol < 0 || n == cap) return 0;
+    uint8_t code = symbol;
+    size_t used = 1;
+    for (int e = bucketStart[symbol]; e < bucketStart[symbol + 1]; e++) {
+      size_t entryLen = strlen(codebook[e]);
+      if (entryLen > used && entryLen <= len - i && memcmp(text + i, codebook[e], entryLen) == 0) {
+        code = SYMBOLS + e;
+        used = entryLen;
+        break;
+      }
+    }
+    out[n++] = code;
+    i += used;
+  }
+  return n;
+}
+
+static size_t unpack(const uint8_t *in, size_t len, char *out, size_t cap) {
+  size_t n = 0;
+  for (size_t i = 0; i < len; i++) {
+    const char *s;
+    size_t sLen;
+    if (in[i] < SYMBOLS) {
+      s = &MESSAGE_ALPHABET[in[i]];
+      sLen = 1;
+    } else {
+      s = codebook[in[i] - SYMBOLS];
+      sLen = strlen(s);
+    }
+    if (n + sLen > cap) return 0;
+    memcpy(out + n, s, sLen);
+    n += sLen;
+  }
+  return n;
+}
+
+// Base 37: each group of up to 12 symbols is a bijective base-37 number
+// (digits 1-37, first symbol least significant), which fits in 63 bits.
+// Full groups take 8 bytes; the last takes only the bytes its value needs,
+// and because the numbering is bijective its length needs no marker.
+static const size_t GROUP_SYMBOLS = 12;
+static const size_t GROUP_BYTES = 8;
+
+// Bytes for the last group of n symbols: the largest value has all digits 37
+static size_t tailBytes(size_t n) {
+  uint64_t max = 0;
+  for (size_t i = 0; i < n; i++) max = max * SYMBOLS + SYMBOLS;
+  size_t bytes = 0;
+  for (; max; max >>= 8) bytes++;
+  return bytes;
+}
+
+size_t base37Size(size_t len) {
+  return len / GROUP_SYMBOLS * GROUP_BYTES + (len % GROUP_SYMBOLS ? tailBytes(len % GROUP_SYMBOLS) : 0);
+}
+
+size_t base37Pack(const char *text, size_t len, uint8_t *out, size_t cap) {
+  size_t size = base37Size(len);
+  if (size > cap) return 0;
+  uint8_t *o = out;
+  for (size_t start = 0; start < len; start += GROUP_SYMBOLS) {
+    size_t n = len - start < GROUP_SYMBOLS ? len - start : GROUP_SYMBOLS;
+    uint64_t value = 0;
+    for (size_t i = n; i-- > 0;) {
+      int symbol = symbolOf(text[start + i]);
+      if (symbol < 0) return 0;
+      value = value * SYMBOLS + symbol + 1;
+    }
+    size_t bytes = n == GROUP_SYMBOLS ? GROUP_BYTES : tailBytes(n);
+    for (size_t b = 0; b < bytes; b++, value >>= 8) *o++ = (uint8_t)value;
+  }
+  return size;
+}
+
+size_t base37Unpack(const uint8_t *in, size_t len, char *out, size_t cap) {
+  size_t n = 0;
+  for (size_t start = 0; start < len; start += GROUP_BYTES) {
+    size_t bytes = len - start < GROUP_BYTES ? len - start : GROUP_BYTES;
+    uint64_t value = 0;
+    for (size_t b = bytes; b-- > 0;) value = value << 8 | in[start + b];
+    for (; value; value = (value - 1) / SYMBOLS) {
+      if (n == cap) return 0;
+      out[n++] = MESSAGE_ALPHABET[(value - 1) % SYMBOLS];
+    }
+  }
+  return n;
+}
+
+// Splits a quick reply around its "{}"; prefix only if it has none
+static bool splitReply(const char *reply, size_t &prefixLen, const char *&suffix) {
+  const char *slot = strstr(reply, "{}");
+  prefixLen = slot ? (size_t)(slot - reply) : strlen(reply);
+  suffix = slot ? slot + 2 : nullptr;
+  return slot != nullptr;
+}
+
+// Finds a quick reply the text is an instance of; sets param to its value
+static int matchReply(const char *text, size_t len, size_t &paramStart, size_t &paramLen) {
+  for (int id = 0; id < QUICK_REPLIES; id++) {
+    size_t prefixLen;
+    const char *suffix;
+    if (!splitReply(quickReplies[id], prefixLen, suffix)) {
+      if (prefixLen == len && memcmp(text, quickReplies[id], len) == 0) {
+        paramStart = paramLen = 0;
+        return id;
+      }
+      continue;
+    }
+    size_t suffixLen = strlen(suffix);
+    if (len <= prefixLen + suffixLen || memcmp(text, quickReplies[id], prefixLen) != 0 ||
+        memcmp(text + len - suffixLen, suffix, suffixLen) != 0) {
+      continue;
+    }
+    paramStart = prefixLen;
+    paramLen = len - prefixLen - suffixLen;
+    return id;
+  }
+  return -1;
+}
+
+size_t messageEncode(const char *text, size_t len, uint8_t *out, size_t cap) {
+  if (cap < 2) return 0;
+
+  size_t paramStart, paramLen;
+  int id = matchReply(text, len, paramStart, paramLen);
+  if (id >= 0) {
+    size_t n = paramLen ? pack(text + paramStart, paramLen, out + 2, cap - 2) : 0;
+    if (n > 0 || paramLen == 0) {
+      out[0] = MSG_TEMPLATE;
+      out[1] = id;
+      return n + 2;
+    }
+  }
+
+  size_t n = pack(text, len, out + 1, cap - 1);
+  if (n > 0 && base37Size(len) < n) {
+    out[0] = MSG_BASE37;
+    return base37Pack(text, len, out + 1, cap - 1) + 1;
+  }
+  if (n > 0 || len == 0) {
+    out[0] = MSG_PACKED;
+    return n + 1;
+  }
+
+  if (len + 1 > cap) return 0;
+  out[0] = MSG_RAW;
+  memcpy(out + 1, text, len);
+  return len + 1;
+}
+
+size_t messageDecode(const uint8_t *in, size_t len, char *out, size_t cap) {
+  if (len == 0) return 0;
+  switch (in[0]) {
+    case MSG_RAW:
+      if (len - 1 > cap) return 0;
+      memcpy(out, in + 1, len - 1);
+      return len - 1;
+    case MSG_PACKED:
+      return unpack(in + 1, len - 1, out, cap);
+    case MSG_BASE37:
+      return base37Unpack(in + 1, len - 1, out, cap);
+    case MSG_TEMPLATE: {
+      if (len < 2 || in[1] >= QUICK_REPLIES) return 0;
+      char param[MESSAGE_MAX_TEXT];
+      size_t paramLen = unpack(in + 2, len - 2, param, sizeof(param) - 1);
+      if (paramLen == 0 && len > 2) return 0;
+      param[paramLen] = '\0';
+      return quickReplyFormat(in[1], param, out, cap);
+    }
+  }
+  return 0;
+}
+
+int quickReplyCount() { return QUICK_REPLIES; }
+
+const char *quickReply(int id) { return id >= 0 && id < QUICK_REPLIES ? quickReplies[id] : nullptr; }
+
+size_t quickReplyFormat(int id, const char *param, char *out, size_t cap) {
+  const char *reply = quickReply(id);
+  if (!reply) return 0;
+  size_t prefixLen;
+  const char *suffix;
+  bool hasSlot = splitReply(reply, prefixLen, suffix);
+  size_t paramLen = hasSlot ? strlen(param) : 0;
+  size_t suffixLen = hasSlot ? strlen(suffix) : 0;
+  if (prefixLen + paramLen + suffixLen > cap) return 0;
+  memcpy(out, reply, prefixLen);
+  memcpy(out + prefixLen, param, paramLen);
+  memcpy(out + prefixLen + paramLen, suffix, suffixLen);
+  return prefixLen + paramLen + suffixLen;
+}
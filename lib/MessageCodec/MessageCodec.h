@@ -0,0 +1,46 @@
+// Message text on the wire. An encoded message is a tag byte and a body:
+//
+//   MSG_RAW       the text as is, for characters outside the alphabet
+//   MSG_PACKED    one byte per alphabet symbol (0-36) or per entry of a
+//                 static codebook of common words and letter groups
+//                 (37-255), SMAZ-style
+//   MSG_TEMPLATE  a quick-reply ID, then its parameter packed as above
+//   MSG_BASE37    the symbols as base-37 digits, 12 to 8 bytes (5.3 bits
+//                 a symbol), for alphabet text the codebook does not suit
+//
+// messageEncode() recognises text that is a quick reply, with or without a
+// parameter, and otherwise takes the shorter of the two packings; either
+// way it is never longer than the raw form. The alphabet is the sketch's
+// characterSet. The same encoding is used for the text of history records.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum MessageEncoding : uint8_t {
+  MSG_RAW = 0,
+  MSG_PACKED = 1,
+  MSG_TEMPLATE = 2,
+  MSG_BASE37 = 3,
+};
+
+static const size_t MESSAGE_MAX_TEXT = 480;
+
+extern const char MESSAGE_ALPHABET[];
+
+// Returns the encoded length, or 0 if it does not fit in cap
+size_t messageEncode(const char *text, size_t len, uint8_t *out, size_t cap);
+// Returns the text length, or 0 if the message is malformed or does not
+// fit in cap. The text is not NUL-terminated.
+size_t messageDecode(const uint8_t *in, size_t len, char *out, size_t cap);
+
+// The MSG_BASE37 body alone. Pack returns 0 if the text has a character
+// outside the alphabet or does not fit; base37Size() is its exact length.
+size_t base37Size(size_t len);
+size_t base37Pack(const char *text, size_t len, uint8_t *out, size_t cap);
+size_t base37Unpack(const uint8_t *in, size_t len, char *out, size_t cap);
+
+// Quick replies: "{}" marks where the parameter goes
+int quickReplyCount();
+const char *quickReply(int id);
+size_t quickReplyFormat(int id, const char *param, char *out, size_t cap);
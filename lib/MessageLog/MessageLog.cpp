@@ -0,0 +1,280 @@
+#include "MessageLog.h"
+
+#include <Crc16.h>
+#include <Preferences.h>
+#include <string.h>
+
+bool MessageLog::begin(const char *label) {
+  partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+  if (!partition_) return false;
+
+  numSectors_ = partition_->size / SECTOR_SIZE;
+  if (numSectors_ > MAX_SECTORS) numSectors_ = MAX_SECTORS;
+  if (numSectors_ < 2) {
+    partition_ = nullptr;
+    return false;
+  }
+
+  erasedSector_ = -1;
+  stats_ = {};
+
+  Preferences prefs;
+  prefs.begin("msglog", true);
+  clearedSeq_ = prefs.getUInt("cleared", 0);
+  prefs.end();
+
+  // The newest sector is the one with the highest starting sequence number
+  bool found = false;
+  for (uint16_t s = 0; s < numSectors_; s++) {
+    if (!readSectorHeader(s, sectorSeq_[s])) {
+      sectorSeq_[s] = EMPTY;
+      continue;
+    }
+    if (!found || sectorSeq_[s] > sectorSeq_[headSector_]) headSector_ = s;
+    found = true;
+  }
+
+  if (!found) {
+    headSector_ = 0;
+    tailSector_ = 0;
+    nextSeq_ = clearedSeq_;
+    firstSeq_ = clearedSeq_;
+    return startSector(0);
+  }
+
+  // Walk backwards while sequence numbers keep decreasing to find the oldest
+  tailSector_ = headSector_;
+  for (uint16_t s = prevSector(headSector_); s != headSector_; s = prevSector(s)) {
+    if (sectorSeq_[s] == EMPTY || sectorSeq_[s] >= sectorSeq_[tailSector_]) break;
+    tailSector_ = s;
+  }
+
+  nextSeq_ = sectorSeq_[headSector_] + scanSector(headSector_, &headOffset_);
+  flushedOffset_ = headOffset_;
+  firstSeq_ = sectorSeq_[tailSector_];
+  if (clearedSeq_ > firstSeq_ && clearedSeq_ <= nextSeq_) firstSeq_ = clearedSeq_;
+  return true;
+}
+
+uint32_t MessageLog::capacityBytes() const {
+  return (uint32_t)numSectors_ * (SECTOR_SIZE - sizeof(SectorHeader));
+}
+
+// Reads flash, or the buffer for records not flushed yet
+bool MessageLog::readAt(size_t offset, void *dst, size_t len) {
+  size_t pendingStart = (size_t)headSector_ * SECTOR_SIZE + flushedOffset_;
+  if (offset >= pendingStart && offset < pendingStart + pending()) {
+    memcpy(dst, buffer_ + (offset - pendingStart), len);
+    return true;
+  }
+  return esp_partition_read(partition_, offset, dst, len) == ESP_OK;
+}
+
+bool MessageLog::readSectorHeader(uint16_t sector, uint32_t &firstSeq) {
+  SectorHeader header;
+  if (esp_partition_read(partition_, (size_t)sector * SECTOR_SIZE, &header, sizeof(header)) != ESP_OK) return false;
+  if (header.magic != SECTOR_MAGIC) return false;
+  if (header.crc != crc16((const uint8_t *)&header, offsetof(SectorHeader, crc))) return false;
+  firstSeq = header.firstSeq;
+  return true;
+}
+
+bool MessageLog::startSector(uint16_t sector) {
+  size_t base = (size_t)sector * SECTOR_SIZE;
+  if (sector != erasedSector_) {
+    if (esp_partition_erase_range(partition_, base, SECTOR_SIZE) != ESP_OK) return false;
+    stats_.erases++;
+  }
+  erasedSector_ = -1;
+
+  SectorHeader header;
+  header.magic = SECTOR_MAGIC;
+  header.firstSeq = nextSeq_;
+  header.crc = crc16((const uint8_t *)&header, offsetof(SectorHeader, crc));
+  header.reserved = 0xFFFF;
+  if (esp_partition_write(partition_, base, &header, sizeof(header)) != ESP_OK) return false;
+  stats_.writes++;
+  stats_.bytesWritten += sizeof(header);
+
+  sectorSeq_[sector] = nextSeq_;
+  headSector_ = sector;
+  headOffset_ = sizeof(SectorHeader);
+  flushedOffset_ = headOffset_;
+  return true;
+}
+
+// Counts committed records and finds the first free byte of a sector.
+// Committed records whose data fails its CRC, left by a batch cut short,
+// are marked dead.
+uint32_t MessageLog::scanSector(uint16_t sector, uint32_t *endOffset) {
+  size_t base = (size_t)sector * SECTOR_SIZE;
+  uint32_t offset = sizeof(SectorHeader);
+  uint32_t records = 0;
+  uint8_t data[MAX_RECORD_LEN];
+
+  while (offset + sizeof(RecordHeader) <= SECTOR_SIZE) {
+    RecordHeader header;
+    if (esp_partition_read(partition_, base + offset, &header, sizeof(header)) != ESP_OK) break;
+    if (header.magic == 0xFF && header.len == 0xFFFF) break;  // erased, end of data
+    if ((header.magic != RECORD_MAGIC && header.magic != DEAD_MAGIC) || header.len > MAX_RECORD_LEN ||
+        offset + sizeof(header) + header.len > SECTOR_SIZE) {
+      offset = SECTOR_SIZE;  // torn header, treat the rest of the sector as used
+      break;
+    }
+    if (header.magic == RECORD_MAGIC && !(header.status & STATUS_COMMITTED)) {
+      bool intact = esp_partition_read(partition_, base + offset + sizeof(header), data, header.len) == ESP_OK &&
+                    crc16(data, header.len) == header.crc;
+      if (intact) {
+        records++;
+      } else {
+        uint8_t dead = DEAD_MAGIC;
+        esp_partition_write(partition_, base + offset + offsetof(RecordHeader, magic), &dead, 1);
+      }
+    }
+    offset += sizeof(header) + header.len;
+  }
+
+  if (endOffset) *endOffset = offset;
+  return records;
+}
+
+bool MessageLog::append(const uint8_t *data, size_t len, uint8_t flags) {
+  if (!partition_ || len > MAX_RECORD_LEN) return false;
+
+  uint32_t need = sizeof(RecordHeader) + len;
+  if (headOffset_ + need > SECTOR_SIZE) {
+    if (!flush()) return false;
+    uint16_t next = nextSector(headSector_);
+    if (next == tailSector_) {
+      tailSector_ = nextSector(next);
+      if (sectorSeq_[tailSector_] == EMPTY) tailSector_ = next;
+    }
+    if (!startSector(next)) return false;
+    if (tailSector_ == next) {
+      firstSeq_ = nextSeq_;
+    } else if (sectorSeq_[tailSector_] > firstSeq_) {
+      firstSeq_ = sectorSeq_[tailSector_];
+    }
+  }
+
+  if (pending() + need > BUFFER_LEN && !flush()) return false;
+
+  // Staged already committed: the batch is programmed in one write
+  RecordHeader header;
+  header.magic = RECORD_MAGIC;
+  header.status = 0xFF & ~STATUS_COMMITTED & ~(flags & FLAG_MASK);
+  header.len = len;
+  header.crc = crc16(data, len);
+  uint8_t *record = buffer_ + pending();
+  memcpy(record, &header, sizeof(header));
+  memcpy(record + sizeof(header), data, len);
+  headOffset_ += need;
+  nextSeq_++;
+  stats_.records++;
+  stats_.payloadBytes += len;
+
+  if (pending() >= PAGE_SIZE) flush();
+  return true;
+}
+
+bool MessageLog::flush() {
+  if (!partition_ || pending() == 0) return true;
+  size_t offset = (size_t)headSector_ * SECTOR_SIZE + flushedOffset_;
+  if (esp_partition_write(partition_, offset, buffer_, pending()) != ESP_OK) return false;
+  stats_.writes++;
+  stats_.bytesWritten += pending();
+  flushedOffset_ = headOffset_;
+  return true;
+}
+
+// The sector after the head is dead if it is outside the ring, or is the
+// tail and every record in it is older than firstSeq_ (cleared)
+bool MessageLog::compact() {
+  if (!partition_) return false;
+  uint16_t next = nextSector(headSector_);
+  if (next == erasedSector_) return false;
+  if (next == tailSector_) {
+    if (sectorSeq_[nextSector(next)] > firstSeq_) return false;
+    tailSector_ = nextSector(next);
+  }
+
+  if (esp_partition_erase_range(partition_, (size_t)next * SECTOR_SIZE, SECTOR_SIZE) != ESP_OK) return false;
+  sectorSeq_[next] = EMPTY;
+  erasedSector_ = next;
+  stats_.erases++;
+  stats_.compactions++;
+  return true;
+}
+
+// Sectors from tail to head hold increasing sequence numbers
+int MessageLog::findSector(uint32_t seq) const {
+  int lo = 0;
+  int hi = (headSector_ - tailSector_ + numSectors_) % numSectors_;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if (sectorSeq_[(tailSector_ + mid) % numSectors_] <= seq) lo = mid;
+    else hi = mid - 1;
+  }
+  return (tailSector_ + lo) % numSectors_;
+}
+
+// Finds the partition offset and header of a stored record
+bool MessageLog::locate(uint32_t seq, size_t &offset, RecordHeader &header) {
+  if (!partition_ || !contains(seq)) return false;
+  int sector = findSector(seq);
+  size_t base = (size_t)sector * SECTOR_SIZE;
+  uint32_t pos = sizeof(SectorHeader);
+  uint32_t current = sectorSeq_[sector];
+
+  while (pos + sizeof(RecordHeader) <= SECTOR_SIZE) {
+    if (!readAt(base + pos, &header, sizeof(header))) return false;
+    if ((header.magic != RECORD_MAGIC && header.magic != DEAD_MAGIC) || header.len > MAX_RECORD_LEN) return false;
+
+    if (header.magic == RECORD_MAGIC && !(header.status & STATUS_COMMITTED)) {
+      if (current == seq) {
+        offset = base + pos;
+        return true;
+      }
+      current++;
+    }
+    pos += sizeof(header) + header.len;
+  }
+  return false;
+}
+
+size_t MessageLog::read(uint32_t index, uint8_t *buf, size_t maxLen, uint8_t *flags) {
+  size_t offset;
+  RecordHeader header;
+  if (index >= count() || !locate(seqOf(index), offset, header) || header.len > maxLen) return 0;
+  if (!readAt(offset + sizeof(header), buf, header.len)) return 0;
+  if (crc16(buf, header.len) != header.crc) return 0;
+  if (flags) *flags = ~header.status & FLAG_MASK;
+  return header.len;
+}
+
+bool MessageLog::setFlags(uint32_t seq, uint8_t flags) {
+  size_t offset;
+  RecordHeader header;
+  if (!locate(seq, offset, header)) return false;
+  uint8_t status = header.status & ~(flags & FLAG_MASK);
+  size_t pendingStart = (size_t)headSector_ * SECTOR_SIZE + flushedOffset_;
+  if (offset >= pendingStart && offset < pendingStart + pending()) {
+    buffer_[offset - pendingStart + offsetof(RecordHeader, status)] = status;
+    return true;
+  }
+  if (esp_partition_write(partition_, offset + offsetof(RecordHeader, status), &status, 1) != ESP_OK) return false;
+  stats_.writes++;
+  stats_.bytesWritten++;
+  return true;
+}
+
+void MessageLog::clear() {
+  flush();  // a later mount must not find fewer records than clearedSeq_
+  clearedSeq_ = nextSeq_;
+  firstSeq_ = nextSeq_;
+
+  Preferences prefs;
+  prefs.begin("msglog", false);
+  prefs.putUInt("cleared", clearedSeq_);
+  prefs.end();
+}
@@ -0,0 +1,114 @@
+// Append-only circular message log on a raw flash partition.
+//
+// The partition is a ring of flash sectors. Each sector starts with a header
+// holding the sequence number of its first record, followed by
+// length-prefixed records. Appends are O(1); when the head sector fills up
+// the next one is erased, dropping the oldest records. A record only counts
+// once its commit bit is programmed, so a write cut short by power loss is
+// skipped on the next mount.
+//
+// Appends are staged in RAM and programmed in batches, committed in the same
+// write: a batch goes to flash once it fills a flash page, when the head
+// sector is full, or on flush(). Records not yet flushed are lost on power
+// loss. A batch cut short leaves records whose data fails its CRC; the next
+// mount marks them dead by clearing their magic byte. compact() erases the
+// next sector ahead of time once nothing live is left in it (after clear(),
+// or before the ring first wraps), so the append that moves on to it does
+// not wait for the erase.
+//
+// The rest of that status byte holds caller flags. Flags can only be set,
+// never cleared, because setting one just programs bits from 1 to 0.
+#pragma once
+
+#include <esp_partition.h>
+#include <stddef.h>
+#include <stdint.h>
+
+class MessageLog {
+public:
+  static const uint16_t MAX_RECORD_LEN = 512;
+  static const uint16_t MAX_SECTORS = 512;
+  static const uint8_t FLAG_MASK = 0x7F;
+  static const uint32_t PAGE_SIZE = 256;  // flash program page
+  static const size_t BUFFER_LEN = 1024;
+
+  struct Stats {
+    uint32_t records;       // appended
+    uint32_t payloadBytes;  // record data appended
+    uint32_t bytesWritten;  // programmed into flash, headers included
+    uint32_t writes;        // program operations
+    uint32_t erases;
+    uint32_t compactions;   // erases done ahead of time by compact()
+  };
+
+  bool begin(const char *label = "msglog");
+  bool ready() const { return partition_ != nullptr; }
+
+  bool append(const uint8_t *data, size_t len, uint8_t flags = 0);
+  // Index 0 is the oldest record still stored. Returns the record length,
+  // or 0 when the index is out of range or the record is damaged.
+  size_t read(uint32_t index, uint8_t *buf, size_t maxLen, uint8_t *flags = nullptr);
+  uint32_t count() const { return nextSeq_ - firstSeq_; }
+
+  // Sequence numbers identify a record for as long as it is stored
+  uint32_t nextSeq() const { return nextSeq_; }
+  uint32_t seqOf(uint32_t index) const { return firstSeq_ + index; }
+  bool contains(uint32_t seq) const { return seq - firstSeq_ < count(); }
+  bool setFlags(uint32_t seq, uint8_t flags);
+  uint32_t capacityBytes() const;
+
+  // Bytes appended but not yet in flash
+  size_t pending() const { return headOffset_ - flushedOffset_; }
+  bool flush();
+  // Returns true if it erased a sector
+  bool compact();
+  const Stats &stats() const { return stats_; }
+
+  // Hides every stored record without erasing the partition
+  void clear();
+
+private:
+  struct SectorHeader {
+    uint32_t magic;
+    uint32_t firstSeq;
+    uint16_t crc;
+    uint16_t reserved;
+  };
+
+  struct RecordHeader {
+    uint8_t magic;
+    uint8_t status;
+    uint16_t len;
+    uint16_t crc;
+  } __attribute__((packed));
+
+  static const uint32_t SECTOR_SIZE = SPI_FLASH_SEC_SIZE;
+  static const uint32_t SECTOR_MAGIC = 0x474F4C4D;  // "MLOG"
+  static const uint8_t RECORD_MAGIC = 0xA5;
+  static const uint8_t DEAD_MAGIC = 0x00;  // damaged record, skipped
+  static const uint8_t STATUS_COMMITTED = 0x80;  // cleared once the record is complete
+  static const uint32_t EMPTY = 0xFFFFFFFF;
+
+  bool readAt(size_t offset, void *dst, size_t len);
+  bool readSectorHeader(uint16_t sector, uint32_t &firstSeq);
+  bool startSector(uint16_t sector);
+  uint32_t scanSector(uint16_t sector, uint32_t *endOffset);
+  bool locate(uint32_t seq, size_t &offset, RecordHeader &header);
+  int findSector(uint32_t seq) const;
+  uint16_t prevSector(uint16_t sector) const { return sector == 0 ? numSectors_ - 1 : sector - 1; }
+  uint16_t nextSector(uint16_t sector) const { return sector + 1 == numSectors_ ? 0 : sector + 1; }
+
+  const esp_partition_t *partition_ = nullptr;
+  uint32_t sectorSeq_[MAX_SECTORS];
+  uint16_t numSectors_ = 0;
+  uint16_t headSector_ = 0;
+  uint16_t tailSector_ = 0;
+  uint32_t headOffset_ = 0;
+  uint32_t flushedOffset_ = 0;  // the buffer holds the head sector from here to headOffset_
+  int erasedSector_ = -1;       // erased by compact() and not yet started
+  uint8_t buffer_[BUFFER_LEN];
+  Stats stats_ = {};
+  uint32_t nextSeq_ = 0;
+  uint32_t firstSeq_ = 0;
+  uint32_t clearedSeq_ = 0;
+};
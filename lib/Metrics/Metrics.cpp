@@ -0,0 +1,63 @@
+#include "Metrics.h"
+
+#include <stdio.h>
+
+Counter *Counter::first_ = nullptr;
+Histogram *Histogram::first_ = nullptr;
+
+// Appends in registration order, so the dump follows the declarations
+template <typename T> static void append(T *&first, T *metric, T *T::*next) {
+  T **tail = &first;
+  while (*tail) tail = &((*tail)->*next);
+  *tail = metric;
+}
+
+Counter::Counter(const char *name) : name_(name), next_(nullptr) {
+  append(first_, this, &Counter::next_);
+}
+
+size_t Counter::csv(char *out, size_t cap) const {
+  int len = snprintf(out, cap, "counter,%s,%lu", name_, (unsigned long)value_);
+  return len > 0 && (size_t)len < cap ? len : 0;
+}
+
+Histogram::Histogram(const char *name, const char *unit) : name_(name), unit_(unit), next_(nullptr) {
+  append(first_, this, &Histogram::next_);
+}
+
+void Histogram::reset() {
+  for (int b = 0; b < BUCKETS; b++) buckets_[b] = 0;
+  count_ = 0;
+  sum_ = 0;
+  max_ = 0;
+}
+
+uint32_t Histogram::percentile(uint32_t perMille) const {
+  uint32_t count = count_;
+  if (count == 0) return 0;
+  uint64_t rank = ((uint64_t)count * perMille + 999) / 1000;
+  if (rank == 0) rank = 1;
+  uint64_t seen = 0;
+  for (int b = 0; b < BUCKETS; b++) {
+    seen += buckets_[b];
+    if (seen >= rank) return bucketTop(b) < max_ ? bucketTop(b) : max_;
+  }
+  return max_;
+}
+
+int Histogram::registered() {
+  int n = 0;
+  for (const Histogram *h = first_; h; h = h->next_) n++;
+  return n;
+}
+
+size_t Histogram::csv(char *out, size_t cap) const {
+  int last = BUCKETS - 1;
+  while (last > 0 && buckets_[last] == 0) last--;
+  int len = snprintf(out, cap, "histogram,%s,%s,%lu,%llu,%lu", name_, unit_, (unsigned long)count_,
+                     (unsigned long long)sum_, (unsigned long)max_);
+  for (int b = 0; b <= last && len > 0 && (size_t)len < cap; b++) {
+    len += snprintf(out + len, cap - len, ",%lu", (unsigned long)buckets_[b]);
+  }
+  return len > 0 && (size_t)len < cap ? len : 0;
+}
@@ -0,0 +1,87 @@
+// Run-time counters and histograms, in static memory.
+//
+// A Histogram counts samples in power-of-two buckets: bucket 0 holds 0,
+// bucket n holds [2^(n-1), 2^n) and the last bucket everything above. A
+// sample costs a count-leading-zeros and a few adds, so durations can be
+// recorded on every loop. Counters and histograms add themselves to a list
+// when constructed, for the metrics screen and the CSV dump to walk.
+//
+// Each metric has a single writer. Another task reading it may see a sample
+// half recorded (e.g. counted but not yet in the sum), which is fine for
+// statistics but means the figures are not a consistent snapshot.
+//
+// CSV, one metric per line, buckets from 0 up to the last non-empty one:
+//
+//   counter,<name>,<value>
+//   histogram,<name>,<unit>,<count>,<sum>,<max>,<bucket 0>,<bucket 1>,...
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+class Counter {
+public:
+  explicit Counter(const char *name);
+
+  void add(uint32_t n = 1) { value_ += n; }
+  uint32_t value() const { return value_; }
+  void reset() { value_ = 0; }
+
+  const char *name() const { return name_; }
+  Counter *next() const { return next_; }
+  static Counter *first() { return first_; }
+
+  // Returns the length written, or 0 if the line does not fit in cap
+  size_t csv(char *out, size_t cap) const;
+
+private:
+  static Counter *first_;
+  const char *name_;
+  Counter *next_;
+  uint32_t value_ = 0;
+};
+
+class Histogram {
+public:
+  static const int BUCKETS = 24;
+
+  Histogram(const char *name, const char *unit);
+
+  void record(uint32_t value) {
+    int b = value ? 32 - __builtin_clz(value) : 0;
+    buckets_[b < BUCKETS ? b : BUCKETS - 1]++;
+    count_++;
+    sum_ += value;
+    if (value > max_) max_ = value;
+  }
+  void reset();
+
+  uint32_t count() const { return count_; }
+  uint64_t sum() const { return sum_; }
+  uint32_t max() const { return max_; }
+  uint32_t bucket(int b) const { return buckets_[b]; }
+  uint32_t mean() const { return count_ ? (uint32_t)(sum_ / count_) : 0; }
+  // Upper bound on the given quantile (per mille): the top of the bucket
+  // it falls in, or the maximum if that is lower
+  uint32_t percentile(uint32_t perMille) const;
+  // Largest value in bucket b
+  static uint32_t bucketTop(int b) { return b == 0 ? 0 : b < BUCKETS - 1 ? (1u << b) - 1 : UINT32_MAX; }
+
+  const char *name() const { return name_; }
+  const char *unit() const { return unit_; }
+  Histogram *next() const { return next_; }
+  static Histogram *first() { return first_; }
+  static int registered();
+
+  size_t csv(char *out, size_t cap) const;
+
+private:
+  static Histogram *first_;
+  const char *name_;
+  const char *unit_;
+  Histogram *next_;
+  uint32_t count_ = 0;
+  uint64_t sum_ = 0;
+  uint32_t max_ = 0;
+  uint32_t buckets_[BUCKETS] = {};
+};
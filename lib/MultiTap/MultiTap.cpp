@@ -0,0 +1,33 @@
+#include "MultiTap.h"
+
+#include <string.h>
+
+const char *MultiTap::letters(char key) {
+  static const char *const groups[] = {" 0", "1", "ABC2", "DEF3", "GHI4", "JKL5", "MNO6", "PQRS7", "TUV8", "WXYZ9"};
+  return key >= '0' && key <= '9' ? groups[key - '0'] : nullptr;
+}
+
+char MultiTap::press(char key, unsigned long nowMs) {
+  if (!letters(key)) return 0;
+  char committed = tick(nowMs);
+  if (key_ == key) {
+    index_ = (index_ + 1) % (int)strlen(letters(key));
+  } else {
+    if (key_) committed = commit();
+    key_ = key;
+    index_ = 0;
+  }
+  lastMs_ = nowMs;
+  return committed;
+}
+
+char MultiTap::tick(unsigned long nowMs) {
+  if (key_ && nowMs - lastMs_ >= timeoutMs_) return commit();
+  return 0;
+}
+
+char MultiTap::commit() {
+  char c = pending();
+  key_ = 0;
+  return c;
+}
@@ -0,0 +1,29 @@
+// Multi-tap letter entry: each press of a digit key steps through its
+// letters ('2' is A, B, C, then 2), and the letter is committed by
+// pressing a different key or by waiting timeoutMs.
+#pragma once
+
+class MultiTap {
+public:
+  explicit MultiTap(unsigned long timeoutMs) : timeoutMs_(timeoutMs) {}
+
+  // Handles a digit key. Returns the letter this press committed (the one
+  // pending from a different key), or 0.
+  char press(char key, unsigned long nowMs);
+  // Commits the pending letter once it has timed out; returns it, or 0
+  char tick(unsigned long nowMs);
+  // Commits the pending letter now
+  char commit();
+  void cancel() { key_ = 0; }
+
+  char pending() const { return key_ ? letters(key_)[index_] : 0; }
+
+  // "ABC2" for '2' and so on, "1" for '1', " 0" for '0'
+  static const char *letters(char key);
+
+private:
+  unsigned long timeoutMs_;
+  char key_ = 0;
+  int index_ = 0;
+  unsigned long lastMs_ = 0;
+};
@@ -0,0 +1,226 @@
+#include "ReliableLink.h"
+
+#include <string.h>
+
+static void put32(uint8_t *p, uint32_t v) {
+  p[0] = v & 0xFF;
+  p[1] = v >> 8 & 0xFF;
+  p[2] = v >> 16 & 0xFF;
+  p[3] = v >> 24;
+}
+
+static uint32_t get32(const uint8_t *p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+
+ReliableLink::ReliableLink(TransmitFn transmit, StatusFn status, void *ctx)
+  : transmit_(transmit), status_(status), ctx_(ctx) {
+  memset(pending_, 0, sizeof(pending_));
+  memset(peers_, 0, sizeof(peers_));
+}
+
+void ReliableLink::begin(uint16_t nodeId, uint16_t firstSeq) {
+  nodeId_ = nodeId;
+  nextSeq_ = firstSeq;
+  nextAckSeq_ = firstSeq;
+}
+
+bool ReliableLink::transmit(const uint8_t *frame, size_t len, int slot) {
+  if (!transmit_(ctx_, frame, len)) return false;
+  pushLinkSlot(slot);
+  return true;
+}
+
+void ReliableLink::noteOtherTransmit() { pushLinkSlot(-1); }
+
+void ReliableLink::pushLinkSlot(int slot) {
+  if (linkCount_ == LINK_FIFO) {
+    linkHead_ = (linkHead_ + 1) % LINK_FIFO;
+    linkCount_--;
+  }
+  linkFifo_[(linkHead_ + linkCount_) % LINK_FIFO] = slot;
+  linkCount_++;
+}
+
+bool ReliableLink::canSend() const {
+  if (inFlight_ >= WINDOW) return false;
+  for (int slot = 0; slot < WINDOW; slot++) {
+    const Pending &p = pending_[slot];
+    if (p.used && p.awaitAck && (uint16_t)(nextSeq_ - p.seq) >= DEDUP_WINDOW) return false;
+  }
+  return true;
+}
+
+bool ReliableLink::send(uint16_t dest, uint8_t type, const uint8_t *payload, size_t len, uint32_t tag,
+                        unsigned long nowMs, uint8_t flags) {
+  if (!canSend() || len > FRAME_MAX_PAYLOAD) return false;
+
+  int slot = 0;
+  while (pending_[slot].used) slot++;
+  Pending &p = pending_[slot];
+
+  p.awaitAck = dest != FRAME_BROADCAST;
+  if (p.awaitAck) flags |= FRAME_FLAG_ACK_REQ;
+
+  memcpy(framePayload(p.frame), payload, len);
+  FrameHeader header = {type, nodeId_, dest, nextSeq_, flags, FRAME_DEFAULT_TTL, 0};
+  uint32_t epoch = 0;
+  if (seal_) {
+    len = seal_(sealCtx_, header, framePayload(p.frame), len, FRAME_MAX_PAYLOAD, &epoch);
+    if (len == 0) return false;
+  }
+  p.len = frameEncode(p.frame, sizeof(p.frame), header, len);
+  p.flags = header.flags;
+  p.seq = nextSeq_++;
+  p.epoch = epoch;
+  p.tag = tag;
+  p.attempts = 1;
+  p.rtoMs = INITIAL_RTO_MS;
+  p.firstSentMs = nowMs;
+  p.nextTxMs = p.awaitAck ? nowMs + p.rtoMs : nowMs;
+  p.used = true;
+  inFlight_++;
+  stats_.sent++;
+
+  transmit(p.frame, p.len, slot);
+  return true;
+}
+
+void ReliableLink::finish(int slot, bool delivered, unsigned long nowMs) {
+  Pending &p = pending_[slot];
+  p.used = false;
+  inFlight_--;
+  if (delivered) {
+    stats_.delivered++;
+    stats_.lastRttMs = nowMs - p.firstSentMs;
+  } else {
+    stats_.failed++;
+  }
+  if (status_) status_(ctx_, p.tag, delivered);
+}
+
+// A failed MAC-level send will not be ACKed, so retry without waiting out the RTO
+void ReliableLink::onLinkStatus(bool success, unsigned long nowMs) {
+  if (linkCount_ == 0) return;
+  int slot = linkFifo_[linkHead_];
+  linkHead_ = (linkHead_ + 1) % LINK_FIFO;
+  linkCount_--;
+  if (!success && slot >= 0 && pending_[slot].used) pending_[slot].nextTxMs = nowMs;
+}
+
+void ReliableLink::tick(unsigned long nowMs) {
+  for (int slot = 0; slot < WINDOW; slot++) {
+    Pending &p = pending_[slot];
+    if (!p.used || (long)(nowMs - p.nextTxMs) < 0) continue;
+
+    if (!p.awaitAck) {
+      finish(slot, true, nowMs);
+      continue;
+    }
+    if (p.attempts >= MAX_ATTEMPTS) {
+      finish(slot, false, nowMs);
+      continue;
+    }
+    p.attempts++;
+    p.rtoMs = p.rtoMs * 2 > MAX_RTO_MS ? MAX_RTO_MS : p.rtoMs * 2;
+    p.nextTxMs = nowMs + p.rtoMs;
+    stats_.retransmits++;
+
+    // Relays remember frames they have forwarded; the attempt number makes a
+    // retransmission distinct so it is forwarded again
+    uint8_t attempt = (p.attempts - 1) << FRAME_FLAG_ATTEMPT_SHIFT & FRAME_FLAG_ATTEMPT_MASK;
+    frameSetFlags(p.frame, p.len, p.flags | attempt);
+    transmit(p.frame, p.len, slot);
+  }
+}
+
+// ACKs are numbered from their own counter: sealing one never reuses a
+// nonce, and ACKing does not move our own frames back in the peer's window.
+// The ACK carries the attempt number of the frame it answers, so Mesh floods
+// the ACK of a retransmission as it did the frame.
+void ReliableLink::sendAck(uint16_t dest, uint16_t seq, uint32_t epoch, uint8_t attempt) {
+  uint8_t frame[FRAME_OVERHEAD + ACK_LEN + FRAME_SEAL_OVERHEAD];
+  uint8_t *payload = framePayload(frame);
+  payload[0] = seq & 0xFF;
+  payload[1] = seq >> 8;
+  put32(payload + 2, epoch);
+  FrameHeader header = {FRAME_ACK, nodeId_, dest, nextAckSeq_++, attempt, FRAME_DEFAULT_TTL, 0};
+  size_t len = ACK_LEN;
+  if (seal_) {
+    uint32_t sealedEpoch;
+    len = seal_(sealCtx_, header, payload, len, ACK_LEN + FRAME_SEAL_OVERHEAD, &sealedEpoch);
+    if (len == 0) return;
+  }
+  len = frameEncode(frame, sizeof(frame), header, len);
+  if (transmit(frame, len, -1)) stats_.acksSent++;
+}
+
+ReliableLink::SeqCheck ReliableLink::checkSeq(uint16_t sender, uint32_t epoch, uint16_t seq,
+                                               unsigned long nowMs) {
+  Peer *peer = nullptr;
+  Peer *oldest = &peers_[0];
+  for (int i = 0; i < DEDUP_PEERS; i++) {
+    if (peers_[i].used && peers_[i].sender == sender) {
+      peer = &peers_[i];
+      break;
+    }
+    if (!peers_[i].used || (oldest->used && peers_[i].lastUse < oldest->lastUse)) oldest = &peers_[i];
+  }
+
+  if (!peer || epoch > peer->epoch) {
+    if (!peer) peer = oldest;
+    peer->used = true;
+    peer->sender = sender;
+    peer->epoch = epoch;
+    peer->highest = seq;
+    peer->seen = 1;
+    peer->lastUse = nowMs;
+    return SEQ_NEW;
+  }
+  peer->lastUse = nowMs;
+  if (epoch < peer->epoch) return SEQ_STALE;
+
+  int16_t diff = (int16_t)(seq - peer->highest);
+  if (diff > 0) {
+    peer->seen = diff >= DEDUP_WINDOW ? 1 : (peer->seen << diff) | 1;
+    peer->highest = seq;
+    return SEQ_NEW;
+  }
+  if (diff <= -DEDUP_WINDOW) return SEQ_STALE;
+  uint64_t bit = 1ull << -diff;
+  if (peer->seen & bit) return SEQ_REPEAT;
+  peer->seen |= bit;
+  return SEQ_NEW;
+}
+
+bool ReliableLink::receive(const FrameView &frame, unsigned long nowMs, uint32_t epoch) {
+  if (frame.header.type == FRAME_ACK) {
+    if (frame.payloadLen != ACK_LEN) {
+      stats_.unmatchedAcks++;
+      return false;
+    }
+    uint16_t seq = frame.payload[0] | frame.payload[1] << 8;
+    uint32_t ackedEpoch = get32(frame.payload + 2);
+    for (int slot = 0; slot < WINDOW; slot++) {
+      const Pending &p = pending_[slot];
+      if (p.used && p.awaitAck && p.seq == seq && p.epoch == ackedEpoch && frameDest(p.frame) == frame.header.sender) {
+        finish(slot, true, nowMs);
+        return false;
+      }
+    }
+    stats_.unmatchedAcks++;
+    return false;
+  }
+
+  SeqCheck check = checkSeq(frame.header.sender, epoch, frame.header.seq, nowMs);
+  if (check == SEQ_STALE) {
+    stats_.stale++;
+    return false;
+  }
+  if (frame.header.flags & FRAME_FLAG_ACK_REQ) {
+    sendAck(frame.header.sender, frame.header.seq, epoch, frame.header.flags & FRAME_FLAG_ATTEMPT_MASK);
+  }
+  if (check == SEQ_REPEAT) {
+    stats_.duplicates++;
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,150 @@
+// Acknowledged delivery on top of Frame.
+//
+// Frames sent with send() carry FRAME_FLAG_ACK_REQ and stay in a bounded
+// in-flight window until the receiver answers with a FRAME_ACK naming the
+// sequence number and epoch of the frame, so several frames can be
+// outstanding at once. An ACK counts only from the frame's destination.
+// Frames that are not acknowledged are retransmitted with exponential
+// backoff and reported as failed after MAX_ATTEMPTS. ACKs are sealed like
+// any other frame but numbered from a counter of their own, so each has a
+// fresh nonce.
+//
+// On the receiving side a per-sender sliding window drops repeated frames,
+// broadcasts included (retransmissions are still ACKed, since it was the
+// ACK that got lost). The window is kept per sender and epoch, the counter
+// FrameCipher moves on every boot and authenticates: a frame from a newer
+// epoch starts a fresh window, so a sender that rebooted is accepted
+// whatever sequence number it started from, while frames from an older
+// epoch or from behind the window of the current one are refused without an
+// ACK, so their sender reports them failed instead of delivered (canSend()
+// keeps a sender's own retransmissions inside the window). Unsealed links
+// pass epoch 0 throughout and get no such help after a reboot.
+//
+// The last DEDUP_PEERS senders heard are remembered. One pushed out by
+// others starts a fresh window when it is heard again, so a frame it sent
+// earlier in its current epoch could be played back once at that moment;
+// keep DEDUP_PEERS above the number of nodes in the network.
+//
+// Frames to FRAME_BROADCAST cannot be ACKed by everyone; they are sent once
+// and reported as delivered.
+#pragma once
+
+#include <Frame.h>
+#include <stddef.h>
+#include <stdint.h>
+
+class ReliableLink {
+public:
+  static const int WINDOW = 8;
+  static const int MAX_ATTEMPTS = 6;
+  static const unsigned long INITIAL_RTO_MS = 40;
+  static const unsigned long MAX_RTO_MS = 1000;
+  static const int DEDUP_PEERS = 64;
+  static const int DEDUP_WINDOW = 64;
+  static const size_t ACK_LEN = 6;  // payload: sequence number and epoch acknowledged
+
+  typedef bool (*TransmitFn)(void *ctx, const uint8_t *frame, size_t len);
+  typedef void (*StatusFn)(void *ctx, uint32_t tag, bool delivered);
+  // Rewrites a payload in place before it is framed (e.g. encrypts it) and
+  // returns its new length, or 0 to refuse the send. *epoch is the epoch the
+  // frame was sealed in, which its ACK must name.
+  typedef size_t (*SealFn)(void *ctx, FrameHeader &header, uint8_t *payload, size_t len, size_t cap,
+                           uint32_t *epoch);
+
+  struct Stats {
+    uint32_t sent;
+    uint32_t retransmits;
+    uint32_t delivered;
+    uint32_t failed;
+    uint32_t duplicates;
+    uint32_t stale;          // behind the window or from an older epoch, refused unACKed
+    uint32_t unmatchedAcks;  // naming no frame in flight to their sender, late ones included
+    uint32_t acksSent;
+    uint32_t lastRttMs;
+  };
+
+  ReliableLink(TransmitFn transmit, StatusFn status, void *ctx = nullptr);
+
+  void begin(uint16_t nodeId, uint16_t firstSeq);
+  void setSealer(SealFn seal, void *ctx) {
+    seal_ = seal;
+    sealCtx_ = ctx;
+  }
+
+  // Sender side. tag is handed back to the status callback.
+  // False while the window is full, or while the oldest frame awaiting an
+  // ACK is DEDUP_WINDOW sequence numbers behind the next one, so that every
+  // retransmission still lands inside the receiver's window
+  bool canSend() const;
+  int inFlight() const { return inFlight_; }
+  bool send(uint16_t dest, uint8_t type, const uint8_t *payload, size_t len, uint32_t tag, unsigned long nowMs,
+            uint8_t flags = 0);
+  // Result of each transmission in order, from the ESP-NOW send callback.
+  // Frames sent around the link (e.g. relayed ones) must be noted so the
+  // results stay in step.
+  void onLinkStatus(bool success, unsigned long nowMs);
+  void noteOtherTransmit();
+  void tick(unsigned long nowMs);
+
+  // Receiver side. Handles ACKs and duplicate suppression; returns true when
+  // the frame is new and should be processed by the caller. epoch is the
+  // sender's, from FrameCipher::open(), and frame the opened plaintext.
+  bool receive(const FrameView &frame, unsigned long nowMs, uint32_t epoch = 0);
+
+  uint16_t nodeId() const { return nodeId_; }
+  const Stats &stats() const { return stats_; }
+
+private:
+  struct Pending {
+    bool used;
+    bool awaitAck;
+    uint8_t flags;
+    uint16_t seq;
+    uint8_t attempts;
+    uint8_t len;
+    uint32_t epoch;  // sealed in
+    uint32_t tag;
+    unsigned long firstSentMs;
+    unsigned long nextTxMs;
+    unsigned long rtoMs;
+    uint8_t frame[FRAME_MAX_LEN];
+  };
+
+  enum SeqCheck : uint8_t { SEQ_NEW, SEQ_REPEAT, SEQ_STALE };
+
+  struct Peer {
+    bool used;
+    uint16_t sender;
+    uint32_t epoch;
+    uint16_t highest;
+    uint64_t seen;  // bit n set: highest - n already received
+    unsigned long lastUse;
+  };
+
+  bool transmit(const uint8_t *frame, size_t len, int slot);
+  void finish(int slot, bool delivered, unsigned long nowMs);
+  void sendAck(uint16_t dest, uint16_t seq, uint32_t epoch, uint8_t attempt);
+  void pushLinkSlot(int slot);
+  SeqCheck checkSeq(uint16_t sender, uint32_t epoch, uint16_t seq, unsigned long nowMs);
+
+  TransmitFn transmit_;
+  StatusFn status_;
+  void *ctx_;
+  SealFn seal_ = nullptr;
+  void *sealCtx_ = nullptr;
+  uint16_t nodeId_ = 0;
+  uint16_t nextSeq_ = 0;
+  uint16_t nextAckSeq_ = 0;
+
+  Pending pending_[WINDOW];
+  int inFlight_ = 0;
+
+  // Slot of each transmission still waiting for its link status (-1 for ACKs)
+  static const int LINK_FIFO = 16;
+  int8_t linkFifo_[LINK_FIFO];
+  uint8_t linkHead_ = 0;
+  uint8_t linkCount_ = 0;
+
+  Peer peers_[DEDUP_PEERS];
+  Stats stats_ = {};
+};
@@ -0,0 +1,69 @@
+// Fixed-capacity lock-free single-producer/single-consumer ring.
+//
+// Slots are preallocated; the producer fills one in place between
+// beginPush() and commitPush(), the consumer reads it between peek() and
+// pop(). Capacity must be a power of two.
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+template <typename T, size_t Capacity>
+class SpscQueue {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+  // Producer side. Returns nullptr and counts an overflow when full.
+  T *beginPush() {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    uint32_t tail = tail_.load(std::memory_order_acquire);
+    if (head - tail >= Capacity) {
+      overflows_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    return &slots_[head & (Capacity - 1)];
+  }
+
+  void commitPush() {
+    uint32_t head = head_.load(std::memory_order_relaxed) + 1;
+    head_.store(head, std::memory_order_release);
+    uint32_t depth = head - tail_.load(std::memory_order_relaxed);
+    if (depth > highWater_.load(std::memory_order_relaxed)) highWater_.store(depth, std::memory_order_relaxed);
+  }
+
+  bool push(const T &item) {
+    T *slot = beginPush();
+    if (!slot) return false;
+    *slot = item;
+    commitPush();
+    return true;
+  }
+
+  // Consumer side. Returns nullptr when empty.
+  T *peek() {
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (head_.load(std::memory_order_acquire) == tail) return nullptr;
+    return &slots_[tail & (Capacity - 1)];
+  }
+
+  void pop() {
+    tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  size_t size() const {
+    return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+  }
+  bool empty() const { return size() == 0; }
+  static size_t capacity() { return Capacity; }
+
+  uint32_t overflows() const { return overflows_.load(std::memory_order_relaxed); }
+  uint32_t highWater() const { return highWater_.load(std::memory_order_relaxed); }
+
+private:
+  T slots_[Capacity];
+  std::atomic<uint32_t> head_{0};
+  std::atomic<uint32_t> tail_{0};
+  std::atomic<uint32_t> overflows_{0};
+  std::atomic<uint32_t> highWater_{0};
+};
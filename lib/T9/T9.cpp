@@ -0,0 +1,96 @@
+#include "T9.h"
+
+static const size_t HEADER_LEN = 8;
+
+static uint16_t get16(const uint8_t *p) { return p[0] | p[1] << 8; }
+static uint32_t get24(const uint8_t *p) { return p[0] | p[1] << 8 | (uint32_t)p[2] << 16; }
+
+T9Dictionary::T9Dictionary(const uint8_t *data, size_t len) : data_(data), len_(len) {
+  valid_ = len > HEADER_LEN + 3 && data[0] == 'T' && data[1] == '9' && data[2] == 'D' && data[3] == 1;
+}
+
+uint16_t T9Dictionary::words() const { return valid_ ? get16(data_ + 4) : 0; }
+
+char T9Dictionary::keyFor(char letter) {
+  static const char keys[] = "22233344455566677778889999";
+  return letter >= 'A' && letter <= 'Z' ? keys[letter - 'A'] : 0;
+}
+
+// Whole words before stems, then by rank
+static bool before(const T9Dictionary::Candidate &a, const T9Dictionary::Candidate &b) {
+  if (a.word != b.word) return a.word;
+  return a.rank < b.rank;
+}
+
+void T9Dictionary::walk(uint32_t offset, const char *keys, int len, int depth, char *path, Candidate *out, int max,
+                        int &count) const {
+  if (offset + 3 > len_) return;
+  const uint8_t *node = data_ + offset;
+  bool terminal = node[0] & 0x80;
+  int children = node[0] & 0x1F;
+
+  if (depth == len) {
+    Candidate c;
+    for (int i = 0; i < len; i++) c.text[i] = path[i];
+    c.text[len] = '\0';
+    c.word = terminal;
+    c.rank = terminal ? get16(node + 3) : get16(node + 1);
+
+    // Insert in order, dropping the last if full
+    int at = count;
+    while (at > 0 && before(c, out[at - 1])) at--;
+    if (at >= max) return;
+    int end = count < max ? count++ : max - 1;
+    for (int i = end; i > at; i--) out[i] = out[i - 1];
+    out[at] = c;
+    return;
+  }
+
+  const uint8_t *child = node + 3 + (terminal ? 2 : 0);
+  if (child + children * 4 > data_ + len_) return;
+  for (int i = 0; i < children; i++, child += 4) {
+    if (keyFor((char)child[0]) != keys[depth]) continue;
+    path[depth] = (char)child[0];
+    walk(get24(child + 1), keys, len, depth + 1, path, out, max, count);
+  }
+}
+
+int T9Dictionary::lookup(const char *keys, int len, Candidate *out, int max) const {
+  if (!valid_ || len <= 0 || len > MAX_WORD || max <= 0) return 0;
+  char path[MAX_WORD];
+  int count = 0;
+  walk(HEADER_LEN, keys, len, 0, path, out, max, count);
+  return count;
+}
+
+void T9Input::update() {
+  count_ = dict_.lookup(keys_, len_, candidates_, MAX_CANDIDATES);
+  choice_ = 0;
+}
+
+bool T9Input::press(char key) {
+  if (len_ == T9Dictionary::MAX_WORD || key < '2' || key > '9') return false;
+  keys_[len_++] = key;
+  update();
+  if (count_ > 0) return true;
+  len_--;
+  update();
+  return false;
+}
+
+bool T9Input::back() {
+  if (len_ == 0) return false;
+  len_--;
+  update();
+  return true;
+}
+
+void T9Input::next() {
+  if (count_ > 0) choice_ = (choice_ + 1) % count_;
+}
+
+void T9Input::clear() {
+  len_ = 0;
+  count_ = 0;
+  choice_ = 0;
+}
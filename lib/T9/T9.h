@@ -0,0 +1,88 @@
+// T9 predictive text over a letter trie kept in flash.
+//
+// The dictionary is a const array (t9Words, generated by tools/mkdict.py),
+// so on the ESP32-S3 it stays in flash and is read through the cache's
+// memory mapping; nothing is copied to RAM. Layout, little-endian:
+//
+//   header  "T9D" 0x01, u16 word count, u16 reserved
+//   node    u8  terminal flag (0x80) | child count
+//           u16 rank of the most common word at or below this node
+//           u16 rank of this word, only if terminal
+//           child count x { u8 letter, u24 offset of the child }
+//
+// Ranks are positions in the word list, 0 being the most common. The root
+// node follows the header. A lookup walks only the letters on the pressed
+// keys, and the stored best rank orders stems without visiting the words
+// below them.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+extern const uint8_t t9Words[];
+extern const size_t t9WordsLen;
+
+class T9Dictionary {
+public:
+  static const int MAX_WORD = 16;
+
+  struct Candidate {
+    char text[MAX_WORD + 1];
+    uint16_t rank;
+    bool word;  // a whole word, otherwise the start of longer ones
+  };
+
+  T9Dictionary(const uint8_t *data, size_t len);
+
+  bool valid() const { return valid_; }
+  uint16_t words() const;
+
+  // Fills out with up to max matches for keys ('2'..'9'): whole words
+  // first, then stems of longer words, each most common first. Returns
+  // how many were found.
+  int lookup(const char *keys, int len, Candidate *out, int max) const;
+
+  // '2'..'9' for A-Z, 0 otherwise
+  static char keyFor(char letter);
+
+private:
+  void walk(uint32_t offset, const char *keys, int len, int depth, char *path, Candidate *out, int max,
+            int &count) const;
+
+  const uint8_t *data_;
+  size_t len_;
+  bool valid_;
+};
+
+// The word being typed in T9 mode: the keys pressed so far and the
+// dictionary's matches for them, one of which is shown.
+class T9Input {
+public:
+  static const int MAX_CANDIDATES = 8;
+
+  explicit T9Input(const T9Dictionary &dict) : dict_(dict) {}
+
+  // Adds a key '2'..'9'. Returns false, leaving the word as it was, if
+  // nothing in the dictionary matches.
+  bool press(char key);
+  // Removes the last key; false if there was none
+  bool back();
+  // Shows the next match
+  void next();
+  void clear();
+
+  bool empty() const { return len_ == 0; }
+  const char *text() const { return count_ ? candidates_[choice_].text : ""; }
+  int choice() const { return choice_; }
+  int choices() const { return count_; }
+
+private:
+  void update();
+
+  const T9Dictionary &dict_;
+  char keys_[T9Dictionary::MAX_WORD];
+  int len_ = 0;
+  T9Dictionary::Candidate candidates_[MAX_CANDIDATES];
+  int count_ = 0;
+  int choice_ = 0;
+};
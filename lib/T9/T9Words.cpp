@@ -0,0 +1,778 @@
+// Generated by tools/mkdict.py from t9words.txt: 600 words, 1590 nodes, 12334 bytes.
+// Do not edit.
+#include "T9.h"
+
+const uint8_t t9Words[] = {
+  0x54, 0x39, 0x44, 0x01, 0x58, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0x41, 0x6b, 0x00, 0x00, 0x42,
+  0xea, 0x03, 0x00, 0x43, 0x1f, 0x07, 0x00, 0x44, 0x5a, 0x0a, 0x00, 0x45, 0x32, 0x0c, 0x00, 0x46,
+  0xff, 0x0d, 0x00, 0x47, 0x0a, 0x10, 0x00, 0x48, 0x71, 0x11, 0x00, 0x49, 0xbe, 0x13, 0x00, 0x4a,
+  0xec, 0x14, 0x00, 0x4b, 0x16, 0x15, 0x00, 0x4c, 0x8e, 0x15, 0x00, 0x4d, 0x9d, 0x17, 0x00, 0x4e,
+  0x04, 0x1a, 0x00, 0x4f, 0xb7, 0x1b, 0x00, 0x50, 0xfa, 0x1c, 0x00, 0x51, 0x8d, 0x1f, 0x00, 0x52,
+  0xda, 0x1f, 0x00, 0x53, 0x96, 0x22, 0x00, 0x54, 0xf6, 0x27, 0x00, 0x55, 0xce, 0x2b, 0x00, 0x56,
+  0x4f, 0x2c, 0x00, 0x57, 0x69, 0x2c, 0x00, 0x59, 0x86, 0x2f, 0x00, 0x8e, 0x04, 0x00, 0x05, 0x00,
+  0x42, 0xa8, 0x00, 0x00, 0x43, 0xd2, 0x00, 0x00, 0x44, 0xfc, 0x00, 0x00, 0x46, 0x26, 0x01, 0x00,
+  0x47, 0x81, 0x01, 0x00, 0x49, 0xab, 0x01, 0x00, 0x4c, 0xb7, 0x01, 0x00, 0x4d, 0x5b, 0x02, 0x00,
+  0x4e, 0x60, 0x02, 0x00, 0x50, 0x1b, 0x03, 0x00, 0x52, 0x3c, 0x03, 0x00, 0x53, 0x9d, 0x03, 0x00,
+  0x54, 0xd2, 0x03, 0x00, 0x57, 0xd7, 0x03, 0x00, 0x02, 0x2c, 0x00, 0x4c, 0xb3, 0x00, 0x00, 0x4f,
+  0xbf, 0x00, 0x00, 0x01, 0x52, 0x01, 0x45, 0xba, 0x00, 0x00, 0x80, 0x52, 0x01, 0x52, 0x01, 0x01,
+  0x2c, 0x00, 0x55, 0xc6, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x54, 0xcd, 0x00, 0x00, 0x80, 0x2c, 0x00,
+  0x2c, 0x00, 0x02, 0x8e, 0x01, 0x4b, 0xdd, 0x00, 0x00, 0x52, 0xe2, 0x00, 0x00, 0x80, 0xba, 0x01,
+  0xba, 0x01, 0x01, 0x8e, 0x01, 0x4f, 0xe9, 0x00, 0x00, 0x01, 0x8e, 0x01, 0x53, 0xf0, 0x00, 0x00,
+  0x01, 0x8e, 0x01, 0x53, 0xf7, 0x00, 0x00, 0x80, 0x8e, 0x01, 0x8e, 0x01, 0x01, 0xc9, 0x00, 0x44,
+  0x03, 0x01, 0x00, 0x81, 0xc9, 0x00, 0xc9, 0x00, 0x52, 0x0c, 0x01, 0x00, 0x01, 0x33, 0x02, 0x45,
+  0x13, 0x01, 0x00, 0x01, 0x33, 0x02, 0x53, 0x1a, 0x01, 0x00, 0x01, 0x33, 0x02, 0x53, 0x21, 0x01,
+  0x00, 0x80, 0x33, 0x02, 0x33, 0x02, 0x02, 0x51, 0x00, 0x46, 0x31, 0x01, 0x00, 0x54, 0x6e, 0x01,
+  0x00, 0x01, 0xe3, 0x01, 0x49, 0x38, 0x01, 0x00, 0x01, 0xe3, 0x01, 0x52, 0x3f, 0x01, 0x00, 0x01,
+  0xe3, 0x01, 0x4d, 0x46, 0x01, 0x00, 0x01, 0xe3, 0x01, 0x41, 0x4d, 0x01, 0x00, 0x01, 0xe3, 0x01,
+  0x54, 0x54, 0x01, 0x00, 0x01, 0xe3, 0x01, 0x49, 0x5b, 0x01, 0x00, 0x01, 0xe3, 0x01, 0x56, 0x62,
+  0x01, 0x00, 0x01, 0xe3, 0x01, 0x45, 0x69, 0x01, 0x00, 0x80, 0xe3, 0x01, 0xe3, 0x01, 0x01, 0x51,
+  0x00, 0x45, 0x75, 0x01, 0x00, 0x01, 0x51, 0x00, 0x52, 0x7c, 0x01, 0x00, 0x80, 0x51, 0x00, 0x51,
+  0x00, 0x01, 0x76, 0x01, 0x41, 0x88, 0x01, 0x00, 0x01, 0x76, 0x01, 0x49, 0x8f, 0x01, 0x00, 0x01,
+  0x76, 0x01, 0x4e, 0x96, 0x01, 0x00, 0x81, 0x76, 0x01, 0x76, 0x01, 0x53, 0x9f, 0x01, 0x00, 0x01,
+  0x92, 0x01, 0x54, 0xa6, 0x01, 0x00, 0x80, 0x92, 0x01, 0x92, 0x01, 0x01, 0x36, 0x01, 0x52, 0xb2,
+  0x01, 0x00, 0x80, 0x36, 0x01, 0x36, 0x01, 0x06, 0x23, 0x00, 0x4c, 0xd2, 0x01, 0x00, 0x4d, 0xe7,
+  0x01, 0x00, 0x4f, 0x01, 0x02, 0x00, 0x52, 0x14, 0x02, 0x00, 0x53, 0x35, 0x02, 0x00, 0x57, 0x41,
+  0x02, 0x00, 0x81, 0x23, 0x00, 0x23, 0x00, 0x4f, 0xdb, 0x01, 0x00, 0x01, 0xc8, 0x00, 0x57, 0xe2,
+  0x01, 0x00, 0x80, 0xc8, 0x00, 0xc8, 0x00, 0x01, 0x7a, 0x01, 0x4f, 0xee, 0x01, 0x00, 0x01, 0x7a,
+  0x01, 0x53, 0xf5, 0x01, 0x00, 0x01, 0x7a, 0x01, 0x54, 0xfc, 0x01, 0x00, 0x80, 0x7a, 0x01, 0x7a,
+  0x01, 0x01, 0x8d, 0x01, 0x4e, 0x08, 0x02, 0x00, 0x01, 0x8d, 0x01, 0x47, 0x0f, 0x02, 0x00, 0x80,
+  0x8d, 0x01, 0x8d, 0x01, 0x01, 0x78, 0x01, 0x45, 0x1b, 0x02, 0x00, 0x01, 0x78, 0x01, 0x41, 0x22,
+  0x02, 0x00, 0x01, 0x78, 0x01, 0x44, 0x29, 0x02, 0x00, 0x01, 0x78, 0x01, 0x59, 0x30, 0x02, 0x00,
+  0x80, 0x78, 0x01, 0x78, 0x01, 0x01, 0x4f, 0x00, 0x4f, 0x3c, 0x02, 0x00, 0x80, 0x4f, 0x00, 0x4f,
+  0x00, 0x01, 0x72, 0x01, 0x41, 0x48, 0x02, 0x00, 0x01, 0x72, 0x01, 0x59, 0x4f, 0x02, 0x00, 0x01,
+  0x72, 0x01, 0x53, 0x56, 0x02, 0x00, 0x80, 0x72, 0x01, 0x72, 0x01, 0x80, 0xfb, 0x01, 0xfb, 0x01,
+  0x84, 0x04, 0x00, 0x1f, 0x00, 0x44, 0x75, 0x02, 0x00, 0x4f, 0x7a, 0x02, 0x00, 0x53, 0x9b, 0x02,
+  0x00, 0x59, 0xb5, 0x02, 0x00, 0x80, 0x04, 0x00, 0x04, 0x00, 0x01, 0x04, 0x02, 0x54, 0x81, 0x02,
+  0x00, 0x01, 0x04, 0x02, 0x48, 0x88, 0x02, 0x00, 0x01, 0x04, 0x02, 0x45, 0x8f, 0x02, 0x00, 0x01,
+  0x04, 0x02, 0x52, 0x96, 0x02, 0x00, 0x80, 0x04, 0x02, 0x04, 0x02, 0x01, 0x37, 0x02, 0x57, 0xa2,
+  0x02, 0x00, 0x01, 0x37, 0x02, 0x45, 0xa9, 0x02, 0x00, 0x01, 0x37, 0x02, 0x52, 0xb0, 0x02, 0x00,
+  0x80, 0x37, 0x02, 0x37, 0x02, 0x83, 0x5e, 0x00, 0x5e, 0x00, 0x4f, 0xc6, 0x02, 0x00, 0x54, 0xd9,
+  0x02, 0x00, 0x57, 0xfa, 0x02, 0x00, 0x01, 0x0a, 0x02, 0x4e, 0xcd, 0x02, 0x00, 0x01, 0x0a, 0x02,
+  0x45, 0xd4, 0x02, 0x00, 0x80, 0x0a, 0x02, 0x0a, 0x02, 0x01, 0x07, 0x02, 0x48, 0xe0, 0x02, 0x00,
+  0x01, 0x07, 0x02, 0x49, 0xe7, 0x02, 0x00, 0x01, 0x07, 0x02, 0x4e, 0xee, 0x02, 0x00, 0x01, 0x07,
+  0x02, 0x47, 0xf5, 0x02, 0x00, 0x80, 0x07, 0x02, 0x07, 0x02, 0x01, 0x0e, 0x02, 0x48, 0x01, 0x03,
+  0x00, 0x01, 0x0e, 0x02, 0x45, 0x08, 0x03, 0x00, 0x01, 0x0e, 0x02, 0x52, 0x0f, 0x03, 0x00, 0x01,
+  0x0e, 0x02, 0x45, 0x16, 0x03, 0x00, 0x80, 0x0e, 0x02, 0x0e, 0x02, 0x01, 0xd3, 0x00, 0x50, 0x22,
+  0x03, 0x00, 0x01, 0xd3, 0x00, 0x45, 0x29, 0x03, 0x00, 0x01, 0xd3, 0x00, 0x41, 0x30, 0x03, 0x00,
+  0x01, 0xd3, 0x00, 0x52, 0x37, 0x03, 0x00, 0x80, 0xd3, 0x00, 0xd3, 0x00, 0x04, 0x66, 0x00, 0x45,
+  0x4f, 0x03, 0x00, 0x4f, 0x5d, 0x03, 0x00, 0x52, 0x77, 0x03, 0x00, 0x54, 0x98, 0x03, 0x00, 0x81,
+  0x66, 0x00, 0x66, 0x00, 0x41, 0x58, 0x03, 0x00, 0x80, 0xfc, 0x00, 0xfc, 0x00, 0x01, 0x91, 0x01,
+  0x55, 0x64, 0x03, 0x00, 0x01, 0x91, 0x01, 0x4e, 0x6b, 0x03, 0x00, 0x01, 0x91, 0x01, 0x44, 0x72,
+  0x03, 0x00, 0x80, 0x91, 0x01, 0x91, 0x01, 0x01, 0x92, 0x00, 0x49, 0x7e, 0x03, 0x00, 0x01, 0x92,
+  0x00, 0x56, 0x85, 0x03, 0x00, 0x01, 0x92, 0x00, 0x45, 0x8c, 0x03, 0x00, 0x01, 0x92, 0x00, 0x44,
+  0x93, 0x03, 0x00, 0x80, 0x92, 0x00, 0x92, 0x00, 0x80, 0x2b, 0x01, 0x2b, 0x01, 0x81, 0x10, 0x00,
+  0x10, 0x00, 0x4b, 0xa6, 0x03, 0x00, 0x82, 0xa2, 0x00, 0xa2, 0x00, 0x45, 0xb3, 0x03, 0x00, 0x49,
+  0xbf, 0x03, 0x00, 0x01, 0x18, 0x02, 0x44, 0xba, 0x03, 0x00, 0x80, 0x18, 0x02, 0x18, 0x02, 0x01,
+  0xf7, 0x01, 0x4e, 0xc6, 0x03, 0x00, 0x01, 0xf7, 0x01, 0x47, 0xcd, 0x03, 0x00, 0x80, 0xf7, 0x01,
+  0xf7, 0x01, 0x80, 0x13, 0x00, 0x13, 0x00, 0x01, 0x7c, 0x01, 0x41, 0xde, 0x03, 0x00, 0x01, 0x7c,
+  0x01, 0x59, 0xe5, 0x03, 0x00, 0x80, 0x7c, 0x01, 0x7c, 0x01, 0x08, 0x01, 0x00, 0x41, 0x0d, 0x04,
+  0x00, 0x45, 0x6e, 0x04, 0x00, 0x49, 0xa1, 0x05, 0x00, 0x4c, 0xbd, 0x05, 0x00, 0x4f, 0xe7, 0x05,
+  0x00, 0x52, 0x23, 0x06, 0x00, 0x55, 0xae, 0x06, 0x00, 0x59, 0x11, 0x07, 0x00, 0x05, 0x50, 0x00,
+  0x42, 0x24, 0x04, 0x00, 0x43, 0x30, 0x04, 0x00, 0x44, 0x3c, 0x04, 0x00, 0x53, 0x41, 0x04, 0x00,
+  0x54, 0x4d, 0x04, 0x00, 0x01, 0x42, 0x02, 0x59, 0x2b, 0x04, 0x00, 0x80, 0x42, 0x02, 0x42, 0x02,
+  0x01, 0x50, 0x00, 0x4b, 0x37, 0x04, 0x00, 0x80, 0x50, 0x00, 0x50, 0x00, 0x80, 0x50, 0x01, 0x50,
+  0x01, 0x01, 0xc2, 0x01, 0x45, 0x48, 0x04, 0x00, 0x80, 0xc2, 0x01, 0xc2, 0x01, 0x01, 0xb1, 0x01,
+  0x54, 0x54, 0x04, 0x00, 0x01, 0xb1, 0x01, 0x45, 0x5b, 0x04, 0x00, 0x01, 0xb1, 0x01, 0x52, 0x62,
+  0x04, 0x00, 0x01, 0xb1, 0x01, 0x59, 0x69, 0x04, 0x00, 0x80, 0xb1, 0x01, 0xb1, 0x01, 0x8a, 0x01,
+  0x00, 0x01, 0x00, 0x43, 0x9b, 0x04, 0x00, 0x45, 0xbc, 0x04, 0x00, 0x46, 0xc8, 0x04, 0x00, 0x47,
+  0xe2, 0x04, 0x00, 0x48, 0xf5, 0x04, 0x00, 0x49, 0x0f, 0x05, 0x00, 0x4c, 0x22, 0x05, 0x00, 0x53,
+  0x43, 0x05, 0x00, 0x54, 0x4f, 0x05, 0x00, 0x59, 0x87, 0x05, 0x00, 0x01, 0x5d, 0x00, 0x41, 0xa2,
+  0x04, 0x00, 0x01, 0x5d, 0x00, 0x55, 0xa9, 0x04, 0x00, 0x01, 0x5d, 0x00, 0x53, 0xb0, 0x04, 0x00,
+  0x01, 0x5d, 0x00, 0x45, 0xb7, 0x04, 0x00, 0x80, 0x5d, 0x00, 0x5d, 0x00, 0x01, 0x68, 0x00, 0x4e,
+  0xc3, 0x04, 0x00, 0x80, 0x68, 0x00, 0x68, 0x00, 0x01, 0x86, 0x01, 0x4f, 0xcf, 0x04, 0x00, 0x01,
+  0x86, 0x01, 0x52, 0xd6, 0x04, 0x00, 0x01, 0x86, 0x01, 0x45, 0xdd, 0x04, 0x00, 0x80, 0x86, 0x01,
+  0x86, 0x01, 0x01, 0xaa, 0x00, 0x49, 0xe9, 0x04, 0x00, 0x01, 0xaa, 0x00, 0x4e, 0xf0, 0x04, 0x00,
+  0x80, 0xaa, 0x00, 0xaa, 0x00, 0x01, 0x8f, 0x01, 0x49, 0xfc, 0x04, 0x00, 0x01, 0x8f, 0x01, 0x4e,
+  0x03, 0x05, 0x00, 0x01, 0x8f, 0x01, 0x44, 0x0a, 0x05, 0x00, 0x80, 0x8f, 0x01, 0x8f, 0x01, 0x01,
+  0xed, 0x01, 0x4e, 0x16, 0x05, 0x00, 0x01, 0xed, 0x01, 0x47, 0x1d, 0x05, 0x00, 0x80, 0xed, 0x01,
+  0xed, 0x01, 0x01, 0xb2, 0x00, 0x49, 0x29, 0x05, 0x00, 0x01, 0xb2, 0x00, 0x45, 0x30, 0x05, 0x00,
+  0x01, 0xb2, 0x00, 0x56, 0x37, 0x05, 0x00, 0x01, 0xb2, 0x00, 0x45, 0x3e, 0x05, 0x00, 0x80, 0xb2,
+  0x00, 0xb2, 0x00, 0x01, 0x57, 0x01, 0x54, 0x4a, 0x05, 0x00, 0x80, 0x57, 0x01, 0x57, 0x01, 0x02,
+  0x56, 0x01, 0x54, 0x5a, 0x05, 0x00, 0x57, 0x6d, 0x05, 0x00, 0x01, 0x56, 0x01, 0x45, 0x61, 0x05,
+  0x00, 0x01, 0x56, 0x01, 0x52, 0x68, 0x05, 0x00, 0x80, 0x56, 0x01, 0x56, 0x01, 0x01, 0x88, 0x01,
+  0x45, 0x74, 0x05, 0x00, 0x01, 0x88, 0x01, 0x45, 0x7b, 0x05, 0x00, 0x01, 0x88, 0x01, 0x4e, 0x82,
+  0x05, 0x00, 0x80, 0x88, 0x01, 0x88, 0x01, 0x01, 0x90, 0x01, 0x4f, 0x8e, 0x05, 0x00, 0x01, 0x90,
+  0x01, 0x4e, 0x95, 0x05, 0x00, 0x01, 0x90, 0x01, 0x44, 0x9c, 0x05, 0x00, 0x80, 0x90, 0x01, 0x90,
+  0x01, 0x02, 0x46, 0x01, 0x47, 0xac, 0x05, 0x00, 0x4b, 0xb1, 0x05, 0x00, 0x80, 0x46, 0x01, 0x46,
+  0x01, 0x01, 0x52, 0x02, 0x45, 0xb8, 0x05, 0x00, 0x80, 0x52, 0x02, 0x52, 0x02, 0x02, 0xaa, 0x01,
+  0x41, 0xc8, 0x05, 0x00, 0x55, 0xdb, 0x05, 0x00, 0x01, 0xad, 0x01, 0x43, 0xcf, 0x05, 0x00, 0x01,
+  0xad, 0x01, 0x4b, 0xd6, 0x05, 0x00, 0x80, 0xad, 0x01, 0xad, 0x01, 0x01, 0xaa, 0x01, 0x45, 0xe2,
+  0x05, 0x00, 0x80, 0xaa, 0x01, 0xaa, 0x01, 0x04, 0x04, 0x01, 0x44, 0xfa, 0x05, 0x00, 0x4f, 0x06,
+  0x06, 0x00, 0x54, 0x12, 0x06, 0x00, 0x59, 0x1e, 0x06, 0x00, 0x01, 0x21, 0x01, 0x59, 0x01, 0x06,
+  0x00, 0x80, 0x21, 0x01, 0x21, 0x01, 0x01, 0x04, 0x01, 0x4b, 0x0d, 0x06, 0x00, 0x80, 0x04, 0x01,
+  0x04, 0x01, 0x01, 0x00, 0x02, 0x48, 0x19, 0x06, 0x00, 0x80, 0x00, 0x02, 0x00, 0x02, 0x80, 0x3b,
+  0x01, 0x3b, 0x01, 0x03, 0xb4, 0x00, 0x45, 0x32, 0x06, 0x00, 0x49, 0x63, 0x06, 0x00, 0x4f, 0x8d,
+  0x06, 0x00, 0x01, 0xd0, 0x01, 0x41, 0x39, 0x06, 0x00, 0x01, 0xd0, 0x01, 0x4b, 0x40, 0x06, 0x00,
+  0x81, 0xd0, 0x01, 0x31, 0x02, 0x46, 0x49, 0x06, 0x00, 0x01, 0xd0, 0x01, 0x41, 0x50, 0x06, 0x00,
+  0x01, 0xd0, 0x01, 0x53, 0x57, 0x06, 0x00, 0x01, 0xd0, 0x01, 0x54, 0x5e, 0x06, 0x00, 0x80, 0xd0,
+  0x01, 0xd0, 0x01, 0x02, 0xb4, 0x00, 0x44, 0x6e, 0x06, 0x00, 0x4e, 0x81, 0x06, 0x00, 0x01, 0xc6,
+  0x01, 0x47, 0x75, 0x06, 0x00, 0x01, 0xc6, 0x01, 0x45, 0x7c, 0x06, 0x00, 0x80, 0xc6, 0x01, 0xc6,
+  0x01, 0x01, 0xb4, 0x00, 0x47, 0x88, 0x06, 0x00, 0x80, 0xb4, 0x00, 0xb4, 0x00, 0x01, 0x3c, 0x02,
+  0x54, 0x94, 0x06, 0x00, 0x01, 0x3c, 0x02, 0x48, 0x9b, 0x06, 0x00, 0x01, 0x3c, 0x02, 0x45, 0xa2,
+  0x06, 0x00, 0x01, 0x3c, 0x02, 0x52, 0xa9, 0x06, 0x00, 0x80, 0x3c, 0x02, 0x3c, 0x02, 0x04, 0x15,
+  0x00, 0x49, 0xc1, 0x06, 0x00, 0x53, 0xd4, 0x06, 0x00, 0x54, 0x07, 0x07, 0x00, 0x59, 0x0c, 0x07,
+  0x00, 0x01, 0xd8, 0x00, 0x4c, 0xc8, 0x06, 0x00, 0x01, 0xd8, 0x00, 0x44, 0xcf, 0x06, 0x00, 0x80,
+  0xd8, 0x00, 0xd8, 0x00, 0x82, 0x97, 0x00, 0x50, 0x02, 0x49, 0xe1, 0x06, 0x00, 0x59, 0x02, 0x07,
+  0x00, 0x01, 0x08, 0x01, 0x4e, 0xe8, 0x06, 0x00, 0x01, 0x08, 0x01, 0x45, 0xef, 0x06, 0x00, 0x01,
+  0x08, 0x01, 0x53, 0xf6, 0x06, 0x00, 0x01, 0x08, 0x01, 0x53, 0xfd, 0x06, 0x00, 0x80, 0x08, 0x01,
+  0x08, 0x01, 0x80, 0x97, 0x00, 0x97, 0x00, 0x80, 0x15, 0x00, 0x15, 0x00, 0x80, 0xd4, 0x00, 0xd4,
+  0x00, 0x81, 0x17, 0x00, 0x17, 0x00, 0x45, 0x1a, 0x07, 0x00, 0x80, 0x7c, 0x00, 0x7c, 0x00, 0x08,
+  0x34, 0x00, 0x41, 0x42, 0x07, 0x00, 0x45, 0xde, 0x07, 0x00, 0x48, 0x06, 0x08, 0x00, 0x49, 0x83,
+  0x08, 0x00, 0x4c, 0x96, 0x08, 0x00, 0x4f, 0xc7, 0x08, 0x00, 0x52, 0x2d, 0x0a, 0x00, 0x55, 0x4e,
+  0x0a, 0x00, 0x05, 0x34, 0x00, 0x4c, 0x59, 0x07, 0x00, 0x4d, 0x8c, 0x07, 0x00, 0x4e, 0xa1, 0x07,
+  0x00, 0x52, 0xbd, 0x07, 0x00, 0x53, 0xd2, 0x07, 0x00, 0x01, 0x7d, 0x00, 0x4c, 0x60, 0x07, 0x00,
+  0x82, 0x7d, 0x00, 0x7d, 0x00, 0x45, 0x6d, 0x07, 0x00, 0x49, 0x79, 0x07, 0x00, 0x01, 0x19, 0x02,
+  0x44, 0x74, 0x07, 0x00, 0x80, 0x19, 0x02, 0x19, 0x02, 0x01, 0xf9, 0x01, 0x4e, 0x80, 0x07, 0x00,
+  0x01, 0xf9, 0x01, 0x47, 0x87, 0x07, 0x00, 0x80, 0xf9, 0x01, 0xf9, 0x01, 0x02, 0x70, 0x00, 0x45,
+  0x97, 0x07, 0x00, 0x50, 0x9c, 0x07, 0x00, 0x80, 0x70, 0x00, 0x70, 0x00, 0x80, 0xc1, 0x01, 0xc1,
+  0x01, 0x81, 0x34, 0x00, 0x34, 0x00, 0x43, 0xaa, 0x07, 0x00, 0x01, 0xde, 0x01, 0x45, 0xb1, 0x07,
+  0x00, 0x01, 0xde, 0x01, 0x4c, 0xb8, 0x07, 0x00, 0x80, 0xde, 0x01, 0xde, 0x01, 0x81, 0x18, 0x01,
+  0x18, 0x01, 0x52, 0xc6, 0x07, 0x00, 0x01, 0x2d, 0x02, 0x59, 0xcd, 0x07, 0x00, 0x80, 0x2d, 0x02,
+  0x2d, 0x02, 0x01, 0xef, 0x00, 0x45, 0xd9, 0x07, 0x00, 0x80, 0xef, 0x00, 0xef, 0x00, 0x01, 0x61,
+  0x01, 0x52, 0xe5, 0x07, 0x00, 0x01, 0x61, 0x01, 0x54, 0xec, 0x07, 0x00, 0x01, 0x61, 0x01, 0x41,
+  0xf3, 0x07, 0x00, 0x01, 0x61, 0x01, 0x49, 0xfa, 0x07, 0x00, 0x01, 0x61, 0x01, 0x4e, 0x01, 0x08,
+  0x00, 0x80, 0x61, 0x01, 0x61, 0x01, 0x03, 0xc0, 0x00, 0x41, 0x15, 0x08, 0x00, 0x45, 0x5d, 0x08,
+  0x00, 0x49, 0x70, 0x08, 0x00, 0x02, 0xc0, 0x00, 0x4e, 0x20, 0x08, 0x00, 0x52, 0x4a, 0x08, 0x00,
+  0x02, 0xc0, 0x00, 0x47, 0x2b, 0x08, 0x00, 0x4e, 0x37, 0x08, 0x00, 0x01, 0xc0, 0x00, 0x45, 0x32,
+  0x08, 0x00, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0x01, 0xbd, 0x01, 0x45, 0x3e, 0x08, 0x00, 0x01, 0xbd,
+  0x01, 0x4c, 0x45, 0x08, 0x00, 0x80, 0xbd, 0x01, 0xbd, 0x01, 0x01, 0xb2, 0x01, 0x47, 0x51, 0x08,
+  0x00, 0x01, 0xb2, 0x01, 0x45, 0x58, 0x08, 0x00, 0x80, 0xb2, 0x01, 0xb2, 0x01, 0x01, 0xdc, 0x01,
+  0x43, 0x64, 0x08, 0x00, 0x01, 0xdc, 0x01, 0x4b, 0x6b, 0x08, 0x00, 0x80, 0xdc, 0x01, 0xdc, 0x01,
+  0x01, 0xe9, 0x00, 0x4c, 0x77, 0x08, 0x00, 0x01, 0xe9, 0x00, 0x44, 0x7e, 0x08, 0x00, 0x80, 0xe9,
+  0x00, 0xe9, 0x00, 0x01, 0x19, 0x01, 0x54, 0x8a, 0x08, 0x00, 0x01, 0x19, 0x01, 0x59, 0x91, 0x08,
+  0x00, 0x80, 0x19, 0x01, 0x19, 0x01, 0x02, 0x5c, 0x01, 0x45, 0xa1, 0x08, 0x00, 0x4f, 0xb4, 0x08,
+  0x00, 0x01, 0x5c, 0x01, 0x41, 0xa8, 0x08, 0x00, 0x01, 0x5c, 0x01, 0x52, 0xaf, 0x08, 0x00, 0x80,
+  0x5c, 0x01, 0x5c, 0x01, 0x01, 0x2c, 0x02, 0x53, 0xbb, 0x08, 0x00, 0x01, 0x2c, 0x02, 0x45, 0xc2,
+  0x08, 0x00, 0x80, 0x2c, 0x02, 0x2c, 0x02, 0x07, 0x42, 0x00, 0x46, 0xe6, 0x08, 0x00, 0x4c, 0x00,
+  0x09, 0x00, 0x4d, 0x0c, 0x09, 0x00, 0x4e, 0x79, 0x09, 0x00, 0x4f, 0xe4, 0x09, 0x00, 0x50, 0xf0,
+  0x09, 0x00, 0x55, 0xfc, 0x09, 0x00, 0x01, 0xcc, 0x01, 0x46, 0xed, 0x08, 0x00, 0x01, 0xcc, 0x01,
+  0x45, 0xf4, 0x08, 0x00, 0x01, 0xcc, 0x01, 0x45, 0xfb, 0x08, 0x00, 0x80, 0xcc, 0x01, 0xcc, 0x01,
+  0x01, 0x68, 0x01, 0x44, 0x07, 0x09, 0x00, 0x80, 0x68, 0x01, 0x68, 0x01, 0x04, 0x4b, 0x00, 0x45,
+  0x1f, 0x09, 0x00, 0x49, 0x24, 0x09, 0x00, 0x4d, 0x37, 0x09, 0x00, 0x50, 0x5f, 0x09, 0x00, 0x80,
+  0x4b, 0x00, 0x4b, 0x00, 0x01, 0x90, 0x00, 0x4e, 0x2b, 0x09, 0x00, 0x01, 0x90, 0x00, 0x47, 0x32,
+  0x09, 0x00, 0x80, 0x90, 0x00, 0x90, 0x00, 0x01, 0x1a, 0x01, 0x55, 0x3e, 0x09, 0x00, 0x01, 0x1a,
+  0x01, 0x4e, 0x45, 0x09, 0x00, 0x01, 0x1a, 0x01, 0x49, 0x4c, 0x09, 0x00, 0x01, 0x1a, 0x01, 0x54,
+  0x53, 0x09, 0x00, 0x01, 0x1a, 0x01, 0x59, 0x5a, 0x09, 0x00, 0x80, 0x1a, 0x01, 0x1a, 0x01, 0x01,
+  0xf1, 0x00, 0x41, 0x66, 0x09, 0x00, 0x01, 0xf1, 0x00, 0x4e, 0x6d, 0x09, 0x00, 0x01, 0xf1, 0x00,
+  0x59, 0x74, 0x09, 0x00, 0x80, 0xf1, 0x00, 0xf1, 0x00, 0x03, 0xbd, 0x00, 0x46, 0x88, 0x09, 0x00,
+  0x53, 0xa2, 0x09, 0x00, 0x54, 0xc3, 0x09, 0x00, 0x01, 0xdd, 0x01, 0x49, 0x8f, 0x09, 0x00, 0x01,
+  0xdd, 0x01, 0x52, 0x96, 0x09, 0x00, 0x01, 0xdd, 0x01, 0x4d, 0x9d, 0x09, 0x00, 0x80, 0xdd, 0x01,
+  0xdd, 0x01, 0x01, 0xd2, 0x00, 0x49, 0xa9, 0x09, 0x00, 0x01, 0xd2, 0x00, 0x44, 0xb0, 0x09, 0x00,
+  0x01, 0xd2, 0x00, 0x45, 0xb7, 0x09, 0x00, 0x01, 0xd2, 0x00, 0x52, 0xbe, 0x09, 0x00, 0x80, 0xd2,
+  0x00, 0xd2, 0x00, 0x01, 0xbd, 0x00, 0x49, 0xca, 0x09, 0x00, 0x01, 0xbd, 0x00, 0x4e, 0xd1, 0x09,
+  0x00, 0x01, 0xbd, 0x00, 0x55, 0xd8, 0x09, 0x00, 0x01, 0xbd, 0x00, 0x45, 0xdf, 0x09, 0x00, 0x80,
+  0xbd, 0x00, 0xbd, 0x00, 0x01, 0x6d, 0x01, 0x4c, 0xeb, 0x09, 0x00, 0x80, 0x6d, 0x01, 0x6d, 0x01,
+  0x01, 0xd2, 0x01, 0x59, 0xf7, 0x09, 0x00, 0x80, 0xd2, 0x01, 0xd2, 0x01, 0x02, 0x42, 0x00, 0x4c,
+  0x07, 0x0a, 0x00, 0x4e, 0x13, 0x0a, 0x00, 0x01, 0x42, 0x00, 0x44, 0x0e, 0x0a, 0x00, 0x80, 0x42,
+  0x00, 0x42, 0x00, 0x01, 0x3f, 0x01, 0x54, 0x1a, 0x0a, 0x00, 0x01, 0x3f, 0x01, 0x52, 0x21, 0x0a,
+  0x00, 0x01, 0x3f, 0x01, 0x59, 0x28, 0x0a, 0x00, 0x80, 0x3f, 0x01, 0x3f, 0x01, 0x01, 0xc5, 0x00,
+  0x45, 0x34, 0x0a, 0x00, 0x01, 0xc5, 0x00, 0x41, 0x3b, 0x0a, 0x00, 0x01, 0xc5, 0x00, 0x54, 0x42,
+  0x0a, 0x00, 0x01, 0xc5, 0x00, 0x45, 0x49, 0x0a, 0x00, 0x80, 0xc5, 0x00, 0xc5, 0x00, 0x01, 0xdb,
+  0x00, 0x54, 0x55, 0x0a, 0x00, 0x80, 0xdb, 0x00, 0xdb, 0x00, 0x06, 0x12, 0x00, 0x41, 0x75, 0x0a,
+  0x00, 0x45, 0xd6, 0x0a, 0x00, 0x49, 0xf7, 0x0a, 0x00, 0x4f, 0x5d, 0x0b, 0x00, 0x52, 0xd7, 0x0b,
+  0x00, 0x55, 0x11, 0x0c, 0x00, 0x05, 0x61, 0x00, 0x44, 0x8c, 0x0a, 0x00, 0x52, 0x91, 0x0a, 0x00,
+  0x54, 0x9d, 0x0a, 0x00, 0x55, 0xa9, 0x0a, 0x00, 0x59, 0xd1, 0x0a, 0x00, 0x80, 0x3b, 0x02, 0x3b,
+  0x02, 0x01, 0x70, 0x01, 0x4b, 0x98, 0x0a, 0x00, 0x80, 0x70, 0x01, 0x70, 0x01, 0x01, 0x13, 0x02,
+  0x45, 0xa4, 0x0a, 0x00, 0x80, 0x13, 0x02, 0x13, 0x02, 0x01, 0x3f, 0x02, 0x47, 0xb0, 0x0a, 0x00,
+  0x01, 0x3f, 0x02, 0x48, 0xb7, 0x0a, 0x00, 0x01, 0x3f, 0x02, 0x54, 0xbe, 0x0a, 0x00, 0x01, 0x3f,
+  0x02, 0x45, 0xc5, 0x0a, 0x00, 0x01, 0x3f, 0x02, 0x52, 0xcc, 0x0a, 0x00, 0x80, 0x3f, 0x02, 0x3f,
+  0x02, 0x80, 0x61, 0x00, 0x61, 0x00, 0x01, 0xe5, 0x00, 0x43, 0xdd, 0x0a, 0x00, 0x01, 0xe5, 0x00,
+  0x49, 0xe4, 0x0a, 0x00, 0x01, 0xe5, 0x00, 0x44, 0xeb, 0x0a, 0x00, 0x01, 0xe5, 0x00, 0x45, 0xf2,
+  0x0a, 0x00, 0x80, 0xe5, 0x00, 0xe5, 0x00, 0x04, 0x6b, 0x00, 0x44, 0x0a, 0x0b, 0x00, 0x45, 0x0f,
+  0x0b, 0x00, 0x46, 0x14, 0x0b, 0x00, 0x4e, 0x43, 0x0b, 0x00, 0x80, 0x6b, 0x00, 0x6b, 0x00, 0x80,
+  0xd6, 0x00, 0xd6, 0x00, 0x01, 0x48, 0x01, 0x46, 0x1b, 0x0b, 0x00, 0x01, 0x48, 0x01, 0x45, 0x22,
+  0x0b, 0x00, 0x01, 0x48, 0x01, 0x52, 0x29, 0x0b, 0x00, 0x01, 0x48, 0x01, 0x45, 0x30, 0x0b, 0x00,
+  0x01, 0x48, 0x01, 0x4e, 0x37, 0x0b, 0x00, 0x01, 0x48, 0x01, 0x54, 0x3e, 0x0b, 0x00, 0x80, 0x48,
+  0x01, 0x48, 0x01, 0x01, 0xcf, 0x01, 0x4e, 0x4a, 0x0b, 0x00, 0x01, 0xcf, 0x01, 0x45, 0x51, 0x0b,
+  0x00, 0x01, 0xcf, 0x01, 0x52, 0x58, 0x0b, 0x00, 0x80, 0xcf, 0x01, 0xcf, 0x01, 0x86, 0x12, 0x00,
+  0x12, 0x00, 0x43, 0x7a, 0x0b, 0x00, 0x45, 0x94, 0x0b, 0x00, 0x49, 0xa0, 0x0b, 0x00, 0x4e, 0xb3,
+  0x0b, 0x00, 0x4f, 0xbf, 0x0b, 0x00, 0x57, 0xcb, 0x0b, 0x00, 0x01, 0x48, 0x02, 0x54, 0x81, 0x0b,
+  0x00, 0x01, 0x48, 0x02, 0x4f, 0x88, 0x0b, 0x00, 0x01, 0x48, 0x02, 0x52, 0x8f, 0x0b, 0x00, 0x80,
+  0x48, 0x02, 0x48, 0x02, 0x01, 0xe9, 0x01, 0x53, 0x9b, 0x0b, 0x00, 0x80, 0xe9, 0x01, 0xe9, 0x01,
+  0x01, 0xea, 0x01, 0x4e, 0xa7, 0x0b, 0x00, 0x01, 0xea, 0x01, 0x47, 0xae, 0x0b, 0x00, 0x80, 0xea,
+  0x01, 0xea, 0x01, 0x01, 0xeb, 0x01, 0x45, 0xba, 0x0b, 0x00, 0x80, 0xeb, 0x01, 0xeb, 0x01, 0x01,
+  0x28, 0x01, 0x52, 0xc6, 0x0b, 0x00, 0x80, 0x28, 0x01, 0x28, 0x01, 0x01, 0x7d, 0x01, 0x4e, 0xd2,
+  0x0b, 0x00, 0x80, 0x7d, 0x01, 0x7d, 0x01, 0x02, 0xca, 0x01, 0x49, 0xe2, 0x0b, 0x00, 0x4f, 0x05,
+  0x0c, 0x00, 0x02, 0xca, 0x01, 0x4e, 0xed, 0x0b, 0x00, 0x56, 0xf9, 0x0b, 0x00, 0x01, 0xca, 0x01,
+  0x4b, 0xf4, 0x0b, 0x00, 0x80, 0xca, 0x01, 0xca, 0x01, 0x01, 0x53, 0x02, 0x45, 0x00, 0x0c, 0x00,
+  0x80, 0x53, 0x02, 0x53, 0x02, 0x01, 0x2e, 0x02, 0x50, 0x0c, 0x0c, 0x00, 0x80, 0x2e, 0x02, 0x2e,
+  0x02, 0x01, 0x8a, 0x01, 0x52, 0x18, 0x0c, 0x00, 0x01, 0x8a, 0x01, 0x49, 0x1f, 0x0c, 0x00, 0x01,
+  0x8a, 0x01, 0x4e, 0x26, 0x0c, 0x00, 0x01, 0x8a, 0x01, 0x47, 0x2d, 0x0c, 0x00, 0x80, 0x8a, 0x01,
+  0x8a, 0x01, 0x08, 0x5a, 0x00, 0x41, 0x55, 0x0c, 0x00, 0x44, 0xa1, 0x0c, 0x00, 0x49, 0xd7, 0x0c,
+  0x00, 0x4c, 0x0f, 0x0d, 0x00, 0x4e, 0x22, 0x0d, 0x00, 0x56, 0x4c, 0x0d, 0x00, 0x58, 0xd2, 0x0d,
+  0x00, 0x59, 0xf3, 0x0d, 0x00, 0x04, 0x94, 0x00, 0x43, 0x68, 0x0c, 0x00, 0x52, 0x74, 0x0c, 0x00,
+  0x53, 0x87, 0x0c, 0x00, 0x54, 0x9c, 0x0c, 0x00, 0x01, 0xfe, 0x01, 0x48, 0x6f, 0x0c, 0x00, 0x80,
+  0xfe, 0x01, 0xfe, 0x01, 0x01, 0x94, 0x00, 0x4c, 0x7b, 0x0c, 0x00, 0x01, 0x94, 0x00, 0x59, 0x82,
+  0x0c, 0x00, 0x80, 0x94, 0x00, 0x94, 0x00, 0x02, 0x5f, 0x01, 0x54, 0x92, 0x0c, 0x00, 0x59, 0x97,
+  0x0c, 0x00, 0x80, 0x96, 0x01, 0x96, 0x01, 0x80, 0x5f, 0x01, 0x5f, 0x01, 0x80, 0xcb, 0x01, 0xcb,
+  0x01, 0x01, 0x39, 0x01, 0x55, 0xa8, 0x0c, 0x00, 0x01, 0x39, 0x01, 0x43, 0xaf, 0x0c, 0x00, 0x01,
+  0x39, 0x01, 0x41, 0xb6, 0x0c, 0x00, 0x01, 0x39, 0x01, 0x54, 0xbd, 0x0c, 0x00, 0x01, 0x39, 0x01,
+  0x49, 0xc4, 0x0c, 0x00, 0x01, 0x39, 0x01, 0x4f, 0xcb, 0x0c, 0x00, 0x01, 0x39, 0x01, 0x4e, 0xd2,
+  0x0c, 0x00, 0x80, 0x39, 0x01, 0x39, 0x01, 0x02, 0xa2, 0x01, 0x47, 0xe2, 0x0c, 0x00, 0x54, 0xf5,
+  0x0c, 0x00, 0x01, 0xa2, 0x01, 0x48, 0xe9, 0x0c, 0x00, 0x01, 0xa2, 0x01, 0x54, 0xf0, 0x0c, 0x00,
+  0x80, 0xa2, 0x01, 0xa2, 0x01, 0x01, 0x01, 0x02, 0x48, 0xfc, 0x0c, 0x00, 0x01, 0x01, 0x02, 0x45,
+  0x03, 0x0d, 0x00, 0x01, 0x01, 0x02, 0x52, 0x0a, 0x0d, 0x00, 0x80, 0x01, 0x02, 0x01, 0x02, 0x01,
+  0x84, 0x01, 0x53, 0x16, 0x0d, 0x00, 0x01, 0x84, 0x01, 0x45, 0x1d, 0x0d, 0x00, 0x80, 0x84, 0x01,
+  0x84, 0x01, 0x02, 0x15, 0x01, 0x44, 0x2d, 0x0d, 0x00, 0x4f, 0x32, 0x0d, 0x00, 0x80, 0x15, 0x01,
+  0x15, 0x01, 0x01, 0x85, 0x01, 0x55, 0x39, 0x0d, 0x00, 0x01, 0x85, 0x01, 0x47, 0x40, 0x0d, 0x00,
+  0x01, 0x85, 0x01, 0x48, 0x47, 0x0d, 0x00, 0x80, 0x85, 0x01, 0x85, 0x01, 0x01, 0x5a, 0x00, 0x45,
+  0x53, 0x0d, 0x00, 0x02, 0x5a, 0x00, 0x4e, 0x5e, 0x0d, 0x00, 0x52, 0x63, 0x0d, 0x00, 0x80, 0x5a,
+  0x00, 0x5a, 0x00, 0x81, 0x83, 0x01, 0x83, 0x01, 0x59, 0x6c, 0x0d, 0x00, 0x83, 0xff, 0x01, 0xff,
+  0x01, 0x4f, 0x7d, 0x0d, 0x00, 0x54, 0x90, 0x0d, 0x00, 0x57, 0xb1, 0x0d, 0x00, 0x01, 0x0b, 0x02,
+  0x4e, 0x84, 0x0d, 0x00, 0x01, 0x0b, 0x02, 0x45, 0x8b, 0x0d, 0x00, 0x80, 0x0b, 0x02, 0x0b, 0x02,
+  0x01, 0x08, 0x02, 0x48, 0x97, 0x0d, 0x00, 0x01, 0x08, 0x02, 0x49, 0x9e, 0x0d, 0x00, 0x01, 0x08,
+  0x02, 0x4e, 0xa5, 0x0d, 0x00, 0x01, 0x08, 0x02, 0x47, 0xac, 0x0d, 0x00, 0x80, 0x08, 0x02, 0x08,
+  0x02, 0x01, 0x0f, 0x02, 0x48, 0xb8, 0x0d, 0x00, 0x01, 0x0f, 0x02, 0x45, 0xbf, 0x0d, 0x00, 0x01,
+  0x0f, 0x02, 0x52, 0xc6, 0x0d, 0x00, 0x01, 0x0f, 0x02, 0x45, 0xcd, 0x0d, 0x00, 0x80, 0x0f, 0x02,
+  0x0f, 0x02, 0x01, 0xd7, 0x00, 0x50, 0xd9, 0x0d, 0x00, 0x01, 0xd7, 0x00, 0x45, 0xe0, 0x0d, 0x00,
+  0x01, 0xd7, 0x00, 0x43, 0xe7, 0x0d, 0x00, 0x01, 0xd7, 0x00, 0x54, 0xee, 0x0d, 0x00, 0x80, 0xd7,
+  0x00, 0xd7, 0x00, 0x01, 0x05, 0x01, 0x45, 0xfa, 0x0d, 0x00, 0x80, 0x05, 0x01, 0x05, 0x01, 0x07,
+  0x0b, 0x00, 0x41, 0x1e, 0x0e, 0x00, 0x45, 0x9f, 0x0e, 0x00, 0x49, 0xbb, 0x0e, 0x00, 0x4c, 0x37,
+  0x0f, 0x00, 0x4f, 0x43, 0x0f, 0x00, 0x52, 0xad, 0x0f, 0x00, 0x55, 0xf7, 0x0f, 0x00, 0x05, 0xda,
+  0x00, 0x43, 0x35, 0x0e, 0x00, 0x4c, 0x4a, 0x0e, 0x00, 0x4d, 0x66, 0x0e, 0x00, 0x52, 0x80, 0x0e,
+  0x00, 0x54, 0x85, 0x0e, 0x00, 0x02, 0xff, 0x00, 0x45, 0x40, 0x0e, 0x00, 0x54, 0x45, 0x0e, 0x00,
+  0x80, 0x24, 0x01, 0x24, 0x01, 0x80, 0xff, 0x00, 0xff, 0x00, 0x02, 0xda, 0x00, 0x4c, 0x55, 0x0e,
+  0x00, 0x53, 0x5a, 0x0e, 0x00, 0x80, 0xda, 0x00, 0xda, 0x00, 0x01, 0x57, 0x02, 0x45, 0x61, 0x0e,
+  0x00, 0x80, 0x57, 0x02, 0x57, 0x02, 0x01, 0x3c, 0x01, 0x49, 0x6d, 0x0e, 0x00, 0x01, 0x3c, 0x01,
+  0x4c, 0x74, 0x0e, 0x00, 0x01, 0x3c, 0x01, 0x59, 0x7b, 0x0e, 0x00, 0x80, 0x3c, 0x01, 0x3c, 0x01,
+  0x80, 0x9a, 0x01, 0x9a, 0x01, 0x01, 0x10, 0x01, 0x48, 0x8c, 0x0e, 0x00, 0x01, 0x10, 0x01, 0x45,
+  0x93, 0x0e, 0x00, 0x01, 0x10, 0x01, 0x52, 0x9a, 0x0e, 0x00, 0x80, 0x10, 0x01, 0x10, 0x01, 0x02,
+  0xa3, 0x00, 0x45, 0xaa, 0x0e, 0x00, 0x57, 0xb6, 0x0e, 0x00, 0x01, 0xa3, 0x00, 0x4c, 0xb1, 0x0e,
+  0x00, 0x80, 0xa3, 0x00, 0xa3, 0x00, 0x80, 0x4e, 0x01, 0x4e, 0x01, 0x04, 0x57, 0x00, 0x4e, 0xce,
+  0x0e, 0x00, 0x52, 0x0a, 0x0f, 0x00, 0x56, 0x26, 0x0f, 0x00, 0x58, 0x32, 0x0f, 0x00, 0x03, 0x96,
+  0x00, 0x44, 0xdd, 0x0e, 0x00, 0x45, 0xe2, 0x0e, 0x00, 0x49, 0xe7, 0x0e, 0x00, 0x80, 0x9e, 0x00,
+  0x9e, 0x00, 0x80, 0x96, 0x00, 0x96, 0x00, 0x01, 0x1f, 0x02, 0x53, 0xee, 0x0e, 0x00, 0x01, 0x1f,
+  0x02, 0x48, 0xf5, 0x0e, 0x00, 0x81, 0x1f, 0x02, 0x2a, 0x02, 0x45, 0xfe, 0x0e, 0x00, 0x01, 0x1f,
+  0x02, 0x44, 0x05, 0x0f, 0x00, 0x80, 0x1f, 0x02, 0x1f, 0x02, 0x02, 0x57, 0x00, 0x45, 0x15, 0x0f,
+  0x00, 0x53, 0x1a, 0x0f, 0x00, 0x80, 0xc4, 0x01, 0xc4, 0x01, 0x01, 0x57, 0x00, 0x54, 0x21, 0x0f,
+  0x00, 0x80, 0x57, 0x00, 0x57, 0x00, 0x01, 0x9f, 0x01, 0x45, 0x2d, 0x0f, 0x00, 0x80, 0x9f, 0x01,
+  0x9f, 0x01, 0x80, 0x30, 0x02, 0x30, 0x02, 0x01, 0x55, 0x02, 0x59, 0x3e, 0x0f, 0x00, 0x80, 0x55,
+  0x02, 0x55, 0x02, 0x04, 0x0b, 0x00, 0x4c, 0x56, 0x0f, 0x00, 0x4f, 0x70, 0x0f, 0x00, 0x52, 0x7c,
+  0x0f, 0x00, 0x55, 0x91, 0x0f, 0x00, 0x01, 0xc4, 0x00, 0x4c, 0x5d, 0x0f, 0x00, 0x01, 0xc4, 0x00,
+  0x4f, 0x64, 0x0f, 0x00, 0x01, 0xc4, 0x00, 0x57, 0x6b, 0x0f, 0x00, 0x80, 0xc4, 0x00, 0xc4, 0x00,
+  0x01, 0x3a, 0x01, 0x44, 0x77, 0x0f, 0x00, 0x80, 0x3a, 0x01, 0x3a, 0x01, 0x81, 0x0b, 0x00, 0x0b,
+  0x00, 0x43, 0x85, 0x0f, 0x00, 0x01, 0x38, 0x01, 0x45, 0x8c, 0x0f, 0x00, 0x80, 0x38, 0x01, 0x38,
+  0x01, 0x02, 0x9e, 0x01, 0x4e, 0x9c, 0x0f, 0x00, 0x52, 0xa8, 0x0f, 0x00, 0x01, 0xb8, 0x01, 0x44,
+  0xa3, 0x0f, 0x00, 0x80, 0xb8, 0x01, 0xb8, 0x01, 0x80, 0x9e, 0x01, 0x9e, 0x01, 0x03, 0x18, 0x00,
+  0x45, 0xbc, 0x0f, 0x00, 0x49, 0xc8, 0x0f, 0x00, 0x4f, 0xeb, 0x0f, 0x00, 0x01, 0x98, 0x00, 0x45,
+  0xc3, 0x0f, 0x00, 0x80, 0x98, 0x00, 0x98, 0x00, 0x01, 0x0f, 0x01, 0x45, 0xcf, 0x0f, 0x00, 0x01,
+  0x0f, 0x01, 0x4e, 0xd6, 0x0f, 0x00, 0x01, 0x0f, 0x01, 0x44, 0xdd, 0x0f, 0x00, 0x81, 0x0f, 0x01,
+  0x0f, 0x01, 0x53, 0xe6, 0x0f, 0x00, 0x80, 0x43, 0x02, 0x43, 0x02, 0x01, 0x18, 0x00, 0x4d, 0xf2,
+  0x0f, 0x00, 0x80, 0x18, 0x00, 0x18, 0x00, 0x01, 0x5d, 0x01, 0x4c, 0xfe, 0x0f, 0x00, 0x01, 0x5d,
+  0x01, 0x4c, 0x05, 0x10, 0x00, 0x80, 0x5d, 0x01, 0x5d, 0x01, 0x07, 0x2e, 0x00, 0x41, 0x29, 0x10,
+  0x00, 0x45, 0x4c, 0x10, 0x00, 0x49, 0x76, 0x10, 0x00, 0x4c, 0x99, 0x10, 0x00, 0x4f, 0xac, 0x10,
+  0x00, 0x52, 0x1b, 0x11, 0x00, 0x55, 0x65, 0x11, 0x00, 0x02, 0x13, 0x01, 0x4d, 0x34, 0x10, 0x00,
+  0x54, 0x40, 0x10, 0x00, 0x01, 0x13, 0x01, 0x45, 0x3b, 0x10, 0x00, 0x80, 0x13, 0x01, 0x13, 0x01,
+  0x01, 0xc7, 0x01, 0x45, 0x47, 0x10, 0x00, 0x80, 0xc7, 0x01, 0xc7, 0x01, 0x01, 0x2e, 0x00, 0x54,
+  0x53, 0x10, 0x00, 0x81, 0x2e, 0x00, 0x2e, 0x00, 0x54, 0x5c, 0x10, 0x00, 0x01, 0xee, 0x01, 0x49,
+  0x63, 0x10, 0x00, 0x01, 0xee, 0x01, 0x4e, 0x6a, 0x10, 0x00, 0x01, 0xee, 0x01, 0x47, 0x71, 0x10,
+  0x00, 0x80, 0xee, 0x01, 0xee, 0x01, 0x02, 0x60, 0x00, 0x52, 0x81, 0x10, 0x00, 0x56, 0x8d, 0x10,
+  0x00, 0x01, 0x33, 0x01, 0x4c, 0x88, 0x10, 0x00, 0x80, 0x33, 0x01, 0x33, 0x01, 0x01, 0x60, 0x00,
+  0x45, 0x94, 0x10, 0x00, 0x80, 0x60, 0x00, 0x60, 0x00, 0x01, 0xd7, 0x01, 0x41, 0xa0, 0x10, 0x00,
+  0x01, 0xd7, 0x01, 0x44, 0xa7, 0x10, 0x00, 0x80, 0xd7, 0x01, 0xd7, 0x01, 0x84, 0x30, 0x00, 0x30,
+  0x00, 0x49, 0xc1, 0x10, 0x00, 0x4f, 0xd4, 0x10, 0x00, 0x54, 0xe0, 0x10, 0x00, 0x56, 0xe5, 0x10,
+  0x00, 0x01, 0x8f, 0x00, 0x4e, 0xc8, 0x10, 0x00, 0x01, 0x8f, 0x00, 0x47, 0xcf, 0x10, 0x00, 0x80,
+  0x8f, 0x00, 0x8f, 0x00, 0x01, 0x40, 0x00, 0x44, 0xdb, 0x10, 0x00, 0x80, 0x40, 0x00, 0x40, 0x00,
+  0x80, 0x6f, 0x00, 0x6f, 0x00, 0x01, 0xf5, 0x00, 0x45, 0xec, 0x10, 0x00, 0x01, 0xf5, 0x00, 0x52,
+  0xf3, 0x10, 0x00, 0x01, 0xf5, 0x00, 0x4e, 0xfa, 0x10, 0x00, 0x01, 0xf5, 0x00, 0x4d, 0x01, 0x11,
+  0x00, 0x01, 0xf5, 0x00, 0x45, 0x08, 0x11, 0x00, 0x01, 0xf5, 0x00, 0x4e, 0x0f, 0x11, 0x00, 0x01,
+  0xf5, 0x00, 0x54, 0x16, 0x11, 0x00, 0x80, 0xf5, 0x00, 0xf5, 0x00, 0x02, 0xcb, 0x00, 0x45, 0x26,
+  0x11, 0x00, 0x4f, 0x49, 0x11, 0x00, 0x02, 0x42, 0x01, 0x41, 0x31, 0x11, 0x00, 0x45, 0x3d, 0x11,
+  0x00, 0x01, 0x42, 0x01, 0x54, 0x38, 0x11, 0x00, 0x80, 0x42, 0x01, 0x42, 0x01, 0x01, 0xab, 0x01,
+  0x4e, 0x44, 0x11, 0x00, 0x80, 0xab, 0x01, 0xab, 0x01, 0x02, 0xcb, 0x00, 0x55, 0x54, 0x11, 0x00,
+  0x57, 0x60, 0x11, 0x00, 0x01, 0x3e, 0x01, 0x50, 0x5b, 0x11, 0x00, 0x80, 0x3e, 0x01, 0x3e, 0x01,
+  0x80, 0xcb, 0x00, 0xcb, 0x00, 0x01, 0x34, 0x01, 0x59, 0x6c, 0x11, 0x00, 0x80, 0x34, 0x01, 0x34,
+  0x01, 0x05, 0x08, 0x00, 0x41, 0x88, 0x11, 0x00, 0x45, 0x0b, 0x12, 0x00, 0x49, 0x7b, 0x12, 0x00,
+  0x4f, 0xd0, 0x12, 0x00, 0x55, 0x61, 0x13, 0x00, 0x06, 0x08, 0x00, 0x44, 0xa3, 0x11, 0x00, 0x4e,
+  0xa8, 0x11, 0x00, 0x50, 0xb4, 0x11, 0x00, 0x52, 0xd7, 0x11, 0x00, 0x53, 0xe3, 0x11, 0x00, 0x56,
+  0xe8, 0x11, 0x00, 0x80, 0x6a, 0x00, 0x6a, 0x00, 0x01, 0xec, 0x00, 0x44, 0xaf, 0x11, 0x00, 0x80,
+  0xec, 0x00, 0xec, 0x00, 0x01, 0xb5, 0x00, 0x50, 0xbb, 0x11, 0x00, 0x02, 0xb5, 0x00, 0x45, 0xc6,
+  0x11, 0x00, 0x59, 0xd2, 0x11, 0x00, 0x01, 0xb5, 0x00, 0x4e, 0xcd, 0x11, 0x00, 0x80, 0xb5, 0x00,
+  0xb5, 0x00, 0x80, 0x6a, 0x01, 0x6a, 0x01, 0x01, 0x54, 0x01, 0x44, 0xde, 0x11, 0x00, 0x80, 0x54,
+  0x01, 0x54, 0x01, 0x80, 0x69, 0x00, 0x69, 0x00, 0x02, 0x08, 0x00, 0x45, 0xf3, 0x11, 0x00, 0x49,
+  0xf8, 0x11, 0x00, 0x80, 0x08, 0x00, 0x08, 0x00, 0x01, 0xec, 0x01, 0x4e, 0xff, 0x11, 0x00, 0x01,
+  0xec, 0x01, 0x47, 0x06, 0x12, 0x00, 0x80, 0xec, 0x01, 0xec, 0x01, 0x84, 0x0f, 0x00, 0x0f, 0x00,
+  0x41, 0x20, 0x12, 0x00, 0x4c, 0x4c, 0x12, 0x00, 0x52, 0x68, 0x12, 0x00, 0x59, 0x76, 0x12, 0x00,
+  0x03, 0xad, 0x00, 0x44, 0x2f, 0x12, 0x00, 0x4c, 0x34, 0x12, 0x00, 0x52, 0x47, 0x12, 0x00, 0x80,
+  0x0c, 0x01, 0x0c, 0x01, 0x01, 0x29, 0x01, 0x54, 0x3b, 0x12, 0x00, 0x01, 0x29, 0x01, 0x48, 0x42,
+  0x12, 0x00, 0x80, 0x29, 0x01, 0x29, 0x01, 0x80, 0xad, 0x00, 0xad, 0x00, 0x02, 0x76, 0x00, 0x4c,
+  0x57, 0x12, 0x00, 0x50, 0x63, 0x12, 0x00, 0x01, 0x76, 0x00, 0x4f, 0x5e, 0x12, 0x00, 0x80, 0x76,
+  0x00, 0x76, 0x00, 0x80, 0x8b, 0x00, 0x8b, 0x00, 0x81, 0x1c, 0x00, 0x1c, 0x00, 0x45, 0x71, 0x12,
+  0x00, 0x80, 0x89, 0x00, 0x89, 0x00, 0x80, 0x77, 0x00, 0x77, 0x00, 0x84, 0x16, 0x00, 0x75, 0x00,
+  0x47, 0x90, 0x12, 0x00, 0x4c, 0x9c, 0x12, 0x00, 0x4d, 0xa8, 0x12, 0x00, 0x53, 0xad, 0x12, 0x00,
+  0x01, 0x47, 0x01, 0x48, 0x97, 0x12, 0x00, 0x80, 0x47, 0x01, 0x47, 0x01, 0x01, 0xc0, 0x01, 0x4c,
+  0xa3, 0x12, 0x00, 0x80, 0xc0, 0x01, 0xc0, 0x01, 0x80, 0x39, 0x00, 0x39, 0x00, 0x81, 0x16, 0x00,
+  0x16, 0x00, 0x54, 0xb6, 0x12, 0x00, 0x01, 0x2d, 0x01, 0x4f, 0xbd, 0x12, 0x00, 0x01, 0x2d, 0x01,
+  0x52, 0xc4, 0x12, 0x00, 0x01, 0x2d, 0x01, 0x59, 0xcb, 0x12, 0x00, 0x80, 0x2d, 0x01, 0x2d, 0x01,
+  0x07, 0x54, 0x00, 0x4c, 0xef, 0x12, 0x00, 0x4d, 0xfb, 0x12, 0x00, 0x50, 0x07, 0x13, 0x00, 0x53,
+  0x13, 0x13, 0x00, 0x54, 0x3b, 0x13, 0x00, 0x55, 0x40, 0x13, 0x00, 0x57, 0x5c, 0x13, 0x00, 0x01,
+  0xb3, 0x00, 0x44, 0xf6, 0x12, 0x00, 0x80, 0xb3, 0x00, 0xb3, 0x00, 0x01, 0x83, 0x00, 0x45, 0x02,
+  0x13, 0x00, 0x80, 0x83, 0x00, 0x83, 0x00, 0x01, 0xd6, 0x01, 0x45, 0x0e, 0x13, 0x00, 0x80, 0xd6,
+  0x01, 0xd6, 0x01, 0x01, 0x47, 0x02, 0x50, 0x1a, 0x13, 0x00, 0x01, 0x47, 0x02, 0x49, 0x21, 0x13,
+  0x00, 0x01, 0x47, 0x02, 0x54, 0x28, 0x13, 0x00, 0x01, 0x47, 0x02, 0x41, 0x2f, 0x13, 0x00, 0x01,
+  0x47, 0x02, 0x4c, 0x36, 0x13, 0x00, 0x80, 0x47, 0x02, 0x47, 0x02, 0x80, 0x67, 0x01, 0x67, 0x01,
+  0x02, 0x0d, 0x01, 0x52, 0x4b, 0x13, 0x00, 0x53, 0x50, 0x13, 0x00, 0x80, 0x12, 0x01, 0x12, 0x01,
+  0x01, 0x0d, 0x01, 0x45, 0x57, 0x13, 0x00, 0x80, 0x0d, 0x01, 0x0d, 0x01, 0x80, 0x54, 0x00, 0x54,
+  0x00, 0x03, 0xa5, 0x01, 0x4e, 0x70, 0x13, 0x00, 0x52, 0x91, 0x13, 0x00, 0x53, 0x9d, 0x13, 0x00,
+  0x01, 0xa5, 0x01, 0x44, 0x77, 0x13, 0x00, 0x01, 0xa5, 0x01, 0x52, 0x7e, 0x13, 0x00, 0x01, 0xa5,
+  0x01, 0x45, 0x85, 0x13, 0x00, 0x01, 0xa5, 0x01, 0x44, 0x8c, 0x13, 0x00, 0x80, 0xa5, 0x01, 0xa5,
+  0x01, 0x01, 0xdb, 0x01, 0x54, 0x98, 0x13, 0x00, 0x80, 0xdb, 0x01, 0xdb, 0x01, 0x01, 0x41, 0x02,
+  0x42, 0xa4, 0x13, 0x00, 0x01, 0x41, 0x02, 0x41, 0xab, 0x13, 0x00, 0x01, 0x41, 0x02, 0x4e, 0xb2,
+  0x13, 0x00, 0x01, 0x41, 0x02, 0x44, 0xb9, 0x13, 0x00, 0x80, 0x41, 0x02, 0x41, 0x02, 0x86, 0x06,
+  0x00, 0x09, 0x00, 0x44, 0xdb, 0x13, 0x00, 0x46, 0xee, 0x13, 0x00, 0x4d, 0xf3, 0x13, 0x00, 0x4e,
+  0x29, 0x14, 0x00, 0x53, 0xc2, 0x14, 0x00, 0x54, 0xde, 0x14, 0x00, 0x01, 0x1f, 0x01, 0x45, 0xe2,
+  0x13, 0x00, 0x01, 0x1f, 0x01, 0x41, 0xe9, 0x13, 0x00, 0x80, 0x1f, 0x01, 0x1f, 0x01, 0x80, 0x2b,
+  0x00, 0x2b, 0x00, 0x01, 0x4d, 0x01, 0x50, 0xfa, 0x13, 0x00, 0x01, 0x4d, 0x01, 0x4f, 0x01, 0x14,
+  0x00, 0x01, 0x4d, 0x01, 0x52, 0x08, 0x14, 0x00, 0x01, 0x4d, 0x01, 0x54, 0x0f, 0x14, 0x00, 0x01,
+  0x4d, 0x01, 0x41, 0x16, 0x14, 0x00, 0x01, 0x4d, 0x01, 0x4e, 0x1d, 0x14, 0x00, 0x01, 0x4d, 0x01,
+  0x54, 0x24, 0x14, 0x00, 0x80, 0x4d, 0x01, 0x4d, 0x01, 0x84, 0x06, 0x00, 0x06, 0x00, 0x43, 0x3e,
+  0x14, 0x00, 0x46, 0x5f, 0x14, 0x00, 0x53, 0x9c, 0x14, 0x00, 0x54, 0xb6, 0x14, 0x00, 0x01, 0xbc,
+  0x00, 0x4c, 0x45, 0x14, 0x00, 0x01, 0xbc, 0x00, 0x55, 0x4c, 0x14, 0x00, 0x01, 0xbc, 0x00, 0x44,
+  0x53, 0x14, 0x00, 0x01, 0xbc, 0x00, 0x45, 0x5a, 0x14, 0x00, 0x80, 0xbc, 0x00, 0xbc, 0x00, 0x01,
+  0x22, 0x01, 0x4f, 0x66, 0x14, 0x00, 0x01, 0x22, 0x01, 0x52, 0x6d, 0x14, 0x00, 0x01, 0x22, 0x01,
+  0x4d, 0x74, 0x14, 0x00, 0x01, 0x22, 0x01, 0x41, 0x7b, 0x14, 0x00, 0x01, 0x22, 0x01, 0x54, 0x82,
+  0x14, 0x00, 0x01, 0x22, 0x01, 0x49, 0x89, 0x14, 0x00, 0x01, 0x22, 0x01, 0x4f, 0x90, 0x14, 0x00,
+  0x01, 0x22, 0x01, 0x4e, 0x97, 0x14, 0x00, 0x80, 0x22, 0x01, 0x22, 0x01, 0x01, 0x9b, 0x01, 0x49,
+  0xa3, 0x14, 0x00, 0x01, 0x9b, 0x01, 0x44, 0xaa, 0x14, 0x00, 0x01, 0x9b, 0x01, 0x45, 0xb1, 0x14,
+  0x00, 0x80, 0x9b, 0x01, 0x9b, 0x01, 0x01, 0x3d, 0x00, 0x4f, 0xbd, 0x14, 0x00, 0x80, 0x3d, 0x00,
+  0x3d, 0x00, 0x81, 0x64, 0x00, 0x64, 0x00, 0x53, 0xcb, 0x14, 0x00, 0x01, 0x09, 0x01, 0x55, 0xd2,
+  0x14, 0x00, 0x01, 0x09, 0x01, 0x45, 0xd9, 0x14, 0x00, 0x80, 0x09, 0x01, 0x09, 0x01, 0x81, 0x0a,
+  0x00, 0x0a, 0x00, 0x53, 0xe7, 0x14, 0x00, 0x80, 0x4c, 0x00, 0x4c, 0x00, 0x02, 0x38, 0x00, 0x4f,
+  0xf7, 0x14, 0x00, 0x55, 0x03, 0x15, 0x00, 0x01, 0x06, 0x01, 0x42, 0xfe, 0x14, 0x00, 0x80, 0x06,
+  0x01, 0x06, 0x01, 0x01, 0x38, 0x00, 0x53, 0x0a, 0x15, 0x00, 0x01, 0x38, 0x00, 0x54, 0x11, 0x15,
+  0x00, 0x80, 0x38, 0x00, 0x38, 0x00, 0x03, 0x3a, 0x00, 0x45, 0x25, 0x15, 0x00, 0x49, 0x38, 0x15,
+  0x00, 0x4e, 0x64, 0x15, 0x00, 0x01, 0xa8, 0x00, 0x45, 0x2c, 0x15, 0x00, 0x01, 0xa8, 0x00, 0x50,
+  0x33, 0x15, 0x00, 0x80, 0xa8, 0x00, 0xa8, 0x00, 0x03, 0xdd, 0x00, 0x44, 0x47, 0x15, 0x00, 0x4c,
+  0x4c, 0x15, 0x00, 0x4e, 0x58, 0x15, 0x00, 0x80, 0x20, 0x01, 0x20, 0x01, 0x01, 0xdd, 0x00, 0x4c,
+  0x53, 0x15, 0x00, 0x80, 0xdd, 0x00, 0xdd, 0x00, 0x01, 0x0b, 0x01, 0x44, 0x5f, 0x15, 0x00, 0x80,
+  0x0b, 0x01, 0x0b, 0x01, 0x01, 0x3a, 0x00, 0x4f, 0x6b, 0x15, 0x00, 0x01, 0x3a, 0x00, 0x57, 0x72,
+  0x15, 0x00, 0x81, 0x3a, 0x00, 0x3a, 0x00, 0x49, 0x7b, 0x15, 0x00, 0x01, 0xf2, 0x01, 0x4e, 0x82,
+  0x15, 0x00, 0x01, 0xf2, 0x01, 0x47, 0x89, 0x15, 0x00, 0x80, 0xf2, 0x01, 0xf2, 0x01, 0x05, 0x35,
+  0x00, 0x41, 0xa5, 0x15, 0x00, 0x45, 0xf1, 0x15, 0x00, 0x49, 0x6b, 0x16, 0x00, 0x4f, 0xf5, 0x16,
+  0x00, 0x55, 0x83, 0x17, 0x00, 0x04, 0x85, 0x00, 0x52, 0xb8, 0x15, 0x00, 0x53, 0xcb, 0x15, 0x00,
+  0x54, 0xd7, 0x15, 0x00, 0x57, 0xec, 0x15, 0x00, 0x01, 0x4a, 0x01, 0x47, 0xbf, 0x15, 0x00, 0x01,
+  0x4a, 0x01, 0x45, 0xc6, 0x15, 0x00, 0x80, 0x4a, 0x01, 0x4a, 0x01, 0x01, 0x53, 0x01, 0x54, 0xd2,
+  0x15, 0x00, 0x80, 0x53, 0x01, 0x53, 0x01, 0x01, 0x85, 0x00, 0x45, 0xde, 0x15, 0x00, 0x81, 0x85,
+  0x00, 0x93, 0x00, 0x52, 0xe7, 0x15, 0x00, 0x80, 0x85, 0x00, 0x85, 0x00, 0x80, 0x17, 0x01, 0x17,
+  0x01, 0x04, 0x91, 0x00, 0x41, 0x04, 0x16, 0x00, 0x46, 0x47, 0x16, 0x00, 0x54, 0x53, 0x16, 0x00,
+  0x56, 0x58, 0x16, 0x00, 0x03, 0x91, 0x00, 0x44, 0x13, 0x16, 0x00, 0x52, 0x18, 0x16, 0x00, 0x56,
+  0x24, 0x16, 0x00, 0x80, 0xc1, 0x00, 0xc1, 0x00, 0x01, 0xbf, 0x00, 0x4e, 0x1f, 0x16, 0x00, 0x80,
+  0xbf, 0x00, 0xbf, 0x00, 0x02, 0x91, 0x00, 0x45, 0x2f, 0x16, 0x00, 0x49, 0x34, 0x16, 0x00, 0x80,
+  0xa5, 0x00, 0xa5, 0x00, 0x01, 0x91, 0x00, 0x4e, 0x3b, 0x16, 0x00, 0x01, 0x91, 0x00, 0x47, 0x42,
+  0x16, 0x00, 0x80, 0x91, 0x00, 0x91, 0x00, 0x01, 0x98, 0x01, 0x54, 0x4e, 0x16, 0x00, 0x80, 0x98,
+  0x01, 0x98, 0x01, 0x80, 0xa9, 0x00, 0xa9, 0x00, 0x01, 0x26, 0x01, 0x45, 0x5f, 0x16, 0x00, 0x01,
+  0x26, 0x01, 0x4c, 0x66, 0x16, 0x00, 0x80, 0x26, 0x01, 0x26, 0x01, 0x06, 0x35, 0x00, 0x46, 0x86,
+  0x16, 0x00, 0x47, 0x92, 0x16, 0x00, 0x4b, 0xa5, 0x16, 0x00, 0x4e, 0xb1, 0x16, 0x00, 0x54, 0xc6,
+  0x16, 0x00, 0x56, 0xe0, 0x16, 0x00, 0x01, 0xeb, 0x00, 0x45, 0x8d, 0x16, 0x00, 0x80, 0xeb, 0x00,
+  0xeb, 0x00, 0x01, 0x71, 0x01, 0x48, 0x99, 0x16, 0x00, 0x01, 0x71, 0x01, 0x54, 0xa0, 0x16, 0x00,
+  0x80, 0x71, 0x01, 0x71, 0x01, 0x01, 0x35, 0x00, 0x45, 0xac, 0x16, 0x00, 0x80, 0x35, 0x00, 0x35,
+  0x00, 0x02, 0x14, 0x01, 0x45, 0xbc, 0x16, 0x00, 0x4b, 0xc1, 0x16, 0x00, 0x80, 0x14, 0x01, 0x14,
+  0x01, 0x80, 0xb5, 0x01, 0xb5, 0x01, 0x01, 0x43, 0x01, 0x54, 0xcd, 0x16, 0x00, 0x01, 0x43, 0x01,
+  0x4c, 0xd4, 0x16, 0x00, 0x01, 0x43, 0x01, 0x45, 0xdb, 0x16, 0x00, 0x80, 0x43, 0x01, 0x43, 0x01,
+  0x01, 0xb1, 0x00, 0x45, 0xe7, 0x16, 0x00, 0x81, 0xb1, 0x00, 0xb1, 0x00, 0x44, 0xf0, 0x16, 0x00,
+  0x80, 0x27, 0x02, 0x27, 0x02, 0x06, 0x49, 0x00, 0x4e, 0x10, 0x17, 0x00, 0x4f, 0x1c, 0x17, 0x00,
+  0x53, 0x4f, 0x17, 0x00, 0x54, 0x64, 0x17, 0x00, 0x56, 0x69, 0x17, 0x00, 0x57, 0x7e, 0x17, 0x00,
+  0x01, 0x41, 0x01, 0x47, 0x17, 0x17, 0x00, 0x80, 0x41, 0x01, 0x41, 0x01, 0x01, 0x49, 0x00, 0x4b,
+  0x23, 0x17, 0x00, 0x82, 0x49, 0x00, 0x49, 0x00, 0x45, 0x30, 0x17, 0x00, 0x49, 0x3c, 0x17, 0x00,
+  0x01, 0x23, 0x02, 0x44, 0x37, 0x17, 0x00, 0x80, 0x23, 0x02, 0x23, 0x02, 0x01, 0xf3, 0x01, 0x4e,
+  0x43, 0x17, 0x00, 0x01, 0xf3, 0x01, 0x47, 0x4a, 0x17, 0x00, 0x80, 0xf3, 0x01, 0xf3, 0x01, 0x02,
+  0xba, 0x00, 0x45, 0x5a, 0x17, 0x00, 0x54, 0x5f, 0x17, 0x00, 0x80, 0xba, 0x00, 0xba, 0x00, 0x80,
+  0xb7, 0x01, 0xb7, 0x01, 0x80, 0x01, 0x01, 0x01, 0x01, 0x01, 0xd1, 0x00, 0x45, 0x70, 0x17, 0x00,
+  0x81, 0xd1, 0x00, 0xd1, 0x00, 0x44, 0x79, 0x17, 0x00, 0x80, 0x28, 0x02, 0x28, 0x02, 0x80, 0x59,
+  0x01, 0x59, 0x01, 0x01, 0xce, 0x01, 0x4e, 0x8a, 0x17, 0x00, 0x01, 0xce, 0x01, 0x43, 0x91, 0x17,
+  0x00, 0x01, 0xce, 0x01, 0x48, 0x98, 0x17, 0x00, 0x80, 0xce, 0x01, 0xce, 0x01, 0x06, 0x21, 0x00,
+  0x41, 0xb8, 0x17, 0x00, 0x45, 0x5b, 0x18, 0x00, 0x49, 0xd5, 0x18, 0x00, 0x4f, 0x1d, 0x19, 0x00,
+  0x55, 0xdc, 0x19, 0x00, 0x59, 0xff, 0x19, 0x00, 0x07, 0x33, 0x00, 0x44, 0xd7, 0x17, 0x00, 0x4a,
+  0xe3, 0x17, 0x00, 0x4b, 0xf6, 0x17, 0x00, 0x4e, 0x19, 0x18, 0x00, 0x50, 0x27, 0x18, 0x00, 0x52,
+  0x2c, 0x18, 0x00, 0x59, 0x46, 0x18, 0x00, 0x01, 0x6d, 0x00, 0x45, 0xde, 0x17, 0x00, 0x80, 0x6d,
+  0x00, 0x6d, 0x00, 0x01, 0x55, 0x01, 0x4f, 0xea, 0x17, 0x00, 0x01, 0x55, 0x01, 0x52, 0xf1, 0x17,
+  0x00, 0x80, 0x55, 0x01, 0x55, 0x01, 0x02, 0x33, 0x00, 0x45, 0x01, 0x18, 0x00, 0x49, 0x06, 0x18,
+  0x00, 0x80, 0x33, 0x00, 0x33, 0x00, 0x01, 0xef, 0x01, 0x4e, 0x0d, 0x18, 0x00, 0x01, 0xef, 0x01,
+  0x47, 0x14, 0x18, 0x00, 0x80, 0xef, 0x01, 0xef, 0x01, 0x81, 0x9d, 0x00, 0xe7, 0x00, 0x59, 0x22,
+  0x18, 0x00, 0x80, 0x9d, 0x00, 0x9d, 0x00, 0x80, 0x34, 0x02, 0x34, 0x02, 0x01, 0x46, 0x02, 0x4b,
+  0x33, 0x18, 0x00, 0x01, 0x46, 0x02, 0x45, 0x3a, 0x18, 0x00, 0x01, 0x46, 0x02, 0x54, 0x41, 0x18,
+  0x00, 0x80, 0x46, 0x02, 0x46, 0x02, 0x81, 0x81, 0x01, 0xe7, 0x01, 0x42, 0x4f, 0x18, 0x00, 0x01,
+  0x81, 0x01, 0x45, 0x56, 0x18, 0x00, 0x80, 0x81, 0x01, 0x81, 0x01, 0x84, 0x31, 0x00, 0x31, 0x00,
+  0x41, 0x70, 0x18, 0x00, 0x45, 0x7c, 0x18, 0x00, 0x4d, 0x88, 0x18, 0x00, 0x53, 0xa2, 0x18, 0x00,
+  0x01, 0xa7, 0x00, 0x4e, 0x77, 0x18, 0x00, 0x80, 0xa7, 0x00, 0xa7, 0x00, 0x01, 0x82, 0x00, 0x54,
+  0x83, 0x18, 0x00, 0x80, 0x82, 0x00, 0x82, 0x00, 0x01, 0x16, 0x01, 0x42, 0x8f, 0x18, 0x00, 0x01,
+  0x16, 0x01, 0x45, 0x96, 0x18, 0x00, 0x01, 0x16, 0x01, 0x52, 0x9d, 0x18, 0x00, 0x80, 0x16, 0x01,
+  0x16, 0x01, 0x02, 0x7f, 0x00, 0x48, 0xad, 0x18, 0x00, 0x53, 0xb2, 0x18, 0x00, 0x80, 0xb4, 0x01,
+  0xb4, 0x01, 0x01, 0x7f, 0x00, 0x41, 0xb9, 0x18, 0x00, 0x01, 0x7f, 0x00, 0x47, 0xc0, 0x18, 0x00,
+  0x01, 0x7f, 0x00, 0x45, 0xc7, 0x18, 0x00, 0x81, 0x7f, 0x00, 0x7f, 0x00, 0x53, 0xd0, 0x18, 0x00,
+  0x80, 0x35, 0x02, 0x35, 0x02, 0x03, 0x1e, 0x01, 0x47, 0xe4, 0x18, 0x00, 0x4e, 0xf7, 0x18, 0x00,
+  0x53, 0x11, 0x19, 0x00, 0x01, 0xe6, 0x01, 0x48, 0xeb, 0x18, 0x00, 0x01, 0xe6, 0x01, 0x54, 0xf2,
+  0x18, 0x00, 0x80, 0xe6, 0x01, 0xe6, 0x01, 0x01, 0x1e, 0x01, 0x55, 0xfe, 0x18, 0x00, 0x01, 0x1e,
+  0x01, 0x54, 0x05, 0x19, 0x00, 0x01, 0x1e, 0x01, 0x45, 0x0c, 0x19, 0x00, 0x80, 0x1e, 0x01, 0x1e,
+  0x01, 0x01, 0xd4, 0x01, 0x53, 0x18, 0x19, 0x00, 0x80, 0xd4, 0x01, 0xd4, 0x01, 0x06, 0x62, 0x00,
+  0x4d, 0x38, 0x19, 0x00, 0x4e, 0x54, 0x19, 0x00, 0x52, 0x77, 0x19, 0x00, 0x53, 0xa1, 0x19, 0x00,
+  0x54, 0xad, 0x19, 0x00, 0x56, 0xc7, 0x19, 0x00, 0x81, 0x35, 0x01, 0x3a, 0x02, 0x45, 0x41, 0x19,
+  0x00, 0x01, 0x35, 0x01, 0x4e, 0x48, 0x19, 0x00, 0x01, 0x35, 0x01, 0x54, 0x4f, 0x19, 0x00, 0x80,
+  0x35, 0x01, 0x35, 0x01, 0x02, 0xfd, 0x00, 0x45, 0x5f, 0x19, 0x00, 0x54, 0x6b, 0x19, 0x00, 0x01,
+  0xfd, 0x00, 0x59, 0x66, 0x19, 0x00, 0x80, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x01, 0x48, 0x72,
+  0x19, 0x00, 0x80, 0x00, 0x01, 0x00, 0x01, 0x02, 0x9c, 0x00, 0x45, 0x82, 0x19, 0x00, 0x4e, 0x87,
+  0x19, 0x00, 0x80, 0x9c, 0x00, 0x9c, 0x00, 0x01, 0x30, 0x01, 0x49, 0x8e, 0x19, 0x00, 0x01, 0x30,
+  0x01, 0x4e, 0x95, 0x19, 0x00, 0x01, 0x30, 0x01, 0x47, 0x9c, 0x19, 0x00, 0x80, 0x30, 0x01, 0x30,
+  0x01, 0x01, 0x62, 0x00, 0x54, 0xa8, 0x19, 0x00, 0x80, 0x62, 0x00, 0x62, 0x00, 0x01, 0xfb, 0x00,
+  0x48, 0xb4, 0x19, 0x00, 0x01, 0xfb, 0x00, 0x45, 0xbb, 0x19, 0x00, 0x01, 0xfb, 0x00, 0x52, 0xc2,
+  0x19, 0x00, 0x80, 0xfb, 0x00, 0xfb, 0x00, 0x01, 0xb0, 0x00, 0x45, 0xce, 0x19, 0x00, 0x81, 0xb0,
+  0x00, 0xb0, 0x00, 0x44, 0xd7, 0x19, 0x00, 0x80, 0x26, 0x02, 0x26, 0x02, 0x02, 0x9b, 0x00, 0x43,
+  0xe7, 0x19, 0x00, 0x53, 0xf3, 0x19, 0x00, 0x01, 0x9b, 0x00, 0x48, 0xee, 0x19, 0x00, 0x80, 0x9b,
+  0x00, 0x9b, 0x00, 0x01, 0xe5, 0x01, 0x54, 0xfa, 0x19, 0x00, 0x80, 0xe5, 0x01, 0xe5, 0x01, 0x80,
+  0x21, 0x00, 0x21, 0x00, 0x05, 0x0c, 0x00, 0x41, 0x1b, 0x1a, 0x00, 0x45, 0x2e, 0x1a, 0x00, 0x49,
+  0xe2, 0x1a, 0x00, 0x4f, 0x1c, 0x1b, 0x00, 0x55, 0x96, 0x1b, 0x00, 0x01, 0x1b, 0x01, 0x4d, 0x22,
+  0x1a, 0x00, 0x01, 0x1b, 0x01, 0x45, 0x29, 0x1a, 0x00, 0x80, 0x1b, 0x01, 0x1b, 0x01, 0x07, 0x5b,
+  0x00, 0x41, 0x4d, 0x1a, 0x00, 0x45, 0x59, 0x1a, 0x00, 0x47, 0x75, 0x1a, 0x00, 0x49, 0x9d, 0x1a,
+  0x00, 0x56, 0xbe, 0x1a, 0x00, 0x57, 0xd1, 0x1a, 0x00, 0x58, 0xd6, 0x1a, 0x00, 0x01, 0x99, 0x01,
+  0x52, 0x54, 0x1a, 0x00, 0x80, 0x99, 0x01, 0x99, 0x01, 0x01, 0x8c, 0x00, 0x44, 0x60, 0x1a, 0x00,
+  0x81, 0x8c, 0x00, 0x8c, 0x00, 0x45, 0x69, 0x1a, 0x00, 0x01, 0x22, 0x02, 0x44, 0x70, 0x1a, 0x00,
+  0x80, 0x22, 0x02, 0x22, 0x02, 0x01, 0xe2, 0x01, 0x41, 0x7c, 0x1a, 0x00, 0x01, 0xe2, 0x01, 0x54,
+  0x83, 0x1a, 0x00, 0x01, 0xe2, 0x01, 0x49, 0x8a, 0x1a, 0x00, 0x01, 0xe2, 0x01, 0x56, 0x91, 0x1a,
+  0x00, 0x01, 0xe2, 0x01, 0x45, 0x98, 0x1a, 0x00, 0x80, 0xe2, 0x01, 0xe2, 0x01, 0x01, 0x02, 0x02,
+  0x54, 0xa4, 0x1a, 0x00, 0x01, 0x02, 0x02, 0x48, 0xab, 0x1a, 0x00, 0x01, 0x02, 0x02, 0x45, 0xb2,
+  0x1a, 0x00, 0x01, 0x02, 0x02, 0x52, 0xb9, 0x1a, 0x00, 0x80, 0x02, 0x02, 0x02, 0x02, 0x01, 0x73,
+  0x01, 0x45, 0xc5, 0x1a, 0x00, 0x01, 0x73, 0x01, 0x52, 0xcc, 0x1a, 0x00, 0x80, 0x73, 0x01, 0x73,
+  0x01, 0x80, 0x5b, 0x00, 0x5b, 0x00, 0x01, 0x4b, 0x01, 0x54, 0xdd, 0x1a, 0x00, 0x80, 0x4b, 0x01,
+  0x4b, 0x01, 0x03, 0xf7, 0x00, 0x43, 0xf1, 0x1a, 0x00, 0x47, 0xfd, 0x1a, 0x00, 0x4e, 0x10, 0x1b,
+  0x00, 0x01, 0x6c, 0x01, 0x45, 0xf8, 0x1a, 0x00, 0x80, 0x6c, 0x01, 0x6c, 0x01, 0x01, 0xf7, 0x00,
+  0x48, 0x04, 0x1b, 0x00, 0x01, 0xf7, 0x00, 0x54, 0x0b, 0x1b, 0x00, 0x80, 0xf7, 0x00, 0xf7, 0x00,
+  0x01, 0xa3, 0x01, 0x45, 0x17, 0x1b, 0x00, 0x80, 0xa3, 0x01, 0xa3, 0x01, 0x85, 0x0c, 0x00, 0x37,
+  0x00, 0x42, 0x35, 0x1b, 0x00, 0x44, 0x4f, 0x1b, 0x00, 0x52, 0x5b, 0x1b, 0x00, 0x54, 0x6e, 0x1b,
+  0x00, 0x57, 0x91, 0x1b, 0x00, 0x01, 0x0c, 0x02, 0x4f, 0x3c, 0x1b, 0x00, 0x01, 0x0c, 0x02, 0x44,
+  0x43, 0x1b, 0x00, 0x01, 0x0c, 0x02, 0x59, 0x4a, 0x1b, 0x00, 0x80, 0x0c, 0x02, 0x0c, 0x02, 0x01,
+  0xb3, 0x01, 0x45, 0x56, 0x1b, 0x00, 0x80, 0xb3, 0x01, 0xb3, 0x01, 0x01, 0x94, 0x01, 0x54, 0x62,
+  0x1b, 0x00, 0x01, 0x94, 0x01, 0x48, 0x69, 0x1b, 0x00, 0x80, 0x94, 0x01, 0x94, 0x01, 0x81, 0x0c,
+  0x00, 0x0c, 0x00, 0x48, 0x77, 0x1b, 0x00, 0x01, 0x06, 0x02, 0x49, 0x7e, 0x1b, 0x00, 0x01, 0x06,
+  0x02, 0x4e, 0x85, 0x1b, 0x00, 0x01, 0x06, 0x02, 0x47, 0x8c, 0x1b, 0x00, 0x80, 0x06, 0x02, 0x06,
+  0x02, 0x80, 0x48, 0x00, 0x48, 0x00, 0x01, 0xf6, 0x00, 0x4d, 0x9d, 0x1b, 0x00, 0x01, 0xf6, 0x00,
+  0x42, 0xa4, 0x1b, 0x00, 0x01, 0xf6, 0x00, 0x45, 0xab, 0x1b, 0x00, 0x01, 0xf6, 0x00, 0x52, 0xb2,
+  0x1b, 0x00, 0x80, 0xf6, 0x00, 0xf6, 0x00, 0x0a, 0x03, 0x00, 0x46, 0xe2, 0x1b, 0x00, 0x4b, 0x2e,
+  0x1c, 0x00, 0x4c, 0x43, 0x1c, 0x00, 0x4e, 0x4f, 0x1c, 0x00, 0x50, 0x6d, 0x1c, 0x00, 0x52, 0x80,
+  0x1c, 0x00, 0x54, 0x85, 0x1c, 0x00, 0x55, 0xa8, 0x1c, 0x00, 0x56, 0xdb, 0x1c, 0x00, 0x57, 0xee,
+  0x1c, 0x00, 0x82, 0x03, 0x00, 0x03, 0x00, 0x46, 0xef, 0x1b, 0x00, 0x54, 0x1b, 0x1c, 0x00, 0x82,
+  0xcf, 0x00, 0x7e, 0x01, 0x45, 0xfc, 0x1b, 0x00, 0x49, 0x08, 0x1c, 0x00, 0x01, 0xcf, 0x00, 0x52,
+  0x03, 0x1c, 0x00, 0x80, 0xcf, 0x00, 0xcf, 0x00, 0x01, 0x27, 0x01, 0x43, 0x0f, 0x1c, 0x00, 0x01,
+  0x27, 0x01, 0x45, 0x16, 0x1c, 0x00, 0x80, 0x27, 0x01, 0x27, 0x01, 0x01, 0x74, 0x01, 0x45, 0x22,
+  0x1c, 0x00, 0x01, 0x74, 0x01, 0x4e, 0x29, 0x1c, 0x00, 0x80, 0x74, 0x01, 0x74, 0x01, 0x81, 0x71,
+  0x00, 0x71, 0x00, 0x41, 0x37, 0x1c, 0x00, 0x01, 0x72, 0x00, 0x59, 0x3e, 0x1c, 0x00, 0x80, 0x72,
+  0x00, 0x72, 0x00, 0x01, 0x45, 0x01, 0x44, 0x4a, 0x1c, 0x00, 0x80, 0x45, 0x01, 0x45, 0x01, 0x82,
+  0x0d, 0x00, 0x0d, 0x00, 0x45, 0x5c, 0x1c, 0x00, 0x4c, 0x61, 0x1c, 0x00, 0x80, 0x22, 0x00, 0x22,
+  0x00, 0x01, 0x4a, 0x00, 0x59, 0x68, 0x1c, 0x00, 0x80, 0x4a, 0x00, 0x4a, 0x00, 0x01, 0xcc, 0x00,
+  0x45, 0x74, 0x1c, 0x00, 0x01, 0xcc, 0x00, 0x4e, 0x7b, 0x1c, 0x00, 0x80, 0xcc, 0x00, 0xcc, 0x00,
+  0x80, 0x1e, 0x00, 0x1e, 0x00, 0x01, 0x45, 0x00, 0x48, 0x8c, 0x1c, 0x00, 0x01, 0x45, 0x00, 0x45,
+  0x93, 0x1c, 0x00, 0x01, 0x45, 0x00, 0x52, 0x9a, 0x1c, 0x00, 0x81, 0x45, 0x00, 0x45, 0x00, 0x53,
+  0xa3, 0x1c, 0x00, 0x80, 0x25, 0x01, 0x25, 0x01, 0x02, 0x2a, 0x00, 0x52, 0xb3, 0x1c, 0x00, 0x54,
+  0xb8, 0x1c, 0x00, 0x80, 0x55, 0x00, 0x55, 0x00, 0x81, 0x2a, 0x00, 0x2a, 0x00, 0x53, 0xc1, 0x1c,
+  0x00, 0x01, 0x9c, 0x01, 0x49, 0xc8, 0x1c, 0x00, 0x01, 0x9c, 0x01, 0x44, 0xcf, 0x1c, 0x00, 0x01,
+  0x9c, 0x01, 0x45, 0xd6, 0x1c, 0x00, 0x80, 0x9c, 0x01, 0x9c, 0x01, 0x01, 0x4d, 0x00, 0x45, 0xe2,
+  0x1c, 0x00, 0x01, 0x4d, 0x00, 0x52, 0xe9, 0x1c, 0x00, 0x80, 0x4d, 0x00, 0x4d, 0x00, 0x01, 0x44,
+  0x01, 0x4e, 0xf5, 0x1c, 0x00, 0x80, 0x44, 0x01, 0x44, 0x01, 0x08, 0x3c, 0x00, 0x41, 0x1d, 0x1d,
+  0x00, 0x45, 0x5b, 0x1d, 0x00, 0x48, 0xb8, 0x1d, 0x00, 0x49, 0xd2, 0x1d, 0x00, 0x4c, 0xf5, 0x1d,
+  0x00, 0x4f, 0x48, 0x1e, 0x00, 0x52, 0x97, 0x1e, 0x00, 0x55, 0x53, 0x1f, 0x00, 0x03, 0xbb, 0x00,
+  0x52, 0x2c, 0x1d, 0x00, 0x53, 0x41, 0x1d, 0x00, 0x59, 0x56, 0x1d, 0x00, 0x01, 0xed, 0x00, 0x54,
+  0x33, 0x1d, 0x00, 0x81, 0xed, 0x00, 0xed, 0x00, 0x59, 0x3c, 0x1d, 0x00, 0x80, 0x2e, 0x01, 0x2e,
+  0x01, 0x02, 0xe1, 0x00, 0x53, 0x4c, 0x1d, 0x00, 0x54, 0x51, 0x1d, 0x00, 0x80, 0xe1, 0x00, 0xe1,
+  0x00, 0x80, 0x63, 0x01, 0x63, 0x01, 0x80, 0xbb, 0x00, 0xbb, 0x00, 0x02, 0x3c, 0x00, 0x4f, 0x66,
+  0x1d, 0x00, 0x52, 0x80, 0x1d, 0x00, 0x01, 0x3c, 0x00, 0x50, 0x6d, 0x1d, 0x00, 0x01, 0x3c, 0x00,
+  0x4c, 0x74, 0x1d, 0x00, 0x01, 0x3c, 0x00, 0x45, 0x7b, 0x1d, 0x00, 0x80, 0x3c, 0x00, 0x3c, 0x00,
+  0x02, 0x2a, 0x01, 0x48, 0x8b, 0x1d, 0x00, 0x53, 0xa5, 0x1d, 0x00, 0x01, 0x82, 0x01, 0x41, 0x92,
+  0x1d, 0x00, 0x01, 0x82, 0x01, 0x50, 0x99, 0x1d, 0x00, 0x01, 0x82, 0x01, 0x53, 0xa0, 0x1d, 0x00,
+  0x80, 0x82, 0x01, 0x82, 0x01, 0x01, 0x2a, 0x01, 0x4f, 0xac, 0x1d, 0x00, 0x01, 0x2a, 0x01, 0x4e,
+  0xb3, 0x1d, 0x00, 0x80, 0x2a, 0x01, 0x2a, 0x01, 0x01, 0x32, 0x02, 0x4f, 0xbf, 0x1d, 0x00, 0x01,
+  0x32, 0x02, 0x4e, 0xc6, 0x1d, 0x00, 0x01, 0x32, 0x02, 0x45, 0xcd, 0x1d, 0x00, 0x80, 0x32, 0x02,
+  0x32, 0x02, 0x02, 0xb9, 0x01, 0x43, 0xdd, 0x1d, 0x00, 0x4e, 0xe9, 0x1d, 0x00, 0x01, 0x2f, 0x02,
+  0x4b, 0xe4, 0x1d, 0x00, 0x80, 0x2f, 0x02, 0x2f, 0x02, 0x01, 0xb9, 0x01, 0x47, 0xf0, 0x1d, 0x00,
+  0x80, 0xb9, 0x01, 0xb9, 0x01, 0x02, 0x7a, 0x00, 0x41, 0x00, 0x1e, 0x00, 0x45, 0x2e, 0x1e, 0x00,
+  0x03, 0xae, 0x00, 0x43, 0x0f, 0x1e, 0x00, 0x4e, 0x1b, 0x1e, 0x00, 0x59, 0x29, 0x1e, 0x00, 0x01,
+  0xee, 0x00, 0x45, 0x16, 0x1e, 0x00, 0x80, 0xee, 0x00, 0xee, 0x00, 0x81, 0x38, 0x02, 0x38, 0x02,
+  0x53, 0x24, 0x1e, 0x00, 0x80, 0x39, 0x02, 0x39, 0x02, 0x80, 0xae, 0x00, 0xae, 0x00, 0x01, 0x7a,
+  0x00, 0x41, 0x35, 0x1e, 0x00, 0x01, 0x7a, 0x00, 0x53, 0x3c, 0x1e, 0x00, 0x01, 0x7a, 0x00, 0x45,
+  0x43, 0x1e, 0x00, 0x80, 0x7a, 0x00, 0x7a, 0x00, 0x03, 0xf8, 0x00, 0x49, 0x57, 0x1e, 0x00, 0x4c,
+  0x6a, 0x1e, 0x00, 0x57, 0x84, 0x1e, 0x00, 0x01, 0xf8, 0x00, 0x4e, 0x5e, 0x1e, 0x00, 0x01, 0xf8,
+  0x00, 0x54, 0x65, 0x1e, 0x00, 0x80, 0xf8, 0x00, 0xf8, 0x00, 0x01, 0x49, 0x02, 0x49, 0x71, 0x1e,
+  0x00, 0x01, 0x49, 0x02, 0x43, 0x78, 0x1e, 0x00, 0x01, 0x49, 0x02, 0x45, 0x7f, 0x1e, 0x00, 0x80,
+  0x49, 0x02, 0x49, 0x02, 0x01, 0x11, 0x01, 0x45, 0x8b, 0x1e, 0x00, 0x01, 0x11, 0x01, 0x52, 0x92,
+  0x1e, 0x00, 0x80, 0x11, 0x01, 0x11, 0x01, 0x03, 0xb7, 0x00, 0x45, 0xa6, 0x1e, 0x00, 0x49, 0xd5,
+  0x1e, 0x00, 0x4f, 0xf6, 0x1e, 0x00, 0x01, 0x1c, 0x01, 0x53, 0xad, 0x1e, 0x00, 0x01, 0x1c, 0x01,
+  0x49, 0xb4, 0x1e, 0x00, 0x01, 0x1c, 0x01, 0x44, 0xbb, 0x1e, 0x00, 0x01, 0x1c, 0x01, 0x45, 0xc2,
+  0x1e, 0x00, 0x01, 0x1c, 0x01, 0x4e, 0xc9, 0x1e, 0x00, 0x01, 0x1c, 0x01, 0x54, 0xd0, 0x1e, 0x00,
+  0x80, 0x1c, 0x01, 0x1c, 0x01, 0x01, 0x62, 0x01, 0x56, 0xdc, 0x1e, 0x00, 0x01, 0x62, 0x01, 0x41,
+  0xe3, 0x1e, 0x00, 0x01, 0x62, 0x01, 0x54, 0xea, 0x1e, 0x00, 0x01, 0x62, 0x01, 0x45, 0xf1, 0x1e,
+  0x00, 0x80, 0x62, 0x01, 0x62, 0x01, 0x03, 0xb7, 0x00, 0x42, 0x05, 0x1f, 0x00, 0x47, 0x1f, 0x1f,
+  0x00, 0x56, 0x39, 0x1f, 0x00, 0x01, 0x40, 0x01, 0x4c, 0x0c, 0x1f, 0x00, 0x01, 0x40, 0x01, 0x45,
+  0x13, 0x1f, 0x00, 0x01, 0x40, 0x01, 0x4d, 0x1a, 0x1f, 0x00, 0x80, 0x40, 0x01, 0x40, 0x01, 0x01,
+  0xf3, 0x00, 0x52, 0x26, 0x1f, 0x00, 0x01, 0xf3, 0x00, 0x41, 0x2d, 0x1f, 0x00, 0x01, 0xf3, 0x00,
+  0x4d, 0x34, 0x1f, 0x00, 0x80, 0xf3, 0x00, 0xf3, 0x00, 0x01, 0xb7, 0x00, 0x49, 0x40, 0x1f, 0x00,
+  0x01, 0xb7, 0x00, 0x44, 0x47, 0x1f, 0x00, 0x01, 0xb7, 0x00, 0x45, 0x4e, 0x1f, 0x00, 0x80, 0xb7,
+  0x00, 0xb7, 0x00, 0x03, 0xa6, 0x00, 0x42, 0x62, 0x1f, 0x00, 0x4c, 0x7c, 0x1f, 0x00, 0x54, 0x88,
+  0x1f, 0x00, 0x01, 0x4f, 0x01, 0x4c, 0x69, 0x1f, 0x00, 0x01, 0x4f, 0x01, 0x49, 0x70, 0x1f, 0x00,
+  0x01, 0x4f, 0x01, 0x43, 0x77, 0x1f, 0x00, 0x80, 0x4f, 0x01, 0x4f, 0x01, 0x01, 0xe6, 0x00, 0x4c,
+  0x83, 0x1f, 0x00, 0x80, 0xe6, 0x00, 0xe6, 0x00, 0x80, 0xa6, 0x00, 0xa6, 0x00, 0x01, 0xf4, 0x00,
+  0x55, 0x94, 0x1f, 0x00, 0x02, 0xf4, 0x00, 0x45, 0x9f, 0x1f, 0x00, 0x49, 0xc7, 0x1f, 0x00, 0x01,
+  0xf4, 0x00, 0x53, 0xa6, 0x1f, 0x00, 0x01, 0xf4, 0x00, 0x54, 0xad, 0x1f, 0x00, 0x01, 0xf4, 0x00,
+  0x49, 0xb4, 0x1f, 0x00, 0x01, 0xf4, 0x00, 0x4f, 0xbb, 0x1f, 0x00, 0x01, 0xf4, 0x00, 0x4e, 0xc2,
+  0x1f, 0x00, 0x80, 0xf4, 0x00, 0xf4, 0x00, 0x01, 0x6e, 0x01, 0x43, 0xce, 0x1f, 0x00, 0x01, 0x6e,
+  0x01, 0x4b, 0xd5, 0x1f, 0x00, 0x80, 0x6e, 0x01, 0x6e, 0x01, 0x05, 0xaf, 0x00, 0x41, 0xf1, 0x1f,
+  0x00, 0x45, 0x42, 0x20, 0x00, 0x49, 0xda, 0x21, 0x00, 0x4f, 0x1b, 0x22, 0x00, 0x55, 0x6c, 0x22,
+  0x00, 0x03, 0xe0, 0x00, 0x44, 0x00, 0x20, 0x00, 0x49, 0x13, 0x20, 0x00, 0x4e, 0x2f, 0x20, 0x00,
+  0x01, 0xaf, 0x01, 0x49, 0x07, 0x20, 0x00, 0x01, 0xaf, 0x01, 0x4f, 0x0e, 0x20, 0x00, 0x80, 0xaf,
+  0x01, 0xaf, 0x01, 0x02, 0xe0, 0x00, 0x4e, 0x1e, 0x20, 0x00, 0x53, 0x23, 0x20, 0x00, 0x80, 0x4a,
+  0x02, 0x4a, 0x02, 0x01, 0xe0, 0x00, 0x45, 0x2a, 0x20, 0x00, 0x80, 0xe0, 0x00, 0xe0, 0x00, 0x01,
+  0xb6, 0x01, 0x47, 0x36, 0x20, 0x00, 0x01, 0xb6, 0x01, 0x45, 0x3d, 0x20, 0x00, 0x80, 0xb6, 0x01,
+  0xb6, 0x01, 0x08, 0xc7, 0x00, 0x41, 0x65, 0x20, 0x00, 0x43, 0xba, 0x20, 0x00, 0x44, 0xe2, 0x20,
+  0x00, 0x4c, 0xe7, 0x20, 0x00, 0x4d, 0xfa, 0x20, 0x00, 0x50, 0x39, 0x21, 0x00, 0x51, 0x7a, 0x21,
+  0x00, 0x53, 0x9b, 0x21, 0x00, 0x04, 0xc7, 0x00, 0x43, 0x78, 0x20, 0x00, 0x44, 0x84, 0x20, 0x00,
+  0x4c, 0x92, 0x20, 0x00, 0x53, 0xa7, 0x20, 0x00, 0x01, 0xdc, 0x00, 0x48, 0x7f, 0x20, 0x00, 0x80,
+  0xdc, 0x00, 0xdc, 0x00, 0x81, 0xc7, 0x00, 0xc7, 0x00, 0x59, 0x8d, 0x20, 0x00, 0x80, 0x6b, 0x01,
+  0x6b, 0x01, 0x81, 0x5a, 0x01, 0x5a, 0x01, 0x4c, 0x9b, 0x20, 0x00, 0x01, 0x80, 0x01, 0x59, 0xa2,
+  0x20, 0x00, 0x80, 0x80, 0x01, 0x80, 0x01, 0x01, 0x31, 0x01, 0x4f, 0xae, 0x20, 0x00, 0x01, 0x31,
+  0x01, 0x4e, 0xb5, 0x20, 0x00, 0x80, 0x31, 0x01, 0x31, 0x01, 0x01, 0xe0, 0x01, 0x45, 0xc1, 0x20,
+  0x00, 0x01, 0xe0, 0x01, 0x49, 0xc8, 0x20, 0x00, 0x01, 0xe0, 0x01, 0x56, 0xcf, 0x20, 0x00, 0x01,
+  0xe0, 0x01, 0x45, 0xd6, 0x20, 0x00, 0x01, 0xe0, 0x01, 0x44, 0xdd, 0x20, 0x00, 0x80, 0xe0, 0x01,
+  0xe0, 0x01, 0x80, 0xa9, 0x01, 0xa9, 0x01, 0x01, 0xbc, 0x01, 0x41, 0xee, 0x20, 0x00, 0x01, 0xbc,
+  0x01, 0x59, 0xf5, 0x20, 0x00, 0x80, 0xbc, 0x01, 0xbc, 0x01, 0x02, 0xd0, 0x00, 0x41, 0x05, 0x21,
+  0x00, 0x45, 0x18, 0x21, 0x00, 0x01, 0xde, 0x00, 0x49, 0x0c, 0x21, 0x00, 0x01, 0xde, 0x00, 0x4e,
+  0x13, 0x21, 0x00, 0x80, 0xde, 0x00, 0xde, 0x00, 0x01, 0xd0, 0x00, 0x4d, 0x1f, 0x21, 0x00, 0x01,
+  0xd0, 0x00, 0x42, 0x26, 0x21, 0x00, 0x01, 0xd0, 0x00, 0x45, 0x2d, 0x21, 0x00, 0x01, 0xd0, 0x00,
+  0x52, 0x34, 0x21, 0x00, 0x80, 0xd0, 0x00, 0xd0, 0x00, 0x03, 0xe4, 0x00, 0x45, 0x48, 0x21, 0x00,
+  0x4c, 0x5b, 0x21, 0x00, 0x4f, 0x67, 0x21, 0x00, 0x01, 0xdf, 0x01, 0x41, 0x4f, 0x21, 0x00, 0x01,
+  0xdf, 0x01, 0x54, 0x56, 0x21, 0x00, 0x80, 0xdf, 0x01, 0xdf, 0x01, 0x01, 0x36, 0x02, 0x59, 0x62,
+  0x21, 0x00, 0x80, 0x36, 0x02, 0x36, 0x02, 0x01, 0xe4, 0x00, 0x52, 0x6e, 0x21, 0x00, 0x01, 0xe4,
+  0x00, 0x54, 0x75, 0x21, 0x00, 0x80, 0xe4, 0x00, 0xe4, 0x00, 0x01, 0xe3, 0x00, 0x55, 0x81, 0x21,
+  0x00, 0x01, 0xe3, 0x00, 0x49, 0x88, 0x21, 0x00, 0x01, 0xe3, 0x00, 0x52, 0x8f, 0x21, 0x00, 0x01,
+  0xe3, 0x00, 0x45, 0x96, 0x21, 0x00, 0x80, 0xe3, 0x00, 0xe3, 0x00, 0x02, 0x2f, 0x01, 0x45, 0xa6,
+  0x21, 0x00, 0x55, 0xc7, 0x21, 0x00, 0x01, 0x32, 0x01, 0x41, 0xad, 0x21, 0x00, 0x01, 0x32, 0x01,
+  0x52, 0xb4, 0x21, 0x00, 0x01, 0x32, 0x01, 0x43, 0xbb, 0x21, 0x00, 0x01, 0x32, 0x01, 0x48, 0xc2,
+  0x21, 0x00, 0x80, 0x32, 0x01, 0x32, 0x01, 0x01, 0x2f, 0x01, 0x4c, 0xce, 0x21, 0x00, 0x01, 0x2f,
+  0x01, 0x54, 0xd5, 0x21, 0x00, 0x80, 0x2f, 0x01, 0x2f, 0x01, 0x03, 0x02, 0x01, 0x44, 0xe9, 0x21,
+  0x00, 0x47, 0xf5, 0x21, 0x00, 0x56, 0x08, 0x22, 0x00, 0x01, 0x54, 0x02, 0x45, 0xf0, 0x21, 0x00,
+  0x80, 0x54, 0x02, 0x54, 0x02, 0x01, 0x02, 0x01, 0x48, 0xfc, 0x21, 0x00, 0x01, 0x02, 0x01, 0x54,
+  0x03, 0x22, 0x00, 0x80, 0x02, 0x01, 0x02, 0x01, 0x01, 0xbf, 0x01, 0x45, 0x0f, 0x22, 0x00, 0x01,
+  0xbf, 0x01, 0x52, 0x16, 0x22, 0x00, 0x80, 0xbf, 0x01, 0xbf, 0x01, 0x04, 0xfa, 0x00, 0x41, 0x2e,
+  0x22, 0x00, 0x47, 0x3a, 0x22, 0x00, 0x4f, 0x4d, 0x22, 0x00, 0x55, 0x59, 0x22, 0x00, 0x01, 0xbe,
+  0x01, 0x44, 0x35, 0x22, 0x00, 0x80, 0xbe, 0x01, 0xbe, 0x01, 0x01, 0xd3, 0x01, 0x45, 0x41, 0x22,
+  0x00, 0x01, 0xd3, 0x01, 0x52, 0x48, 0x22, 0x00, 0x80, 0xd3, 0x01, 0xd3, 0x01, 0x01, 0xfa, 0x00,
+  0x4d, 0x54, 0x22, 0x00, 0x80, 0xfa, 0x00, 0xfa, 0x00, 0x01, 0xbb, 0x01, 0x54, 0x60, 0x22, 0x00,
+  0x01, 0xbb, 0x01, 0x45, 0x67, 0x22, 0x00, 0x80, 0xbb, 0x01, 0xbb, 0x01, 0x01, 0xaf, 0x00, 0x4e,
+  0x73, 0x22, 0x00, 0x81, 0xaf, 0x00, 0xaf, 0x00, 0x4e, 0x7c, 0x22, 0x00, 0x01, 0xd1, 0x01, 0x49,
+  0x83, 0x22, 0x00, 0x01, 0xd1, 0x01, 0x4e, 0x8a, 0x22, 0x00, 0x01, 0xd1, 0x01, 0x47, 0x91, 0x22,
+  0x00, 0x80, 0xd1, 0x01, 0xd1, 0x01, 0x0d, 0x1b, 0x00, 0x41, 0xcd, 0x22, 0x00, 0x43, 0x12, 0x23,
+  0x00, 0x45, 0x33, 0x23, 0x00, 0x48, 0xf4, 0x23, 0x00, 0x49, 0x57, 0x24, 0x00, 0x4c, 0x04, 0x25,
+  0x00, 0x4d, 0x17, 0x25, 0x00, 0x4e, 0x31, 0x25, 0x00, 0x4f, 0x44, 0x25, 0x00, 0x50, 0x1f, 0x26,
+  0x00, 0x54, 0x67, 0x26, 0x00, 0x55, 0x84, 0x27, 0x00, 0x59, 0xd5, 0x27, 0x00, 0x05, 0x1b, 0x00,
+  0x44, 0xe4, 0x22, 0x00, 0x46, 0xe9, 0x22, 0x00, 0x49, 0xf5, 0x22, 0x00, 0x4d, 0x01, 0x23, 0x00,
+  0x59, 0x0d, 0x23, 0x00, 0x80, 0xd8, 0x01, 0xd8, 0x01, 0x01, 0x95, 0x00, 0x45, 0xf0, 0x22, 0x00,
+  0x80, 0x95, 0x00, 0x95, 0x00, 0x01, 0x6c, 0x00, 0x44, 0xfc, 0x22, 0x00, 0x80, 0x6c, 0x00, 0x6c,
+  0x00, 0x01, 0x51, 0x01, 0x45, 0x08, 0x23, 0x00, 0x80, 0x51, 0x01, 0x51, 0x01, 0x80, 0x1b, 0x00,
+  0x1b, 0x00, 0x01, 0x23, 0x01, 0x48, 0x19, 0x23, 0x00, 0x01, 0x23, 0x01, 0x4f, 0x20, 0x23, 0x00,
+  0x01, 0x23, 0x01, 0x4f, 0x27, 0x23, 0x00, 0x01, 0x23, 0x01, 0x4c, 0x2e, 0x23, 0x00, 0x80, 0x23,
+  0x01, 0x23, 0x01, 0x07, 0x44, 0x00, 0x43, 0x52, 0x23, 0x00, 0x45, 0x6c, 0x23, 0x00, 0x4c, 0x91,
+  0x23, 0x00, 0x4e, 0x9d, 0x23, 0x00, 0x52, 0xb2, 0x23, 0x00, 0x54, 0xdc, 0x23, 0x00, 0x56, 0xe1,
+  0x23, 0x00, 0x01, 0xa7, 0x01, 0x4f, 0x59, 0x23, 0x00, 0x01, 0xa7, 0x01, 0x4e, 0x60, 0x23, 0x00,
+  0x01, 0xa7, 0x01, 0x44, 0x67, 0x23, 0x00, 0x80, 0xa7, 0x01, 0xa7, 0x01, 0x82, 0x44, 0x00, 0x44,
+  0x00, 0x49, 0x79, 0x23, 0x00, 0x4d, 0x8c, 0x23, 0x00, 0x01, 0xf1, 0x01, 0x4e, 0x80, 0x23, 0x00,
+  0x01, 0xf1, 0x01, 0x47, 0x87, 0x23, 0x00, 0x80, 0xf1, 0x01, 0xf1, 0x01, 0x80, 0xab, 0x00, 0xab,
+  0x00, 0x01, 0xe2, 0x00, 0x4c, 0x98, 0x23, 0x00, 0x80, 0xe2, 0x00, 0xe2, 0x00, 0x02, 0x80, 0x00,
+  0x44, 0xa8, 0x23, 0x00, 0x54, 0xad, 0x23, 0x00, 0x80, 0x80, 0x00, 0x80, 0x00, 0x80, 0x81, 0x00,
+  0x81, 0x00, 0x01, 0xd5, 0x00, 0x56, 0xb9, 0x23, 0x00, 0x02, 0xd5, 0x00, 0x45, 0xc4, 0x23, 0x00,
+  0x49, 0xc9, 0x23, 0x00, 0x80, 0xd5, 0x00, 0xd5, 0x00, 0x01, 0x0e, 0x01, 0x43, 0xd0, 0x23, 0x00,
+  0x01, 0x0e, 0x01, 0x45, 0xd7, 0x23, 0x00, 0x80, 0x0e, 0x01, 0x0e, 0x01, 0x80, 0xbe, 0x00, 0xbe,
+  0x00, 0x01, 0xa1, 0x01, 0x45, 0xe8, 0x23, 0x00, 0x01, 0xa1, 0x01, 0x4e, 0xef, 0x23, 0x00, 0x80,
+  0xa1, 0x01, 0xa1, 0x01, 0x03, 0x1d, 0x00, 0x41, 0x03, 0x24, 0x00, 0x45, 0x16, 0x24, 0x00, 0x4f,
+  0x1b, 0x24, 0x00, 0x01, 0xe8, 0x01, 0x4c, 0x0a, 0x24, 0x00, 0x01, 0xe8, 0x01, 0x4c, 0x11, 0x24,
+  0x00, 0x80, 0xe8, 0x01, 0xe8, 0x01, 0x80, 0x1d, 0x00, 0x1d, 0x00, 0x04, 0xac, 0x00, 0x50, 0x2e,
+  0x24, 0x00, 0x52, 0x33, 0x24, 0x00, 0x55, 0x3f, 0x24, 0x00, 0x57, 0x52, 0x24, 0x00, 0x80, 0x44,
+  0x02, 0x44, 0x02, 0x01, 0x64, 0x01, 0x54, 0x3a, 0x24, 0x00, 0x80, 0x64, 0x01, 0x64, 0x01, 0x01,
+  0xe4, 0x01, 0x4c, 0x46, 0x24, 0x00, 0x01, 0xe4, 0x01, 0x44, 0x4d, 0x24, 0x00, 0x80, 0xe4, 0x01,
+  0xe4, 0x01, 0x80, 0xac, 0x00, 0xac, 0x00, 0x08, 0xb8, 0x00, 0x43, 0x7a, 0x24, 0x00, 0x44, 0x86,
+  0x24, 0x00, 0x47, 0x92, 0x24, 0x00, 0x4d, 0xac, 0x24, 0x00, 0x4e, 0xc6, 0x24, 0x00, 0x53, 0xe0,
+  0x24, 0x00, 0x54, 0xfa, 0x24, 0x00, 0x58, 0xff, 0x24, 0x00, 0x01, 0xda, 0x01, 0x4b, 0x81, 0x24,
+  0x00, 0x80, 0xda, 0x01, 0xda, 0x01, 0x01, 0x0a, 0x01, 0x45, 0x8d, 0x24, 0x00, 0x80, 0x0a, 0x01,
+  0x0a, 0x01, 0x01, 0xb0, 0x01, 0x4e, 0x99, 0x24, 0x00, 0x01, 0xb0, 0x01, 0x41, 0xa0, 0x24, 0x00,
+  0x01, 0xb0, 0x01, 0x4c, 0xa7, 0x24, 0x00, 0x80, 0xb0, 0x01, 0xb0, 0x01, 0x01, 0x66, 0x01, 0x50,
+  0xb3, 0x24, 0x00, 0x01, 0x66, 0x01, 0x4c, 0xba, 0x24, 0x00, 0x01, 0x66, 0x01, 0x45, 0xc1, 0x24,
+  0x00, 0x80, 0x66, 0x01, 0x66, 0x01, 0x01, 0x65, 0x01, 0x47, 0xcd, 0x24, 0x00, 0x01, 0x65, 0x01,
+  0x4c, 0xd4, 0x24, 0x00, 0x01, 0x65, 0x01, 0x45, 0xdb, 0x24, 0x00, 0x80, 0x65, 0x01, 0x65, 0x01,
+  0x01, 0x3d, 0x02, 0x54, 0xe7, 0x24, 0x00, 0x01, 0x3d, 0x02, 0x45, 0xee, 0x24, 0x00, 0x01, 0x3d,
+  0x02, 0x52, 0xf5, 0x24, 0x00, 0x80, 0x3d, 0x02, 0x3d, 0x02, 0x80, 0xb8, 0x00, 0xb8, 0x00, 0x80,
+  0xa0, 0x01, 0xa0, 0x01, 0x01, 0x6f, 0x01, 0x4f, 0x0b, 0x25, 0x00, 0x01, 0x6f, 0x01, 0x57, 0x12,
+  0x25, 0x00, 0x80, 0x6f, 0x01, 0x6f, 0x01, 0x01, 0x49, 0x01, 0x41, 0x1e, 0x25, 0x00, 0x01, 0x49,
+  0x01, 0x4c, 0x25, 0x25, 0x00, 0x01, 0x49, 0x01, 0x4c, 0x2c, 0x25, 0x00, 0x80, 0x49, 0x01, 0x49,
+  0x01, 0x01, 0x4b, 0x02, 0x4f, 0x38, 0x25, 0x00, 0x01, 0x4b, 0x02, 0x57, 0x3f, 0x25, 0x00, 0x80,
+  0x4b, 0x02, 0x4b, 0x02, 0x85, 0x28, 0x00, 0x28, 0x00, 0x4d, 0x5d, 0x25, 0x00, 0x4e, 0xe8, 0x25,
+  0x00, 0x4f, 0xed, 0x25, 0x00, 0x52, 0xf9, 0x25, 0x00, 0x55, 0x0c, 0x26, 0x00, 0x01, 0x41, 0x00,
+  0x45, 0x64, 0x25, 0x00, 0x83, 0x41, 0x00, 0x41, 0x00, 0x4f, 0x75, 0x25, 0x00, 0x54, 0x88, 0x25,
+  0x00, 0x57, 0xc7, 0x25, 0x00, 0x01, 0x09, 0x02, 0x4e, 0x7c, 0x25, 0x00, 0x01, 0x09, 0x02, 0x45,
+  0x83, 0x25, 0x00, 0x80, 0x09, 0x02, 0x09, 0x02, 0x02, 0x75, 0x01, 0x48, 0x93, 0x25, 0x00, 0x49,
+  0xad, 0x25, 0x00, 0x01, 0x05, 0x02, 0x49, 0x9a, 0x25, 0x00, 0x01, 0x05, 0x02, 0x4e, 0xa1, 0x25,
+  0x00, 0x01, 0x05, 0x02, 0x47, 0xa8, 0x25, 0x00, 0x80, 0x05, 0x02, 0x05, 0x02, 0x01, 0x75, 0x01,
+  0x4d, 0xb4, 0x25, 0x00, 0x01, 0x75, 0x01, 0x45, 0xbb, 0x25, 0x00, 0x01, 0x75, 0x01, 0x53, 0xc2,
+  0x25, 0x00, 0x80, 0x75, 0x01, 0x75, 0x01, 0x01, 0x0d, 0x02, 0x48, 0xce, 0x25, 0x00, 0x01, 0x0d,
+  0x02, 0x45, 0xd5, 0x25, 0x00, 0x01, 0x0d, 0x02, 0x52, 0xdc, 0x25, 0x00, 0x01, 0x0d, 0x02, 0x45,
+  0xe3, 0x25, 0x00, 0x80, 0x0d, 0x02, 0x0d, 0x02, 0x80, 0x3e, 0x02, 0x3e, 0x02, 0x01, 0x84, 0x00,
+  0x4e, 0xf4, 0x25, 0x00, 0x80, 0x84, 0x00, 0x84, 0x00, 0x01, 0x7b, 0x00, 0x52, 0x00, 0x26, 0x00,
+  0x01, 0x7b, 0x00, 0x59, 0x07, 0x26, 0x00, 0x80, 0x7b, 0x00, 0x7b, 0x00, 0x01, 0x95, 0x01, 0x54,
+  0x13, 0x26, 0x00, 0x01, 0x95, 0x01, 0x48, 0x1a, 0x26, 0x00, 0x80, 0x95, 0x01, 0x95, 0x01, 0x01,
+  0xc6, 0x00, 0x45, 0x26, 0x26, 0x00, 0x03, 0xc6, 0x00, 0x41, 0x35, 0x26, 0x00, 0x43, 0x41, 0x26,
+  0x00, 0x4e, 0x5b, 0x26, 0x00, 0x01, 0xc6, 0x00, 0x4b, 0x3c, 0x26, 0x00, 0x80, 0xc6, 0x00, 0xc6,
+  0x00, 0x01, 0x5e, 0x01, 0x49, 0x48, 0x26, 0x00, 0x01, 0x5e, 0x01, 0x41, 0x4f, 0x26, 0x00, 0x01,
+  0x5e, 0x01, 0x4c, 0x56, 0x26, 0x00, 0x80, 0x5e, 0x01, 0x5e, 0x01, 0x01, 0xca, 0x00, 0x44, 0x62,
+  0x26, 0x00, 0x80, 0xca, 0x00, 0xca, 0x00, 0x05, 0x8e, 0x00, 0x41, 0x7e, 0x26, 0x00, 0x49, 0xe8,
+  0x26, 0x00, 0x4f, 0xfb, 0x26, 0x00, 0x52, 0x40, 0x27, 0x00, 0x55, 0x5a, 0x27, 0x00, 0x04, 0xb9,
+  0x00, 0x4e, 0x91, 0x26, 0x00, 0x52, 0x9d, 0x26, 0x00, 0x54, 0xb9, 0x26, 0x00, 0x59, 0xd3, 0x26,
+  0x00, 0x01, 0xb9, 0x00, 0x44, 0x98, 0x26, 0x00, 0x80, 0xb9, 0x00, 0xb9, 0x00, 0x01, 0x1d, 0x02,
+  0x54, 0xa4, 0x26, 0x00, 0x81, 0x1d, 0x02, 0x29, 0x02, 0x45, 0xad, 0x26, 0x00, 0x01, 0x1d, 0x02,
+  0x44, 0xb4, 0x26, 0x00, 0x80, 0x1d, 0x02, 0x1d, 0x02, 0x01, 0xc8, 0x01, 0x49, 0xc0, 0x26, 0x00,
+  0x01, 0xc8, 0x01, 0x4f, 0xc7, 0x26, 0x00, 0x01, 0xc8, 0x01, 0x4e, 0xce, 0x26, 0x00, 0x80, 0xc8,
+  0x01, 0xc8, 0x01, 0x81, 0xd9, 0x00, 0xd9, 0x00, 0x45, 0xdc, 0x26, 0x00, 0x01, 0x1c, 0x02, 0x44,
+  0xe3, 0x26, 0x00, 0x80, 0x1c, 0x02, 0x1c, 0x02, 0x01, 0x77, 0x01, 0x4c, 0xef, 0x26, 0x00, 0x01,
+  0x77, 0x01, 0x4c, 0xf6, 0x26, 0x00, 0x80, 0x77, 0x01, 0x77, 0x01, 0x02, 0x8e, 0x00, 0x50, 0x06,
+  0x27, 0x00, 0x52, 0x22, 0x27, 0x00, 0x81, 0x8e, 0x00, 0x8e, 0x00, 0x50, 0x0f, 0x27, 0x00, 0x01,
+  0x1e, 0x02, 0x45, 0x16, 0x27, 0x00, 0x01, 0x1e, 0x02, 0x44, 0x1d, 0x27, 0x00, 0x80, 0x1e, 0x02,
+  0x1e, 0x02, 0x03, 0xfe, 0x00, 0x45, 0x31, 0x27, 0x00, 0x4d, 0x36, 0x27, 0x00, 0x59, 0x3b, 0x27,
+  0x00, 0x80, 0x45, 0x02, 0x45, 0x02, 0x80, 0x4f, 0x02, 0x4f, 0x02, 0x80, 0xfe, 0x00, 0xfe, 0x00,
+  0x01, 0x60, 0x01, 0x4f, 0x47, 0x27, 0x00, 0x01, 0x60, 0x01, 0x4e, 0x4e, 0x27, 0x00, 0x01, 0x60,
+  0x01, 0x47, 0x55, 0x27, 0x00, 0x80, 0x60, 0x01, 0x60, 0x01, 0x01, 0x03, 0x01, 0x44, 0x61, 0x27,
+  0x00, 0x02, 0x03, 0x01, 0x45, 0x6c, 0x27, 0x00, 0x59, 0x7f, 0x27, 0x00, 0x01, 0x3d, 0x01, 0x4e,
+  0x73, 0x27, 0x00, 0x01, 0x3d, 0x01, 0x54, 0x7a, 0x27, 0x00, 0x80, 0x3d, 0x01, 0x3d, 0x01, 0x80,
+  0x03, 0x01, 0x03, 0x01, 0x04, 0xdf, 0x00, 0x43, 0x97, 0x27, 0x00, 0x47, 0xa3, 0x27, 0x00, 0x4e,
+  0xc4, 0x27, 0x00, 0x52, 0xc9, 0x27, 0x00, 0x01, 0x03, 0x02, 0x48, 0x9e, 0x27, 0x00, 0x80, 0x03,
+  0x02, 0x03, 0x02, 0x01, 0xdf, 0x00, 0x47, 0xaa, 0x27, 0x00, 0x01, 0xdf, 0x00, 0x45, 0xb1, 0x27,
+  0x00, 0x01, 0xdf, 0x00, 0x53, 0xb8, 0x27, 0x00, 0x01, 0xdf, 0x00, 0x54, 0xbf, 0x27, 0x00, 0x80,
+  0xdf, 0x00, 0xdf, 0x00, 0x80, 0x4d, 0x02, 0x4d, 0x02, 0x01, 0x58, 0x01, 0x45, 0xd0, 0x27, 0x00,
+  0x80, 0x58, 0x01, 0x58, 0x01, 0x01, 0xf2, 0x00, 0x53, 0xdc, 0x27, 0x00, 0x01, 0xf2, 0x00, 0x54,
+  0xe3, 0x27, 0x00, 0x01, 0xf2, 0x00, 0x45, 0xea, 0x27, 0x00, 0x01, 0xf2, 0x00, 0x4d, 0xf1, 0x27,
+  0x00, 0x80, 0xf2, 0x00, 0xf2, 0x00, 0x08, 0x00, 0x00, 0x41, 0x19, 0x28, 0x00, 0x45, 0x7a, 0x28,
+  0x00, 0x48, 0xf6, 0x28, 0x00, 0x49, 0x32, 0x2a, 0x00, 0x4f, 0x65, 0x2a, 0x00, 0x52, 0x45, 0x2b,
+  0x00, 0x55, 0xaf, 0x2b, 0x00, 0x57, 0xc2, 0x2b, 0x00, 0x02, 0x3b, 0x00, 0x4b, 0x24, 0x28, 0x00,
+  0x4c, 0x47, 0x28, 0x00, 0x02, 0x3b, 0x00, 0x45, 0x2f, 0x28, 0x00, 0x49, 0x34, 0x28, 0x00, 0x80,
+  0x3b, 0x00, 0x3b, 0x00, 0x01, 0xf0, 0x01, 0x4e, 0x3b, 0x28, 0x00, 0x01, 0xf0, 0x01, 0x47, 0x42,
+  0x28, 0x00, 0x80, 0xf0, 0x01, 0xf0, 0x01, 0x01, 0x14, 0x02, 0x4b, 0x4e, 0x28, 0x00, 0x82, 0x14,
+  0x02, 0x14, 0x02, 0x45, 0x5b, 0x28, 0x00, 0x49, 0x67, 0x28, 0x00, 0x01, 0x15, 0x02, 0x44, 0x62,
+  0x28, 0x00, 0x80, 0x15, 0x02, 0x15, 0x02, 0x01, 0x16, 0x02, 0x4e, 0x6e, 0x28, 0x00, 0x01, 0x16,
+  0x02, 0x47, 0x75, 0x28, 0x00, 0x80, 0x16, 0x02, 0x16, 0x02, 0x04, 0x7e, 0x00, 0x41, 0x8d, 0x28,
+  0x00, 0x4c, 0xb9, 0x28, 0x00, 0x4e, 0xdc, 0x28, 0x00, 0x58, 0xea, 0x28, 0x00, 0x82, 0x1d, 0x01,
+  0xcd, 0x01, 0x43, 0x9a, 0x28, 0x00, 0x4d, 0xb4, 0x28, 0x00, 0x01, 0x37, 0x01, 0x48, 0xa1, 0x28,
+  0x00, 0x01, 0x37, 0x01, 0x45, 0xa8, 0x28, 0x00, 0x01, 0x37, 0x01, 0x52, 0xaf, 0x28, 0x00, 0x80,
+  0x37, 0x01, 0x37, 0x01, 0x80, 0x1d, 0x01, 0x1d, 0x01, 0x01, 0xa1, 0x00, 0x4c, 0xc0, 0x28, 0x00,
+  0x81, 0xa1, 0x00, 0xa1, 0x00, 0x49, 0xc9, 0x28, 0x00, 0x01, 0xf8, 0x01, 0x4e, 0xd0, 0x28, 0x00,
+  0x01, 0xf8, 0x01, 0x47, 0xd7, 0x28, 0x00, 0x80, 0xf8, 0x01, 0xf8, 0x01, 0x81, 0xa4, 0x01, 0xa4,
+  0x01, 0x54, 0xe5, 0x28, 0x00, 0x80, 0xc3, 0x01, 0xc3, 0x01, 0x01, 0x7e, 0x00, 0x54, 0xf1, 0x28,
+  0x00, 0x80, 0x7e, 0x00, 0x7e, 0x00, 0x05, 0x00, 0x00, 0x41, 0x0d, 0x29, 0x00, 0x45, 0x34, 0x29,
+  0x00, 0x49, 0x84, 0x29, 0x00, 0x4f, 0xd9, 0x29, 0x00, 0x52, 0x01, 0x2a, 0x00, 0x02, 0x07, 0x00,
+  0x4e, 0x18, 0x29, 0x00, 0x54, 0x2f, 0x29, 0x00, 0x81, 0x46, 0x00, 0x46, 0x00, 0x4b, 0x21, 0x29,
+  0x00, 0x81, 0x78, 0x00, 0x79, 0x00, 0x53, 0x2a, 0x29, 0x00, 0x80, 0x78, 0x00, 0x78, 0x00, 0x80,
+  0x07, 0x00, 0x07, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x49, 0x51, 0x29, 0x00, 0x4d, 0x5d, 0x29,
+  0x00, 0x4e, 0x62, 0x29, 0x00, 0x52, 0x67, 0x29, 0x00, 0x53, 0x73, 0x29, 0x00, 0x59, 0x7f, 0x29,
+  0x00, 0x01, 0x26, 0x00, 0x52, 0x58, 0x29, 0x00, 0x80, 0x26, 0x00, 0x26, 0x00, 0x80, 0x43, 0x00,
+  0x43, 0x00, 0x80, 0x47, 0x00, 0x47, 0x00, 0x01, 0x25, 0x00, 0x45, 0x6e, 0x29, 0x00, 0x80, 0x25,
+  0x00, 0x25, 0x00, 0x01, 0x5f, 0x00, 0x45, 0x7a, 0x29, 0x00, 0x80, 0x5f, 0x00, 0x5f, 0x00, 0x80,
+  0x19, 0x00, 0x19, 0x00, 0x03, 0x14, 0x00, 0x4e, 0x93, 0x29, 0x00, 0x52, 0xc8, 0x29, 0x00, 0x53,
+  0xd4, 0x29, 0x00, 0x02, 0x4e, 0x00, 0x47, 0x9e, 0x29, 0x00, 0x4b, 0xac, 0x29, 0x00, 0x81, 0x9f,
+  0x00, 0x9f, 0x00, 0x53, 0xa7, 0x29, 0x00, 0x80, 0xa0, 0x00, 0xa0, 0x00, 0x81, 0x4e, 0x00, 0x4e,
+  0x00, 0x49, 0xb5, 0x29, 0x00, 0x01, 0xf4, 0x01, 0x4e, 0xbc, 0x29, 0x00, 0x01, 0xf4, 0x01, 0x47,
+  0xc3, 0x29, 0x00, 0x80, 0xf4, 0x01, 0xf4, 0x01, 0x01, 0xa8, 0x01, 0x44, 0xcf, 0x29, 0x00, 0x80,
+  0xa8, 0x01, 0xa8, 0x01, 0x80, 0x14, 0x00, 0x14, 0x00, 0x01, 0xa6, 0x01, 0x55, 0xe0, 0x29, 0x00,
+  0x01, 0xa6, 0x01, 0x53, 0xe7, 0x29, 0x00, 0x01, 0xa6, 0x01, 0x41, 0xee, 0x29, 0x00, 0x01, 0xa6,
+  0x01, 0x4e, 0xf5, 0x29, 0x00, 0x01, 0xa6, 0x01, 0x44, 0xfc, 0x29, 0x00, 0x80, 0xa6, 0x01, 0xa6,
+  0x01, 0x02, 0x89, 0x01, 0x45, 0x0c, 0x2a, 0x00, 0x4f, 0x18, 0x2a, 0x00, 0x01, 0x9d, 0x01, 0x45,
+  0x13, 0x2a, 0x00, 0x80, 0x9d, 0x01, 0x9d, 0x01, 0x01, 0x89, 0x01, 0x55, 0x1f, 0x2a, 0x00, 0x01,
+  0x89, 0x01, 0x47, 0x26, 0x2a, 0x00, 0x01, 0x89, 0x01, 0x48, 0x2d, 0x2a, 0x00, 0x80, 0x89, 0x01,
+  0x89, 0x01, 0x02, 0x36, 0x00, 0x4d, 0x3d, 0x2a, 0x00, 0x52, 0x52, 0x2a, 0x00, 0x01, 0x36, 0x00,
+  0x45, 0x44, 0x2a, 0x00, 0x81, 0x36, 0x00, 0x36, 0x00, 0x53, 0x4d, 0x2a, 0x00, 0x80, 0x12, 0x02,
+  0x12, 0x02, 0x01, 0xd9, 0x01, 0x45, 0x59, 0x2a, 0x00, 0x01, 0xd9, 0x01, 0x44, 0x60, 0x2a, 0x00,
+  0x80, 0xd9, 0x01, 0xd9, 0x01, 0x87, 0x02, 0x00, 0x02, 0x00, 0x44, 0x86, 0x2a, 0x00, 0x47, 0x99,
+  0x2a, 0x00, 0x4c, 0xc1, 0x2a, 0x00, 0x4d, 0xcd, 0x2a, 0x00, 0x4e, 0xf5, 0x2a, 0x00, 0x4f, 0x16,
+  0x2b, 0x00, 0x57, 0x1b, 0x2b, 0x00, 0x01, 0x86, 0x00, 0x41, 0x8d, 0x2a, 0x00, 0x01, 0x86, 0x00,
+  0x59, 0x94, 0x2a, 0x00, 0x80, 0x86, 0x00, 0x86, 0x00, 0x01, 0x7b, 0x01, 0x45, 0xa0, 0x2a, 0x00,
+  0x01, 0x7b, 0x01, 0x54, 0xa7, 0x2a, 0x00, 0x01, 0x7b, 0x01, 0x48, 0xae, 0x2a, 0x00, 0x01, 0x7b,
+  0x01, 0x45, 0xb5, 0x2a, 0x00, 0x01, 0x7b, 0x01, 0x52, 0xbc, 0x2a, 0x00, 0x80, 0x7b, 0x01, 0x7b,
+  0x01, 0x01, 0x17, 0x02, 0x44, 0xc8, 0x2a, 0x00, 0x80, 0x17, 0x02, 0x17, 0x02, 0x01, 0x88, 0x00,
+  0x4f, 0xd4, 0x2a, 0x00, 0x01, 0x88, 0x00, 0x52, 0xdb, 0x2a, 0x00, 0x01, 0x88, 0x00, 0x52, 0xe2,
+  0x2a, 0x00, 0x01, 0x88, 0x00, 0x4f, 0xe9, 0x2a, 0x00, 0x01, 0x88, 0x00, 0x57, 0xf0, 0x2a, 0x00,
+  0x80, 0x88, 0x00, 0x88, 0x00, 0x01, 0x87, 0x00, 0x49, 0xfc, 0x2a, 0x00, 0x01, 0x87, 0x00, 0x47,
+  0x03, 0x2b, 0x00, 0x01, 0x87, 0x00, 0x48, 0x0a, 0x2b, 0x00, 0x01, 0x87, 0x00, 0x54, 0x11, 0x2b,
+  0x00, 0x80, 0x87, 0x00, 0x87, 0x00, 0x80, 0x7f, 0x01, 0x7f, 0x01, 0x02, 0x93, 0x01, 0x41, 0x26,
+  0x2b, 0x00, 0x45, 0x39, 0x2b, 0x00, 0x01, 0x93, 0x01, 0x52, 0x2d, 0x2b, 0x00, 0x01, 0x93, 0x01,
+  0x44, 0x34, 0x2b, 0x00, 0x80, 0x93, 0x01, 0x93, 0x01, 0x01, 0xc9, 0x01, 0x52, 0x40, 0x2b, 0x00,
+  0x80, 0xc9, 0x01, 0xc9, 0x01, 0x04, 0xa4, 0x00, 0x41, 0x58, 0x2b, 0x00, 0x49, 0x74, 0x2b, 0x00,
+  0x55, 0x87, 0x2b, 0x00, 0x59, 0x93, 0x2b, 0x00, 0x01, 0xc5, 0x01, 0x49, 0x5f, 0x2b, 0x00, 0x02,
+  0xc5, 0x01, 0x4c, 0x6a, 0x2b, 0x00, 0x4e, 0x6f, 0x2b, 0x00, 0x80, 0xc5, 0x01, 0xc5, 0x01, 0x80,
+  0x51, 0x02, 0x51, 0x02, 0x01, 0x20, 0x02, 0x45, 0x7b, 0x2b, 0x00, 0x01, 0x20, 0x02, 0x44, 0x82,
+  0x2b, 0x00, 0x80, 0x20, 0x02, 0x20, 0x02, 0x01, 0x56, 0x02, 0x45, 0x8e, 0x2b, 0x00, 0x80, 0x56,
+  0x02, 0x56, 0x02, 0x81, 0xa4, 0x00, 0xa4, 0x00, 0x49, 0x9c, 0x2b, 0x00, 0x01, 0xf6, 0x01, 0x4e,
+  0xa3, 0x2b, 0x00, 0x01, 0xf6, 0x01, 0x47, 0xaa, 0x2b, 0x00, 0x80, 0xf6, 0x01, 0xf6, 0x01, 0x01,
+  0x2b, 0x02, 0x52, 0xb6, 0x2b, 0x00, 0x01, 0x2b, 0x02, 0x4e, 0xbd, 0x2b, 0x00, 0x80, 0x2b, 0x02,
+  0x2b, 0x02, 0x01, 0x53, 0x00, 0x4f, 0xc9, 0x2b, 0x00, 0x80, 0x53, 0x00, 0x53, 0x00, 0x03, 0x29,
+  0x00, 0x4e, 0xdd, 0x2b, 0x00, 0x50, 0x33, 0x2c, 0x00, 0x53, 0x38, 0x2c, 0x00, 0x01, 0xc2, 0x00,
+  0x44, 0xe4, 0x2b, 0x00, 0x01, 0xc2, 0x00, 0x45, 0xeb, 0x2b, 0x00, 0x01, 0xc2, 0x00, 0x52, 0xf2,
+  0x2b, 0x00, 0x81, 0xc2, 0x00, 0x87, 0x01, 0x53, 0xfb, 0x2b, 0x00, 0x01, 0xc2, 0x00, 0x54, 0x02,
+  0x2c, 0x00, 0x02, 0xc2, 0x00, 0x41, 0x0d, 0x2c, 0x00, 0x4f, 0x20, 0x2c, 0x00, 0x01, 0xc2, 0x00,
+  0x4e, 0x14, 0x2c, 0x00, 0x01, 0xc2, 0x00, 0x44, 0x1b, 0x2c, 0x00, 0x80, 0xc2, 0x00, 0xc2, 0x00,
+  0x01, 0xe1, 0x01, 0x4f, 0x27, 0x2c, 0x00, 0x01, 0xe1, 0x01, 0x44, 0x2e, 0x2c, 0x00, 0x80, 0xe1,
+  0x01, 0xe1, 0x01, 0x80, 0x29, 0x00, 0x29, 0x00, 0x81, 0x52, 0x00, 0x63, 0x00, 0x45, 0x41, 0x2c,
+  0x00, 0x81, 0x52, 0x00, 0x52, 0x00, 0x44, 0x4a, 0x2c, 0x00, 0x80, 0x25, 0x02, 0x25, 0x02, 0x01,
+  0x9a, 0x00, 0x45, 0x56, 0x2c, 0x00, 0x01, 0x9a, 0x00, 0x52, 0x5d, 0x2c, 0x00, 0x01, 0x9a, 0x00,
+  0x59, 0x64, 0x2c, 0x00, 0x80, 0x9a, 0x00, 0x9a, 0x00, 0x06, 0x0e, 0x00, 0x41, 0x84, 0x2c, 0x00,
+  0x45, 0x49, 0x2d, 0x00, 0x48, 0xda, 0x2d, 0x00, 0x49, 0x6f, 0x2e, 0x00, 0x4f, 0xeb, 0x2e, 0x00,
+  0x52, 0x6c, 0x2f, 0x00, 0x07, 0x59, 0x00, 0x49, 0xa3, 0x2c, 0x00, 0x4c, 0xd6, 0x2c, 0x00, 0x4e,
+  0xf2, 0x2c, 0x00, 0x52, 0x0e, 0x2d, 0x00, 0x53, 0x1c, 0x2d, 0x00, 0x54, 0x21, 0x2d, 0x00, 0x59,
+  0x44, 0x2d, 0x00, 0x01, 0x8d, 0x00, 0x54, 0xaa, 0x2c, 0x00, 0x82, 0x8d, 0x00, 0x8d, 0x00, 0x45,
+  0xb7, 0x2c, 0x00, 0x49, 0xc3, 0x2c, 0x00, 0x01, 0x1a, 0x02, 0x44, 0xbe, 0x2c, 0x00, 0x80, 0x1a,
+  0x02, 0x1a, 0x02, 0x01, 0xfa, 0x01, 0x4e, 0xca, 0x2c, 0x00, 0x01, 0xfa, 0x01, 0x47, 0xd1, 0x2c,
+  0x00, 0x80, 0xfa, 0x01, 0xfa, 0x01, 0x01, 0xcd, 0x00, 0x4b, 0xdd, 0x2c, 0x00, 0x81, 0xcd, 0x00,
+  0xcd, 0x00, 0x45, 0xe6, 0x2c, 0x00, 0x01, 0x1b, 0x02, 0x44, 0xed, 0x2c, 0x00, 0x80, 0x1b, 0x02,
+  0x1b, 0x02, 0x01, 0x5c, 0x00, 0x54, 0xf9, 0x2c, 0x00, 0x81, 0x5c, 0x00, 0x5c, 0x00, 0x45, 0x02,
+  0x2d, 0x00, 0x01, 0x21, 0x02, 0x44, 0x09, 0x2d, 0x00, 0x80, 0x21, 0x02, 0x21, 0x02, 0x81, 0x2c,
+  0x01, 0x2c, 0x01, 0x4d, 0x17, 0x2d, 0x00, 0x80, 0x69, 0x01, 0x69, 0x01, 0x80, 0x65, 0x00, 0x65,
+  0x00, 0x02, 0xc3, 0x00, 0x43, 0x2c, 0x2d, 0x00, 0x45, 0x38, 0x2d, 0x00, 0x01, 0xc3, 0x00, 0x48,
+  0x33, 0x2d, 0x00, 0x80, 0xc3, 0x00, 0xc3, 0x00, 0x01, 0xf9, 0x00, 0x52, 0x3f, 0x2d, 0x00, 0x80,
+  0xf9, 0x00, 0xf9, 0x00, 0x80, 0x59, 0x00, 0x59, 0x00, 0x86, 0x1a, 0x00, 0x1a, 0x00, 0x41, 0x66,
+  0x2d, 0x00, 0x45, 0x87, 0x2d, 0x00, 0x4c, 0xaa, 0x2d, 0x00, 0x4e, 0xb6, 0x2d, 0x00, 0x52, 0xc2,
+  0x2d, 0x00, 0x53, 0xce, 0x2d, 0x00, 0x01, 0x4e, 0x02, 0x54, 0x6d, 0x2d, 0x00, 0x01, 0x4e, 0x02,
+  0x48, 0x74, 0x2d, 0x00, 0x01, 0x4e, 0x02, 0x45, 0x7b, 0x2d, 0x00, 0x01, 0x4e, 0x02, 0x52, 0x82,
+  0x2d, 0x00, 0x80, 0x4e, 0x02, 0x4e, 0x02, 0x01, 0xf0, 0x00, 0x4b, 0x8e, 0x2d, 0x00, 0x81, 0xf0,
+  0x00, 0xf0, 0x00, 0x45, 0x97, 0x2d, 0x00, 0x01, 0x11, 0x02, 0x4e, 0x9e, 0x2d, 0x00, 0x01, 0x11,
+  0x02, 0x44, 0xa5, 0x2d, 0x00, 0x80, 0x11, 0x02, 0x11, 0x02, 0x01, 0x58, 0x00, 0x4c, 0xb1, 0x2d,
+  0x00, 0x80, 0x58, 0x00, 0x58, 0x00, 0x01, 0x6e, 0x00, 0x54, 0xbd, 0x2d, 0x00, 0x80, 0x6e, 0x00,
+  0x6e, 0x00, 0x01, 0x67, 0x00, 0x45, 0xc9, 0x2d, 0x00, 0x80, 0x67, 0x00, 0x67, 0x00, 0x01, 0x97,
+  0x01, 0x54, 0xd5, 0x2d, 0x00, 0x80, 0x97, 0x01, 0x97, 0x01, 0x05, 0x27, 0x00, 0x41, 0xf1, 0x2d,
+  0x00, 0x45, 0xfd, 0x2d, 0x00, 0x49, 0x19, 0x2e, 0x00, 0x4f, 0x3c, 0x2e, 0x00, 0x59, 0x6a, 0x2e,
+  0x00, 0x01, 0x27, 0x00, 0x54, 0xf8, 0x2d, 0x00, 0x80, 0x27, 0x00, 0x27, 0x00, 0x02, 0x32, 0x00,
+  0x4e, 0x08, 0x2e, 0x00, 0x52, 0x0d, 0x2e, 0x00, 0x80, 0x32, 0x00, 0x32, 0x00, 0x01, 0x8a, 0x00,
+  0x45, 0x14, 0x2e, 0x00, 0x80, 0x8a, 0x00, 0x8a, 0x00, 0x02, 0x2f, 0x00, 0x43, 0x24, 0x2e, 0x00,
+  0x54, 0x30, 0x2e, 0x00, 0x01, 0x2f, 0x00, 0x48, 0x2b, 0x2e, 0x00, 0x80, 0x2f, 0x00, 0x2f, 0x00,
+  0x01, 0xac, 0x01, 0x45, 0x37, 0x2e, 0x00, 0x80, 0xac, 0x01, 0xac, 0x01, 0x83, 0x2d, 0x00, 0x2d,
+  0x00, 0x4c, 0x4d, 0x2e, 0x00, 0x4d, 0x59, 0x2e, 0x00, 0x53, 0x5e, 0x2e, 0x00, 0x01, 0x5b, 0x01,
+  0x45, 0x54, 0x2e, 0x00, 0x80, 0x5b, 0x01, 0x5b, 0x01, 0x80, 0xfc, 0x01, 0xfc, 0x01, 0x01, 0xfd,
+  0x01, 0x45, 0x65, 0x2e, 0x00, 0x80, 0xfd, 0x01, 0xfd, 0x01, 0x80, 0x99, 0x00, 0x99, 0x00, 0x05,
+  0x0e, 0x00, 0x46, 0x86, 0x2e, 0x00, 0x4c, 0x92, 0x2e, 0x00, 0x4e, 0x9e, 0x2e, 0x00, 0x53, 0xac,
+  0x2e, 0x00, 0x54, 0xb8, 0x2e, 0x00, 0x01, 0x40, 0x02, 0x45, 0x8d, 0x2e, 0x00, 0x80, 0x40, 0x02,
+  0x40, 0x02, 0x01, 0x20, 0x00, 0x4c, 0x99, 0x2e, 0x00, 0x80, 0x20, 0x00, 0x20, 0x00, 0x81, 0xce,
+  0x00, 0xce, 0x00, 0x44, 0xa7, 0x2e, 0x00, 0x80, 0x4c, 0x02, 0x4c, 0x02, 0x01, 0xd5, 0x01, 0x48,
+  0xb3, 0x2e, 0x00, 0x80, 0xd5, 0x01, 0xd5, 0x01, 0x01, 0x0e, 0x00, 0x48, 0xbf, 0x2e, 0x00, 0x82,
+  0x0e, 0x00, 0x0e, 0x00, 0x49, 0xcc, 0x2e, 0x00, 0x4f, 0xd8, 0x2e, 0x00, 0x01, 0x8c, 0x01, 0x4e,
+  0xd3, 0x2e, 0x00, 0x80, 0x8c, 0x01, 0x8c, 0x01, 0x01, 0x8b, 0x01, 0x55, 0xdf, 0x2e, 0x00, 0x01,
+  0x8b, 0x01, 0x54, 0xe6, 0x2e, 0x00, 0x80, 0x8b, 0x01, 0x8b, 0x01, 0x03, 0x24, 0x00, 0x4d, 0xfa,
+  0x2e, 0x00, 0x52, 0x0d, 0x2f, 0x00, 0x55, 0x59, 0x2f, 0x00, 0x01, 0xe8, 0x00, 0x41, 0x01, 0x2f,
+  0x00, 0x01, 0xe8, 0x00, 0x4e, 0x08, 0x2f, 0x00, 0x80, 0xe8, 0x00, 0xe8, 0x00, 0x03, 0x56, 0x00,
+  0x44, 0x1c, 0x2f, 0x00, 0x4b, 0x21, 0x2f, 0x00, 0x4c, 0x4d, 0x2f, 0x00, 0x80, 0x07, 0x01, 0x07,
+  0x01, 0x82, 0x56, 0x00, 0x56, 0x00, 0x45, 0x2e, 0x2f, 0x00, 0x49, 0x3a, 0x2f, 0x00, 0x01, 0x24,
+  0x02, 0x44, 0x35, 0x2f, 0x00, 0x80, 0x24, 0x02, 0x24, 0x02, 0x01, 0xf5, 0x01, 0x4e, 0x41, 0x2f,
+  0x00, 0x01, 0xf5, 0x01, 0x47, 0x48, 0x2f, 0x00, 0x80, 0xf5, 0x01, 0xf5, 0x01, 0x01, 0xea, 0x00,
+  0x44, 0x54, 0x2f, 0x00, 0x80, 0xea, 0x00, 0xea, 0x00, 0x01, 0x24, 0x00, 0x4c, 0x60, 0x2f, 0x00,
+  0x01, 0x24, 0x00, 0x44, 0x67, 0x2f, 0x00, 0x80, 0x24, 0x00, 0x24, 0x00, 0x01, 0xb6, 0x00, 0x49,
+  0x73, 0x2f, 0x00, 0x01, 0xb6, 0x00, 0x54, 0x7a, 0x2f, 0x00, 0x01, 0xb6, 0x00, 0x45, 0x81, 0x2f,
+  0x00, 0x80, 0xb6, 0x00, 0xb6, 0x00, 0x02, 0x11, 0x00, 0x45, 0x91, 0x2f, 0x00, 0x4f, 0x09, 0x30,
+  0x00, 0x04, 0x3e, 0x00, 0x41, 0xa4, 0x2f, 0x00, 0x4c, 0xb9, 0x2f, 0x00, 0x53, 0xd3, 0x2f, 0x00,
+  0x54, 0x04, 0x30, 0x00, 0x02, 0x3e, 0x00, 0x48, 0xaf, 0x2f, 0x00, 0x52, 0xb4, 0x2f, 0x00, 0x80,
+  0x74, 0x00, 0x74, 0x00, 0x80, 0x3e, 0x00, 0x3e, 0x00, 0x01, 0xae, 0x01, 0x4c, 0xc0, 0x2f, 0x00,
+  0x01, 0xae, 0x01, 0x4f, 0xc7, 0x2f, 0x00, 0x01, 0xae, 0x01, 0x57, 0xce, 0x2f, 0x00, 0x80, 0xae,
+  0x01, 0xae, 0x01, 0x81, 0x73, 0x00, 0x73, 0x00, 0x54, 0xdc, 0x2f, 0x00, 0x01, 0x10, 0x02, 0x45,
+  0xe3, 0x2f, 0x00, 0x01, 0x10, 0x02, 0x52, 0xea, 0x2f, 0x00, 0x01, 0x10, 0x02, 0x44, 0xf1, 0x2f,
+  0x00, 0x01, 0x10, 0x02, 0x41, 0xf8, 0x2f, 0x00, 0x01, 0x10, 0x02, 0x59, 0xff, 0x2f, 0x00, 0x80,
+  0x10, 0x02, 0x10, 0x02, 0x80, 0x79, 0x01, 0x79, 0x01, 0x01, 0x11, 0x00, 0x55, 0x10, 0x30, 0x00,
+  0x82, 0x11, 0x00, 0x11, 0x00, 0x4e, 0x1d, 0x30, 0x00, 0x52, 0x29, 0x30, 0x00, 0x01, 0x4c, 0x01,
+  0x47, 0x24, 0x30, 0x00, 0x80, 0x4c, 0x01, 0x4c, 0x01, 0x80, 0x3f, 0x00, 0x3f, 0x00,
+};
+const size_t t9WordsLen = sizeof(t9Words);
@@ -0,0 +1,60 @@
+#include <Arduino.h>
+#include <cstdarg>
+
+#include "sim.h"
+
+HardwareSerial Serial;
+
+static unsigned long long clockMicros = 0;
+static SimStats stats = {};
+
+// Moves the clock forward, stopping at each esp_timer deadline on the way
+// to run its callback. Time a callback spends (e.g. in delay()) is added
+// without recursing.
+static void advance(unsigned long long us) {
+  static bool inTimer = false;
+  unsigned long long target = clockMicros + us;
+  unsigned long long due;
+  while (!inTimer && simNextTimer(due) && due <= target) {
+    if (due > clockMicros) clockMicros = due;
+    inTimer = true;
+    simFireTimers(clockMicros);
+    inTimer = false;
+    if (clockMicros > target) target = clockMicros;
+  }
+  clockMicros = target;
+}
+
+unsigned long millis() { return (unsigned long)(clockMicros / 1000); }
+unsigned long micros() { return (unsigned long)clockMicros; }
+void delay(unsigned long ms) { advance((unsigned long long)ms * 1000); }
+void delayMicroseconds(unsigned int us) { advance(us); }
+void simAdvanceMicros(unsigned long us) { advance(us); }
+
+void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+void digitalWrite(uint8_t pin, uint8_t val) { (void)pin; (void)val; }
+int digitalRead(uint8_t pin) { (void)pin; return HIGH; }
+
+uint32_t esp_random() {
+  static uint32_t state = 0x9E3779B9;
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+const SimStats &simStats() { return stats; }
+void simResetStats() { stats = SimStats(); }
+SimStats &simMutableStats() { return stats; }
+
+size_t HardwareSerial::write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+size_t HardwareSerial::write(const uint8_t *buf, size_t len) { return fwrite(buf, 1, len, stdout); }
+size_t HardwareSerial::print(const char *s) { return fputs(s, stdout) >= 0 ? strlen(s) : 0; }
+
+size_t HardwareSerial::printf(const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int n = vprintf(fmt, args);
+  va_end(args);
+  return n < 0 ? 0 : (size_t)n;
+}
@@ -0,0 +1,135 @@
+// Host stand-in for the Arduino core, used by [env:native]
+#pragma once
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+// Time (virtual clock, advanced by delay() and the sim driver)
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+inline void yield() {}
+
+// esp_system.h
+uint32_t esp_random();
+
+// GPIO / ADC
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+// WCharacter.h
+inline bool isAlpha(int c) { return isalpha(c) != 0; }
+inline bool isDigit(int c) { return isdigit(c) != 0; }
+inline bool isAlphaNumeric(int c) { return isalnum(c) != 0; }
+inline bool isSpace(int c) { return isspace(c) != 0; }
+inline bool isUpperCase(int c) { return isupper(c) != 0; }
+
+// WString.h
+class String {
+public:
+  String() {}
+  String(const char *s) : s_(s ? s : "") {}
+  String(const std::string &s) : s_(s) {}
+  explicit String(char c) : s_(1, c) {}
+  explicit String(int v) : s_(std::to_string(v)) {}
+  explicit String(unsigned int v) : s_(std::to_string(v)) {}
+  explicit String(long v) : s_(std::to_string(v)) {}
+  explicit String(unsigned long v) : s_(std::to_string(v)) {}
+
+  unsigned int length() const { return s_.size(); }
+  const char *c_str() const { return s_.c_str(); }
+  bool reserve(unsigned int size) { s_.reserve(size); return true; }
+
+  char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char &operator[](unsigned int i) { return s_[i]; }
+
+  const char *begin() const { return s_.data(); }
+  const char *end() const { return s_.data() + s_.size(); }
+
+  String &operator+=(const String &rhs) { s_ += rhs.s_; return *this; }
+  String &operator+=(const char *rhs) { s_ += rhs; return *this; }
+  String &operator+=(char c) { s_ += c; return *this; }
+  String &operator+=(int v) { s_ += std::to_string(v); return *this; }
+
+  bool concat(const String &rhs) { s_ += rhs.s_; return true; }
+  bool concat(char c) { s_ += c; return true; }
+
+  void remove(unsigned int index) { if (index < s_.size()) s_.erase(index); }
+  void remove(unsigned int index, unsigned int count) { if (index < s_.size()) s_.erase(index, count); }
+
+  String substring(unsigned int from) const { return from < s_.size() ? String(s_.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const {
+    return from < s_.size() && to > from ? String(s_.substr(from, to - from)) : String();
+  }
+  int indexOf(char c) const { size_t p = s_.find(c); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(char c, unsigned int from) const {
+    size_t p = s_.find(c, from);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+  int indexOf(const String &s) const { size_t p = s_.find(s.s_); return p == std::string::npos ? -1 : (int)p; }
+  bool startsWith(const String &s) const { return s_.compare(0, s.s_.size(), s.s_) == 0; }
+  int toInt() const { return atoi(s_.c_str()); }
+
+  bool operator==(const String &rhs) const { return s_ == rhs.s_; }
+  bool operator==(const char *rhs) const { return s_ == rhs; }
+  bool operator!=(const String &rhs) const { return s_ != rhs.s_; }
+  bool operator!=(const char *rhs) const { return s_ != rhs; }
+
+  friend String operator+(const String &a, const String &b) { return String(a.s_ + b.s_); }
+  friend String operator+(const String &a, const char *b) { return String(a.s_ + b); }
+  friend String operator+(const char *a, const String &b) { return String(a + b.s_); }
+  friend String operator+(const String &a, char b) { return String(a.s_ + b); }
+
+private:
+  std::string s_;
+};
+
+// HardwareSerial
+class HardwareSerial {
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  size_t write(uint8_t c);
+  size_t write(const uint8_t *buf, size_t len);
+  size_t print(const char *s);
+  size_t print(const String &s) { return print(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return print(String(v)); }
+  size_t print(unsigned long v) { return print(String(v)); }
+  size_t println() { return print("\n"); }
+  template <typename T> size_t println(const T &v) { size_t n = print(v); return n + println(); }
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+  int available() { return 0; }
+  int read() { return -1; }
+  operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+// Firmware entry points (defined by the sketch)
+void setup();
+void loop();
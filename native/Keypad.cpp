@@ -0,0 +1,102 @@
+#include <Keypad.h>
+
+#include <deque>
+
+#include "sim.h"
+
+struct KeyPress {
+  char key;
+  unsigned long down;  // ms
+  unsigned long up;
+};
+
+static std::deque<KeyPress> presses;
+
+static void schedule(char key, unsigned long ms) {
+  unsigned long down = millis();
+  if (!presses.empty() && presses.back().up + SIM_KEY_GAP_MS > down) down = presses.back().up + SIM_KEY_GAP_MS;
+  presses.push_back({key, down, down + ms});
+}
+
+void simPressKey(char key) { schedule(key, SIM_KEY_TAP_MS); }
+void simHoldKey(char key, unsigned long ms) { schedule(key, ms); }
+
+bool simKeysIdle() {
+  while (!presses.empty() && presses.front().up <= millis()) presses.pop_front();
+  return presses.empty();
+}
+
+static bool isDown(char key, unsigned long now) {
+  for (const KeyPress &p : presses) {
+    if (p.key == key && p.down <= now && now < p.up) return true;
+  }
+  return false;
+}
+
+// As in the library: a key in the list moves one state per scan
+void Keypad::nextKeyState(int idx, bool pressed) {
+  Key &k = key[idx];
+  k.stateChanged = false;
+  KeyState next = k.kstate;
+  switch (k.kstate) {
+    case IDLE:
+      if (pressed) {
+        next = PRESSED;
+        holdTimer_[idx] = millis();
+      }
+      break;
+    case PRESSED:
+      if (millis() - holdTimer_[idx] > holdTime_) next = HOLD;
+      else if (!pressed) next = RELEASED;
+      break;
+    case HOLD:
+      if (!pressed) next = RELEASED;
+      break;
+    case RELEASED:
+      next = IDLE;
+      break;
+  }
+  if (next != k.kstate) {
+    k.kstate = next;
+    k.stateChanged = true;
+  }
+}
+
+bool Keypad::getKeys() {
+  if (millis() - startTime_ <= debounceTime_) return false;
+  startTime_ = millis();
+  simKeysIdle();
+
+  for (int i = 0; i < LIST_MAX; i++) {
+    if (key[i].kstate == IDLE && !key[i].stateChanged) key[i] = Key();
+  }
+
+  bool activity = false;
+  for (int code = 0; code < rows_ * cols_; code++) {
+    char c = keymap_[code];
+    bool pressed = isDown(c, millis());
+    int idx = -1;
+    for (int i = 0; i < LIST_MAX; i++) {
+      if (key[i].kchar == c && key[i].kcode == code) idx = i;
+    }
+    if (idx < 0 && pressed) {
+      for (int i = 0; i < LIST_MAX && idx < 0; i++) {
+        if (key[i].kchar == NO_KEY) {
+          idx = i;
+          key[i].kchar = c;
+          key[i].kcode = code;
+          key[i].kstate = IDLE;
+        }
+      }
+    }
+    if (idx < 0) continue;
+    nextKeyState(idx, pressed);
+    activity |= key[idx].stateChanged;
+  }
+  return activity;
+}
+
+char Keypad::getKey() {
+  if (getKeys() && key[0].stateChanged && key[0].kstate == PRESSED) return key[0].kchar;
+  return NO_KEY;
+}
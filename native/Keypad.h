@@ -0,0 +1,44 @@
+// Host stand-in for the Keypad library. Keys are pressed and released on the
+// virtual clock with simPressKey()/simHoldKey(); getKeys() follows them with
+// the library's debounce interval and IDLE/PRESSED/HOLD/RELEASED states.
+#pragma once
+
+#include <Arduino.h>
+
+#define makeKeymap(x) ((char *)x)
+#define NO_KEY '\0'
+#define LIST_MAX 10
+
+typedef enum { IDLE, PRESSED, HOLD, RELEASED } KeyState;
+
+class Key {
+public:
+  char kchar = NO_KEY;
+  int kcode = -1;
+  KeyState kstate = IDLE;
+  boolean stateChanged = false;
+};
+
+class Keypad {
+public:
+  Keypad(char *userKeymap, byte *row, byte *col, byte numRows, byte numCols)
+    : keymap_(userKeymap), rows_(numRows), cols_(numCols) { (void)row; (void)col; }
+
+  char getKey();
+  bool getKeys();
+  void setDebounceTime(uint32_t debounce) { debounceTime_ = debounce < 1 ? 1 : debounce; }
+  void setHoldTime(uint32_t hold) { holdTime_ = hold; }
+
+  Key key[LIST_MAX];
+
+private:
+  void nextKeyState(int idx, bool pressed);
+
+  char *keymap_;
+  byte rows_;
+  byte cols_;
+  uint32_t debounceTime_ = 10;
+  uint32_t holdTime_ = 500;
+  unsigned long startTime_ = 0;
+  unsigned long holdTimer_[LIST_MAX] = {};
+};
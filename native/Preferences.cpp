@@ -0,0 +1,82 @@
+#include <Preferences.h>
+
+#include <map>
+
+#include "sim.h"
+
+typedef std::map<std::string, std::string> Namespace;
+static std::map<std::string, Namespace> store;
+
+bool Preferences::begin(const char *name, bool readOnly, const char *partitionLabel) {
+  (void)partitionLabel;
+  if (open_) return false;
+  namespace_ = name;
+  readOnly_ = readOnly;
+  open_ = true;
+  return true;
+}
+
+void Preferences::end() { open_ = false; }
+
+bool Preferences::clear() {
+  if (!open_ || readOnly_) return false;
+  store[namespace_].clear();
+  simMutableStats().prefsWrites++;
+  return true;
+}
+
+bool Preferences::remove(const char *key) {
+  if (!open_ || readOnly_) return false;
+  simMutableStats().prefsWrites++;
+  return store[namespace_].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char *key) {
+  return open_ && store[namespace_].count(key) > 0;
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len) {
+  if (!open_ || readOnly_) return 0;
+  store[namespace_][key].assign((const char *)value, len);
+  simMutableStats().prefsWrites++;
+  return len;
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen) {
+  if (!open_) return 0;
+  simMutableStats().prefsReads++;
+  Namespace &ns = store[namespace_];
+  Namespace::iterator it = ns.find(key);
+  if (it == ns.end() || it->second.size() > maxLen) return 0;
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+  if (!open_) return 0;
+  Namespace &ns = store[namespace_];
+  Namespace::iterator it = ns.find(key);
+  return it == ns.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::putInt(const char *key, int32_t value) { return putBytes(key, &value, sizeof(value)); }
+size_t Preferences::putUInt(const char *key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+size_t Preferences::putString(const char *key, const char *value) { return putBytes(key, value, strlen(value)); }
+
+int32_t Preferences::getInt(const char *key, int32_t defaultValue) {
+  int32_t value;
+  return getBytes(key, &value, sizeof(value)) == sizeof(value) ? value : defaultValue;
+}
+
+uint32_t Preferences::getUInt(const char *key, uint32_t defaultValue) {
+  uint32_t value;
+  return getBytes(key, &value, sizeof(value)) == sizeof(value) ? value : defaultValue;
+}
+
+String Preferences::getString(const char *key, const String &defaultValue) {
+  if (!open_) return defaultValue;
+  simMutableStats().prefsReads++;
+  Namespace &ns = store[namespace_];
+  Namespace::iterator it = ns.find(key);
+  return it == ns.end() ? defaultValue : String(it->second);
+}
@@ -0,0 +1,60 @@
+#include <U8g2lib.h>
+
+#include "sim.h"
+
+static const u8g2_cb_t r0 = {0};
+const u8g2_cb_t *U8G2_R0 = &r0;
+const uint8_t u8g2_font_6x10_tr[] = {0};
+
+// SH1106 over 400 kHz I2C: 9 bits per byte, plus a 3 byte page/column preamble per page
+static unsigned long i2cHz = 400000;
+static const int PAGE_OVERHEAD = 4;
+
+void simSetI2cHz(unsigned long hz) { i2cHz = hz; }
+
+void U8G2::transfer(unsigned long bytes) {
+  SimStats &stats = simMutableStats();
+  stats.i2cBytes += bytes;
+  stats.framesFlushed++;
+  if (i2cHz > 0) simAdvanceMicros(bytes * 9 * 1000000UL / i2cHz);
+}
+
+void U8G2::sendBuffer() {
+  transfer(TILE_HEIGHT * (WIDTH + PAGE_OVERHEAD));
+}
+
+void U8G2::updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+  if (tx >= TILE_WIDTH || ty >= TILE_HEIGHT) return;
+  if (tx + tw > TILE_WIDTH) tw = TILE_WIDTH - tx;
+  if (ty + th > TILE_HEIGHT) th = TILE_HEIGHT - ty;
+  transfer((unsigned long)th * (tw * 8 + PAGE_OVERHEAD));
+}
+
+void U8G2::drawPixel(int x, int y) {
+  if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) return;
+  uint8_t bit = 1 << (y & 7);
+  if (color_) buffer_[(y >> 3) * WIDTH + x] |= bit;
+  else buffer_[(y >> 3) * WIDTH + x] &= ~bit;
+}
+
+void U8G2::drawBox(int x, int y, int w, int h) {
+  for (int yy = y; yy < y + h; yy++)
+    for (int xx = x; xx < x + w; xx++) drawPixel(xx, yy);
+}
+
+// Glyphs are not real 6x10 shapes, just a stable 5x7 pattern per character so
+// that a change of text changes the same pixels the real font would touch.
+uint16_t U8G2::drawStr(int x, int y, const char *s) {
+  int startX = x;
+  for (; *s; s++, x += 6) {
+    uint8_t c = (uint8_t)*s;
+    if (c == ' ') continue;
+    uint32_t pattern = c * 2654435761u;
+    for (int col = 0; col < 5; col++) {
+      for (int row = 0; row < 7; row++) {
+        if (pattern & (1u << ((col * 7 + row) % 32))) drawPixel(x + col, y - 7 + row);
+      }
+    }
+  }
+  return (uint16_t)(x - startX);
+}
@@ -0,0 +1,52 @@
+// Host stand-in for U8g2 with an in-memory SH1106 frame buffer
+#pragma once
+
+#include <Arduino.h>
+
+typedef struct { uint8_t rotation; } u8g2_cb_t;
+extern const u8g2_cb_t *U8G2_R0;
+extern const uint8_t u8g2_font_6x10_tr[];
+
+#define U8X8_PIN_NONE 255
+
+class U8G2 {
+public:
+  static const int WIDTH = 128;
+  static const int HEIGHT = 64;
+  static const int TILE_WIDTH = WIDTH / 8;
+  static const int TILE_HEIGHT = HEIGHT / 8;
+
+  bool begin() { clearBuffer(); return true; }
+  void setPowerSave(uint8_t on) { (void)on; }
+  void setFont(const uint8_t *font) { (void)font; }
+  void setDrawColor(uint8_t color) { color_ = color; }
+
+  void clearBuffer() { memset(buffer_, 0, sizeof(buffer_)); }
+  void clearDisplay() { clearBuffer(); sendBuffer(); }
+  void sendBuffer();
+  void updateDisplay() { sendBuffer(); }
+  void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+
+  uint16_t drawStr(int x, int y, const char *s);
+  uint16_t getStrWidth(const char *s) const { return (uint16_t)(strlen(s) * 6); }
+  void drawBox(int x, int y, int w, int h);
+  void drawPixel(int x, int y);
+
+  uint8_t *getBufferPtr() { return buffer_; }
+  uint8_t getBufferTileWidth() const { return TILE_WIDTH; }
+  uint8_t getBufferTileHeight() const { return TILE_HEIGHT; }
+
+private:
+  void transfer(unsigned long bytes);
+
+  uint8_t buffer_[WIDTH * HEIGHT / 8];
+  uint8_t color_ = 1;
+};
+
+class U8G2_SH1106_128X64_NONAME_F_HW_I2C : public U8G2 {
+public:
+  U8G2_SH1106_128X64_NONAME_F_HW_I2C(const u8g2_cb_t *rotation, uint8_t reset = U8X8_PIN_NONE,
+                                     uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE) {
+    (void)rotation; (void)reset; (void)clock; (void)data;
+  }
+};
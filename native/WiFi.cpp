@@ -0,0 +1,16 @@
+#include <WiFi.h>
+#include <Wire.h>
+
+WiFiClass WiFi;
+TwoWire Wire;
+
+static const uint8_t simMac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+void WiFiClass::macAddress(uint8_t *mac) const { memcpy(mac, simMac, 6); }
+
+String WiFiClass::macAddress() const {
+  char buf[18];
+  snprintf(buf, sizeof(buf), "%02X:%02X:%02X:%02X:%02X:%02X",
+           simMac[0], simMac[1], simMac[2], simMac[3], simMac[4], simMac[5]);
+  return String(buf);
+}
@@ -0,0 +1,19 @@
+// Host stand-in for the ESP32 WiFi library
+#pragma once
+
+#include <Arduino.h>
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class WiFiClass {
+public:
+  bool mode(wifi_mode_t m) { mode_ = m; return true; }
+  wifi_mode_t getMode() const { return mode_; }
+  void macAddress(uint8_t *mac) const;
+  String macAddress() const;
+
+private:
+  wifi_mode_t mode_ = WIFI_OFF;
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,12 @@
+// Host stand-in for the Arduino Wire library
+#pragma once
+
+#include <Arduino.h>
+
+class TwoWire {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t freq = 0) { (void)sda; (void)scl; (void)freq; return true; }
+  bool setClock(uint32_t freq) { (void)freq; return true; }
+};
+
+extern TwoWire Wire;
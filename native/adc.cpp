@@ -0,0 +1,145 @@
+#include <Arduino.h>
+#include <driver/adc.h>
+
+#include <deque>
+#include <vector>
+
+#include "sim.h"
+
+static int potRaw = 0;
+
+static std::vector<uint16_t> trace;
+static unsigned long tracePeriodUs = 1000;
+static unsigned long long traceStartUs = 0;
+
+static bool initialized = false;
+static bool running = false;
+static adc_digi_init_config_t initConfig;
+static uint32_t sampleHz = 0;
+static uint8_t channel = 0;
+static unsigned long long nextSampleUs = 0;
+static std::vector<uint8_t> frame;  // conversion frame being filled
+static std::deque<uint8_t> stored;  // completed frames not yet read
+static bool overflowed = false;
+
+// Simulated wiper voltage at time us
+static uint16_t rawAt(unsigned long long us) {
+  if (trace.empty()) return (uint16_t)potRaw;
+  unsigned long long i = us < traceStartUs ? 0 : (us - traceStartUs) / tracePeriodUs;
+  return trace[i < trace.size() ? i : trace.size() - 1];
+}
+
+uint16_t analogRead(uint8_t pin) {
+  (void)pin;
+  return rawAt(micros());
+}
+
+void simSetPot(int raw) {
+  potRaw = constrain(raw, 0, 4095);
+  trace.clear();
+}
+
+bool simLoadAdcTrace(const char *path, unsigned long periodUs) {
+  FILE *f = fopen(path, "r");
+  if (!f) return false;
+  std::vector<uint16_t> values;
+  char line[64];
+  while (fgets(line, sizeof(line), f)) {
+    if (line[0] == '#') continue;
+    char *end;
+    long v = strtol(line, &end, 10);
+    if (end != line) values.push_back((uint16_t)constrain(v, 0, 4095));
+  }
+  fclose(f);
+  if (values.empty()) return false;
+  simSetAdcTrace(values.data(), values.size(), periodUs);
+  return true;
+}
+
+void simSetAdcTrace(const uint16_t *values, size_t count, unsigned long periodUs) {
+  trace.assign(values, values + count);
+  tracePeriodUs = periodUs ? periodUs : 1;
+  traceStartUs = micros();
+}
+
+unsigned long long simAdcTraceEndMicros() { return traceStartUs + (unsigned long long)trace.size() * tracePeriodUs; }
+
+esp_err_t adc_digi_initialize(const adc_digi_init_config_t *init_config) {
+  if (!init_config || init_config->conv_num_each_intr == 0 ||
+      init_config->conv_num_each_intr % SOC_ADC_DIGI_RESULT_BYTES != 0 ||
+      init_config->max_store_buf_size < init_config->conv_num_each_intr) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  initConfig = *init_config;
+  initialized = true;
+  return ESP_OK;
+}
+
+esp_err_t adc_digi_deinitialize() {
+  initialized = running = false;
+  stored.clear();
+  frame.clear();
+  return ESP_OK;
+}
+
+esp_err_t adc_digi_controller_configure(const adc_digi_configuration_t *config) {
+  if (!initialized) return ESP_ERR_INVALID_STATE;
+  if (!config || config->pattern_num != 1 || !config->adc_pattern || config->sample_freq_hz == 0 ||
+      config->format != ADC_DIGI_OUTPUT_FORMAT_TYPE2) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  sampleHz = config->sample_freq_hz;
+  channel = config->adc_pattern[0].channel;
+  return ESP_OK;
+}
+
+esp_err_t adc_digi_start() {
+  if (!initialized || sampleHz == 0) return ESP_ERR_INVALID_STATE;
+  running = true;
+  nextSampleUs = micros();
+  return ESP_OK;
+}
+
+esp_err_t adc_digi_stop() {
+  running = false;
+  return ESP_OK;
+}
+
+// Catches the DMA up with the virtual clock
+static void convert() {
+  unsigned long long now = micros();
+  while (nextSampleUs <= now) {
+    adc_digi_output_data_t result = {};
+    result.type2.data = rawAt(nextSampleUs);
+    result.type2.channel = channel;
+    const uint8_t *bytes = (const uint8_t *)&result.val;
+    frame.insert(frame.end(), bytes, bytes + sizeof(result.val));
+    if (frame.size() == initConfig.conv_num_each_intr) {
+      if (stored.size() + frame.size() > initConfig.max_store_buf_size) {
+        stored.erase(stored.begin(), stored.begin() + frame.size());
+        overflowed = true;
+      }
+      stored.insert(stored.end(), frame.begin(), frame.end());
+      frame.clear();
+    }
+    nextSampleUs += 1000000ULL / sampleHz;
+  }
+}
+
+esp_err_t adc_digi_read_bytes(uint8_t *buf, uint32_t length_max, uint32_t *out_length, uint32_t timeout_ms) {
+  (void)timeout_ms;
+  *out_length = 0;
+  if (!running) return ESP_ERR_INVALID_STATE;
+  convert();
+
+  uint32_t n = stored.size() < length_max ? stored.size() : length_max;
+  n -= n % SOC_ADC_DIGI_RESULT_BYTES;
+  if (n == 0) return ESP_ERR_TIMEOUT;
+  for (uint32_t i = 0; i < n; i++) buf[i] = stored[i];
+  stored.erase(stored.begin(), stored.begin() + n);
+  *out_length = n;
+
+  esp_err_t err = overflowed ? ESP_ERR_INVALID_STATE : ESP_OK;
+  overflowed = false;
+  return err;
+}
@@ -0,0 +1,75 @@
+#include <esp_now.h>
+
+#include <deque>
+#include <set>
+#include <vector>
+
+#include "sim.h"
+
+struct PendingFrame {
+  uint8_t mac[ESP_NOW_ETH_ALEN];
+  std::vector<uint8_t> data;
+};
+
+static bool initialized = false;
+static esp_now_recv_cb_t recvCb = nullptr;
+static esp_now_send_cb_t sendCb = nullptr;
+static std::set<std::vector<uint8_t> > peers;
+static std::deque<PendingFrame> inbound;
+static sim_radio_cb_t radioHandler = nullptr;
+
+static std::vector<uint8_t> macKey(const uint8_t *mac) {
+  return std::vector<uint8_t>(mac, mac + ESP_NOW_ETH_ALEN);
+}
+
+esp_err_t esp_now_init() { initialized = true; return ESP_OK; }
+esp_err_t esp_now_deinit() { initialized = false; return ESP_OK; }
+esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t cb) { recvCb = cb; return ESP_OK; }
+esp_err_t esp_now_register_send_cb(esp_now_send_cb_t cb) { sendCb = cb; return ESP_OK; }
+
+esp_err_t esp_now_add_peer(const esp_now_peer_info_t *peer) {
+  if (!peer) return ESP_ERR_ESPNOW_ARG;
+  if (peers.size() >= ESP_NOW_MAX_TOTAL_PEER_NUM && !peers.count(macKey(peer->peer_addr))) {
+    return ESP_ERR_ESPNOW_FULL;
+  }
+  peers.insert(macKey(peer->peer_addr));
+  return ESP_OK;
+}
+
+esp_err_t esp_now_del_peer(const uint8_t *peer_addr) {
+  return peers.erase(macKey(peer_addr)) ? ESP_OK : ESP_ERR_ESPNOW_NOT_FOUND;
+}
+
+bool esp_now_is_peer_exist(const uint8_t *peer_addr) {
+  return peers.count(macKey(peer_addr)) > 0;
+}
+
+esp_err_t esp_now_send(const uint8_t *peer_addr, const uint8_t *data, size_t len) {
+  if (!initialized || !data || len == 0 || len > ESP_NOW_MAX_DATA_LEN) return ESP_ERR_ESPNOW_ARG;
+  if (!peers.count(macKey(peer_addr))) return ESP_ERR_ESPNOW_NOT_FOUND;
+  SimStats &stats = simMutableStats();
+  stats.espNowSends++;
+  stats.espNowBytes += len;
+
+  if (radioHandler) radioHandler(peer_addr, data, (int)len);
+  if (sendCb) sendCb(peer_addr, ESP_NOW_SEND_SUCCESS);
+  return ESP_OK;
+}
+
+void simSetRadioHandler(sim_radio_cb_t handler) { radioHandler = handler; }
+
+void simDeliver(const uint8_t *mac, const uint8_t *data, int len) {
+  PendingFrame frame;
+  memcpy(frame.mac, mac, ESP_NOW_ETH_ALEN);
+  frame.data.assign(data, data + len);
+  inbound.push_back(frame);
+}
+
+void simPollRadio() {
+  while (!inbound.empty()) {
+    PendingFrame frame = inbound.front();
+    inbound.pop_front();
+    simMutableStats().espNowReceives++;
+    if (recvCb) recvCb(frame.mac, frame.data.data(), (int)frame.data.size());
+  }
+}
@@ -0,0 +1,95 @@
+#include <esp_partition.h>
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "sim.h"
+
+struct SimPartition {
+  esp_partition_t info;
+  uint8_t *data;
+};
+
+// Keep in sync with partitions.csv
+static SimPartition partitions[] = {
+  {{ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)0x40, 0x290000, 0x160000, "msglog", false}, nullptr},
+  {{ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)0x41, 0x230000, 0x60000, "msgidx", false}, nullptr},
+};
+
+static uint8_t *mapPartition(const esp_partition_t &info) {
+  const char *dir = getenv("SIM_FLASH_DIR");
+  if (!dir) {
+    uint8_t *mem = (uint8_t *)malloc(info.size);
+    if (mem) memset(mem, 0xFF, info.size);
+    return mem;
+  }
+
+  char path[512];
+  snprintf(path, sizeof(path), "%s/%s.bin", dir, info.label);
+  int fd = open(path, O_RDWR | O_CREAT, 0644);
+  if (fd < 0) return nullptr;
+  off_t existing = lseek(fd, 0, SEEK_END);
+  if (ftruncate(fd, info.size) != 0) { close(fd); return nullptr; }
+  void *mem = mmap(nullptr, info.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mem == MAP_FAILED) return nullptr;
+  if (existing < (off_t)info.size) memset((uint8_t *)mem + existing, 0xFF, info.size - existing);
+  return (uint8_t *)mem;
+}
+
+static SimPartition *findPartition(const esp_partition_t *partition) {
+  for (SimPartition &p : partitions) {
+    if (&p.info == partition) return p.data ? &p : nullptr;
+  }
+  return nullptr;
+}
+
+static bool inRange(const esp_partition_t *partition, size_t offset, size_t size) {
+  return offset <= partition->size && size <= partition->size - offset;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label) {
+  for (SimPartition &p : partitions) {
+    if (p.info.type != type) continue;
+    if (subtype != ESP_PARTITION_SUBTYPE_ANY && p.info.subtype != subtype) continue;
+    if (label && strcmp(label, p.info.label) != 0) continue;
+    if (!p.data) p.data = mapPartition(p.info);
+    return p.data ? &p.info : nullptr;
+  }
+  return nullptr;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst, size_t size) {
+  SimPartition *p = findPartition(partition);
+  if (!p || !dst) return ESP_ERR_INVALID_ARG;
+  if (!inRange(partition, src_offset, size)) return ESP_ERR_INVALID_SIZE;
+  memcpy(dst, p->data + src_offset, size);
+  simMutableStats().flashBytesRead += size;
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t dst_offset, const void *src, size_t size) {
+  SimPartition *p = findPartition(partition);
+  if (!p || !src) return ESP_ERR_INVALID_ARG;
+  if (!inRange(partition, dst_offset, size)) return ESP_ERR_INVALID_SIZE;
+  const uint8_t *in = (const uint8_t *)src;
+  for (size_t i = 0; i < size; i++) p->data[dst_offset + i] &= in[i];
+  simMutableStats().flashBytesWritten += size;
+  simMutableStats().flashWrites++;
+  return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size) {
+  SimPartition *p = findPartition(partition);
+  if (!p) return ESP_ERR_INVALID_ARG;
+  if (!inRange(partition, offset, size) || offset % SPI_FLASH_SEC_SIZE || size % SPI_FLASH_SEC_SIZE)
+    return ESP_ERR_INVALID_SIZE;
+  memset(p->data + offset, 0xFF, size);
+  simMutableStats().flashErases += size / SPI_FLASH_SEC_SIZE;
+  return ESP_OK;
+}
@@ -0,0 +1,78 @@
+#include <esp_timer.h>
+
+#include <Arduino.h>
+#include <vector>
+
+#include "sim.h"
+
+struct esp_timer {
+  esp_timer_cb_t callback;
+  void *arg;
+  bool armed;
+  uint64_t period;  // 0 for one-shot
+  unsigned long long due;
+};
+
+static std::vector<esp_timer *> timers;
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *out_handle) {
+  if (!create_args || !create_args->callback || !out_handle) return ESP_ERR_INVALID_ARG;
+  esp_timer *timer = new esp_timer{create_args->callback, create_args->arg, false, 0, 0};
+  timers.push_back(timer);
+  *out_handle = timer;
+  return ESP_OK;
+}
+
+static esp_err_t start(esp_timer_handle_t timer, uint64_t us, uint64_t period) {
+  if (!timer || us == 0) return ESP_ERR_INVALID_ARG;
+  if (timer->armed) return ESP_ERR_INVALID_STATE;
+  timer->armed = true;
+  timer->period = period;
+  timer->due = micros() + us;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period) { return start(timer, period, period); }
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) { return start(timer, timeout_us, 0); }
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+  if (!timer || !timer->armed) return ESP_ERR_INVALID_STATE;
+  timer->armed = false;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+  if (!timer) return ESP_ERR_INVALID_ARG;
+  if (timer->armed) return ESP_ERR_INVALID_STATE;
+  for (size_t i = 0; i < timers.size(); i++) {
+    if (timers[i] == timer) timers.erase(timers.begin() + i);
+  }
+  delete timer;
+  return ESP_OK;
+}
+
+int64_t esp_timer_get_time() { return (int64_t)micros(); }
+
+bool simNextTimer(unsigned long long &due) {
+  bool found = false;
+  for (esp_timer *t : timers) {
+    if (t->armed && (!found || t->due < due)) {
+      due = t->due;
+      found = true;
+    }
+  }
+  return found;
+}
+
+void simFireTimers(unsigned long long now) {
+  for (size_t i = 0; i < timers.size(); i++) {
+    esp_timer *t = timers[i];
+    if (!t->armed || t->due > now) continue;
+    if (t->period) {
+      t->due += t->period;
+    } else {
+      t->armed = false;
+    }
+    t->callback(t->arg);
+  }
+}
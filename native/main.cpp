@@ -0,0 +1,435 @@
+// Host driver for [env:native]: runs setup()/loop() against the stand-ins and
+// types scripted messages through the keypad and potentiometer.
+//
+//   program [--messages N] [--text STR] [--loops N] [--peer] [--i2c-hz HZ]
+//           [--input knob|abc|t9] [--adc-trace FILE [--adc-trace-us US]]
+//           [--json FILE]
+//
+// --peer adds a second node in range, built from the same libraries, which
+// answers every message it receives with the same text. Each message is
+// then timed end to end, from the '#' tap that sends it to the echo on the
+// screen, in device time: through encryption, framing, the radio, the
+// peer, onReceive, decryption, saveMessage and render.
+//
+// --input picks how the text is typed: turning the knob and pressing '0'
+// (the default), multi-tap, or T9 (words missing from the dictionary fall
+// back to multi-tap).
+//
+// --adc-trace replays recorded knob readings (one raw value per line, every
+// US microseconds, default 250) after the scripted messages and reports how
+// the sketch's filtered slot index followed them.
+//
+// --json also writes the results to FILE, for tools/e2e_bench.py to collect
+// and compare between commits. Counts are per message and exclude setup.
+#include <Arduino.h>
+#include <Fragmenter.h>
+#include <FrameCipher.h>
+#include <KnobFilter.h>
+#include <MessageLog.h>
+#include <Metrics.h>
+#include <MultiTap.h>
+#include <Mesh.h>
+#include <Preferences.h>
+#include <ReliableLink.h>
+#include <T9.h>
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <vector>
+
+#include "sim.h"
+
+// Mirrors the character wheel in the sketch
+static const char characterSet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 ";
+static const int numCharacters = sizeof(characterSet) - 1;
+static const int extraSlotsBetween = 3;
+static const int totalSlots = numCharacters * (extraSlotsBetween + 1) - extraSlotsBetween;
+
+static const unsigned long LOOP_TICK_US = 100;
+static const unsigned long ECHO_TIMEOUT_US = 5000000;
+
+static unsigned long loopsRun = 0;
+
+// From the sketch
+extern KnobFilter knob;
+extern MessageLog messageLog;
+extern Counter potOverruns;
+extern T9Input t9;
+extern bool newMessageReceived;
+
+// Heap allocations by the sketch, the libraries and the stand-ins
+static unsigned long allocations = 0;
+
+void *operator new(size_t size) {
+  allocations++;
+  void *p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+enum Input { INPUT_BY_KNOB, INPUT_BY_MULTITAP, INPUT_BY_T9 };
+static Input input = INPUT_BY_KNOB;
+static unsigned long keysPressed = 0;
+
+// Echo peer
+static const uint8_t deviceMac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+static const uint8_t peerMac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x02};
+static const uint16_t PEER_ID = 0x0002;
+
+// Provisioned into the sketch's Preferences before setup(), as the serial
+// console's "key" command would
+static const uint8_t networkKey[FrameCipher::KEY_LEN] = {
+  0x3c, 0x8e, 0x51, 0x07, 0xd2, 0x94, 0x6a, 0xf1, 0x2b, 0x70, 0xc9, 0x15, 0xe8, 0x46, 0xbd, 0x33,
+};
+
+static bool peerSend(void *ctx, const uint8_t *mac, const uint8_t *frame, size_t len, bool forwarded) {
+  simDeliver(peerMac, frame, (int)len);
+  return true;
+}
+
+static bool peerTransmit(void *ctx, const uint8_t *frame, size_t len);
+
+static Mesh peerMesh(peerSend, nullptr);
+static Fragmenter peerFragmenter(nullptr);
+static ReliableLink peerLink(peerTransmit, Fragmenter::linkStatus, &peerFragmenter);
+static FrameCipher peerCipher;
+static bool peerEnabled = false;
+static unsigned long peerEchoes = 0;
+static std::vector<unsigned long> echoLatencyUs;
+static unsigned long echoTimeouts = 0;
+
+static bool peerTransmit(void *ctx, const uint8_t *frame, size_t len) { return peerMesh.transmit(frame, len); }
+
+// Everything the device sends reaches the peer
+static void peerRadio(const uint8_t *mac, const uint8_t *data, int len) {
+  if (memcmp(mac, peerMac, 6) != 0 && memcmp(mac, Mesh::BROADCAST_MAC, 6) != 0) return;
+
+  FrameView frame;
+  if (!frameDecode(data, len, frame)) return;
+  if (!peerMesh.receive(deviceMac, data, len, frame, millis())) return;
+  uint8_t plain[FRAME_MAX_PAYLOAD];
+  uint32_t epoch = 0;
+  int plainLen = peerCipher.open(frame, plain, &epoch);
+  if (plainLen < 0) return;
+  frame.payload = plain;
+  frame.payloadLen = plainLen;
+  peerMesh.heard(deviceMac, frame.header, millis());
+  if (frame.header.type == FRAME_BEACON || !peerLink.receive(frame, millis(), epoch) ||
+      frame.header.type != FRAME_TEXT) {
+    return;
+  }
+  uint8_t text[Fragmenter::MAX_MESSAGE_LEN];
+  size_t textLen = peerFragmenter.receive(frame, text, sizeof(text), millis());
+  if (textLen > 0 && peerFragmenter.send(frame.header.sender, text, textLen, 0)) peerEchoes++;
+}
+
+static void servicePeer() {
+  peerLink.tick(millis());
+  peerMesh.tick(millis());
+  peerFragmenter.pump(peerLink, millis());
+  peerFragmenter.expire(millis());
+}
+
+static void runLoop() {
+  if (peerEnabled) servicePeer();
+  simPollRadio();
+  loop();
+  simAdvanceMicros(LOOP_TICK_US);
+  loopsRun++;
+}
+
+static int potForChar(char c) {
+  const char *p = strchr(characterSet, c);
+  int charIndex = p ? (int)(p - characterSet) : numCharacters - 1;
+  return KnobFilter::slotCentre(charIndex * (extraSlotsBetween + 1), totalSlots);
+}
+
+// The sketch filters the knob and scans the keypad over time, so let both
+// settle after each turn or press
+static void settle() {
+  unsigned long start = micros();
+  while (micros() - start < 20000) runLoop();
+}
+
+// Runs until the tap is over and the scan has reported its release
+static void pressAndRun(char key) {
+  keysPressed++;
+  simPressKey(key);
+  while (!simKeysIdle()) runLoop();
+  settle();
+}
+
+static char keyForChar(char c) {
+  for (char key = '0'; key <= '9'; key++) {
+    if (strchr(MultiTap::letters(key), c)) return key;
+  }
+  return 0;
+}
+
+static void multiTapChar(char c) {
+  static char lastKey = 0;
+  char key = keyForChar(c);
+  if (!key) return;
+  // Wait out the timeout before another letter on the same key
+  if (key == lastKey) {
+    unsigned long start = micros();
+    while (micros() - start < 1100000) runLoop();
+  }
+  for (const char *l = MultiTap::letters(key); *l != c; l++) pressAndRun(key);
+  pressAndRun(key);
+  lastKey = key;
+}
+
+// Types a word with T9 if the dictionary has it, else with multi-tap
+static void t9Word(const char *word, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    if (!T9Dictionary::keyFor(word[i])) break;
+    pressAndRun(T9Dictionary::keyFor(word[i]));
+    if (i + 1 < len) continue;
+    for (int n = 0; n < t9.choices() && (strlen(t9.text()) != len || strncmp(t9.text(), word, len)); n++) {
+      pressAndRun('1');
+    }
+    if (strlen(t9.text()) == len && !strncmp(t9.text(), word, len)) return;
+  }
+  while (!t9.empty()) pressAndRun('*');
+  pressAndRun('B');  // T9 -> Knob
+  pressAndRun('B');  // Knob -> ABC
+  for (size_t i = 0; i < len; i++) multiTapChar(word[i]);
+  pressAndRun('B');  // ABC -> T9
+}
+
+static void typeMessage(const char *text) {
+  if (input == INPUT_BY_T9) {
+    for (const char *c = text; *c;) {
+      size_t len = strcspn(c, " ");
+      if (len > 0) t9Word(c, len);
+      c += len;
+      if (*c == ' ') {
+        pressAndRun('0');
+        c++;
+      }
+    }
+  }
+  for (const char *c = text; *c && input != INPUT_BY_T9; c++) {
+    if (input == INPUT_BY_MULTITAP) {
+      multiTapChar(*c);
+      continue;
+    }
+    simSetPot(potForChar(*c));
+    settle();
+    pressAndRun('0');
+  }
+  if (!peerEnabled) {
+    pressAndRun('#');
+    return;
+  }
+
+  // The echo opens the "Received:" screen, rendered in the same pass
+  unsigned long sentUs = micros();
+  keysPressed++;
+  simPressKey('#');
+  while (!newMessageReceived && micros() - sentUs < ECHO_TIMEOUT_US) runLoop();
+  if (newMessageReceived) echoLatencyUs.push_back(micros() - sentUs);
+  else echoTimeouts++;
+  while (!simKeysIdle()) runLoop();
+  settle();
+  pressAndRun('1');  // dismiss it
+}
+
+// Exact percentile (per mille) of sorted samples
+static unsigned long percentile(const std::vector<unsigned long> &sorted, int perMille) {
+  if (sorted.empty()) return 0;
+  size_t rank = (sorted.size() * perMille + 999) / 1000;
+  return sorted[rank ? rank - 1 : 0];
+}
+
+struct Results {
+  const char *input;
+  const char *text;
+  long messages;
+  double hostSec;
+  double virtualSec;
+  unsigned long allocations;
+  std::vector<unsigned long> latencyUs;  // sorted
+};
+
+static bool writeJson(const char *path, const Results &r) {
+  FILE *f = fopen(path, "w");
+  if (!f) return false;
+  const SimStats &stats = simStats();
+  double n = r.messages > 0 ? r.messages : 1;
+  fprintf(f, "{\n");
+  fprintf(f, "  \"input\": \"%s\",\n  \"text_length\": %zu,\n  \"messages\": %ld,\n  \"peer\": %s,\n", r.input,
+          strlen(r.text), r.messages, peerEnabled ? "true" : "false");
+  fprintf(f, "  \"host_seconds\": %.4f,\n  \"messages_per_second\": %.1f,\n  \"device_seconds\": %.3f,\n",
+          r.hostSec, r.messages / r.hostSec, r.virtualSec);
+  if (peerEnabled) {
+    fprintf(f, "  \"echoes\": %zu,\n  \"echo_timeouts\": %lu,\n", r.latencyUs.size(), echoTimeouts);
+    fprintf(f, "  \"latency_us\": {\"p50\": %lu, \"p99\": %lu, \"max\": %lu},\n", percentile(r.latencyUs, 500),
+            percentile(r.latencyUs, 990), percentile(r.latencyUs, 1000));
+  }
+  fprintf(f, "  \"key_presses_per_message\": %.2f,\n", keysPressed / n);
+  fprintf(f, "  \"allocations_per_message\": %.2f,\n", r.allocations / n);
+  fprintf(f, "  \"flash_bytes_per_message\": %.2f,\n", stats.flashBytesWritten / n);
+  fprintf(f, "  \"flash_writes_per_message\": %.3f,\n", stats.flashWrites / n);
+  fprintf(f, "  \"radio_bytes_per_message\": %.2f,\n", stats.espNowBytes / n);
+  fprintf(f, "  \"i2c_bytes_per_message\": %.1f,\n", stats.i2cBytes / n);
+  fprintf(f, "  \"metrics\": {");
+  const char *sep = "\n";
+  for (const Histogram *h = Histogram::first(); h; h = h->next()) {
+    fprintf(f, "%s    \"%s\": {\"unit\": \"%s\", \"count\": %lu, \"mean\": %lu, ", sep, h->name(), h->unit(),
+            (unsigned long)h->count(), (unsigned long)h->mean());
+    fprintf(f, "\"p50\": %lu, \"p99\": %lu, \"max\": %lu}", (unsigned long)h->percentile(500),
+            (unsigned long)h->percentile(990), (unsigned long)h->max());
+    sep = ",\n";
+  }
+  fprintf(f, "\n  }\n}\n");
+  return fclose(f) == 0;
+}
+
+int main(int argc, char **argv) {
+  long messages = 100;
+  long idleLoops = 1000;
+  const char *text = "HELLO WORLD";
+  const char *inputName = "knob";
+  const char *adcTrace = nullptr;
+  unsigned long adcTraceUs = 250;
+  const char *jsonPath = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--messages") && i + 1 < argc) messages = atol(argv[++i]);
+    else if (!strcmp(argv[i], "--loops") && i + 1 < argc) idleLoops = atol(argv[++i]);
+    else if (!strcmp(argv[i], "--text") && i + 1 < argc) text = argv[++i];
+    else if (!strcmp(argv[i], "--peer")) peerEnabled = true;
+    else if (!strcmp(argv[i], "--i2c-hz") && i + 1 < argc) simSetI2cHz(strtoul(argv[++i], nullptr, 10));
+    else if (!strcmp(argv[i], "--input") && i + 1 < argc) inputName = argv[++i];
+    else if (!strcmp(argv[i], "--adc-trace") && i + 1 < argc) adcTrace = argv[++i];
+    else if (!strcmp(argv[i], "--adc-trace-us") && i + 1 < argc) adcTraceUs = strtoul(argv[++i], nullptr, 10);
+    else if (!strcmp(argv[i], "--json") && i + 1 < argc) jsonPath = argv[++i];
+    else {
+      fprintf(stderr,
+              "usage: %s [--messages N] [--text STR] [--loops N] [--peer] [--i2c-hz HZ]"
+              " [--input knob|abc|t9] [--adc-trace FILE [--adc-trace-us US]] [--json FILE]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+  if (!strcmp(inputName, "abc")) {
+    input = INPUT_BY_MULTITAP;
+  } else if (!strcmp(inputName, "t9")) {
+    input = INPUT_BY_T9;
+  } else if (strcmp(inputName, "knob") != 0) {
+    fprintf(stderr, "unknown input '%s'\n", inputName);
+    return 2;
+  }
+
+  if (peerEnabled) {
+    simSetRadioHandler(peerRadio);
+    peerLink.begin(PEER_ID, 0);
+    peerMesh.begin(PEER_ID, millis());
+    peerCipher.begin(networkKey, PEER_ID);
+    peerLink.setSealer(FrameCipher::sealFrame, &peerCipher);
+    peerMesh.setSealer(FrameCipher::sealFrame, &peerCipher);
+  }
+  Preferences prefs;
+  prefs.begin("crypto", false);
+  prefs.putBytes("key", networkKey, sizeof(networkKey));
+  prefs.end();
+  setup();
+
+  // Wait for the peer's first beacon, then address messages to it
+  if (peerEnabled) {
+    while (millis() < 1500) runLoop();
+    pressAndRun('A');
+  }
+  // Switch the sketch from the knob to multi-tap or T9
+  for (int i = 0; i < input; i++) pressAndRun('B');
+  simResetStats();
+  for (Histogram *h = Histogram::first(); h; h = h->next()) h->reset();
+  keysPressed = 0;
+  unsigned long allocationsBefore = allocations;
+
+  unsigned long startVirtualUs = micros();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  for (long m = 0; m < messages; m++) typeMessage(text);
+  for (long i = 0; i < idleLoops; i++) runLoop();
+  // Let the last history batch reach flash
+  for (unsigned long idleStart = micros(); messageLog.pending() > 0 && micros() - idleStart < ECHO_TIMEOUT_US;) {
+    runLoop();
+  }
+  unsigned long allocationsRun = allocations - allocationsBefore;
+
+  unsigned long knobSamples = knob.samples();
+  unsigned long knobChanges = 0;
+  if (adcTrace) {
+    if (!simLoadAdcTrace(adcTrace, adcTraceUs)) {
+      fprintf(stderr, "cannot read ADC trace %s\n", adcTrace);
+      return 2;
+    }
+    int lastIndex = knob.index();
+    while (micros() < simAdcTraceEndMicros()) {
+      runLoop();
+      if (knob.index() != lastIndex) knobChanges++;
+      lastIndex = knob.index();
+    }
+  }
+
+  double hostSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  double virtualSec = (micros() - startVirtualUs) / 1e6;
+  const SimStats &stats = simStats();
+
+  printf("\n--- native run ---\n");
+  printf("loops            %lu\n", loopsRun);
+  printf("messages         %ld (%.1f key presses each)\n", messages, messages ? (double)keysPressed / messages : 0.0);
+  printf("host time        %.3f s (%.0f loops/s, %.0f msgs/s)\n", hostSec,
+         loopsRun / hostSec, messages / hostSec);
+  printf("device time      %.3f s (%.1f loops/s, %.2f msgs/s)\n", virtualSec,
+         loopsRun / virtualSec, messages / virtualSec);
+  printf("allocations      %.1f per message\n", messages ? (double)allocationsRun / messages : 0.0);
+  printf("esp_now sends    %lu (%lu bytes)\n", stats.espNowSends, stats.espNowBytes);
+  printf("esp_now receives %lu\n", stats.espNowReceives);
+  printf("display flushes  %lu (%lu I2C bytes)\n", stats.framesFlushed, stats.i2cBytes);
+  printf("prefs writes     %lu, reads %lu\n", stats.prefsWrites, stats.prefsReads);
+  printf("flash            %lu bytes written in %lu writes, %lu read, %lu sector erases\n",
+         stats.flashBytesWritten, stats.flashWrites, stats.flashBytesRead, stats.flashErases);
+  const MessageLog::Stats &log = messageLog.stats();
+  if (log.records > 0) {
+    printf("history          %lu records, %.1f flash bytes each, write amplification %.2f, %lu pending\n",
+           (unsigned long)log.records, (double)log.bytesWritten / log.records,
+           (double)log.bytesWritten / log.payloadBytes, (unsigned long)messageLog.pending());
+  }
+  if (adcTrace) {
+    printf("adc trace        %lu samples filtered, %lu slot changes, final slot %d, %lu overruns\n",
+           knob.samples() - knobSamples, knobChanges, knob.index(), (unsigned long)potOverruns.value());
+  }
+  for (const Histogram *h = Histogram::first(); h; h = h->next()) {
+    if (h->count() == 0) continue;
+    printf("%-16s %lu samples, avg %lu, p50 <= %lu, p99 <= %lu, max %lu %s\n", h->name(), (unsigned long)h->count(),
+           (unsigned long)h->mean(), (unsigned long)h->percentile(500), (unsigned long)h->percentile(990),
+           (unsigned long)h->max(), h->unit());
+  }
+  std::sort(echoLatencyUs.begin(), echoLatencyUs.end());
+  if (peerEnabled) {
+    printf("peer             %lu echoes, %u ACKs sent, %u duplicates\n", peerEchoes,
+           (unsigned)peerLink.stats().acksSent, (unsigned)peerLink.stats().duplicates);
+    printf("end to end       p50 %.2f ms, p99 %.2f ms, max %.2f ms, %lu timeouts\n",
+           percentile(echoLatencyUs, 500) / 1000.0, percentile(echoLatencyUs, 990) / 1000.0,
+           percentile(echoLatencyUs, 1000) / 1000.0, echoTimeouts);
+  }
+
+  if (jsonPath) {
+    Results results = {inputName, text, messages, hostSec, virtualSec, allocationsRun, echoLatencyUs};
+    if (!writeJson(jsonPath, results)) {
+      fprintf(stderr, "cannot write %s\n", jsonPath);
+      return 2;
+    }
+  }
+  return 0;
+}
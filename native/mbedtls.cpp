@@ -0,0 +1,202 @@
+#include <mbedtls/gcm.h>
+#include <string.h>
+
+// AES-128 (FIPS-197), byte oriented
+
+static const uint8_t sbox[256] = {
+  0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+  0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+  0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+  0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+  0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+  0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+  0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+  0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+  0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+  0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+  0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+  0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+  0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+  0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+  0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+  0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+static uint8_t xtime(uint8_t x) { return (uint8_t)(x << 1 ^ (x & 0x80 ? 0x1b : 0)); }
+
+void mbedtls_aes_init(mbedtls_aes_context *ctx) { memset(ctx, 0, sizeof(*ctx)); }
+void mbedtls_aes_free(mbedtls_aes_context *ctx) { memset(ctx, 0, sizeof(*ctx)); }
+
+int mbedtls_aes_setkey_enc(mbedtls_aes_context *ctx, const unsigned char *key, unsigned int keybits) {
+  if (keybits != 128) return MBEDTLS_ERR_AES_INVALID_KEY_LENGTH;
+  memcpy(ctx->rk, key, 16);
+  uint8_t rcon = 1;
+  for (int i = 16; i < 176; i += 4) {
+    uint8_t t[4] = {ctx->rk[i - 4], ctx->rk[i - 3], ctx->rk[i - 2], ctx->rk[i - 1]};
+    if (i % 16 == 0) {
+      uint8_t first = t[0];
+      t[0] = sbox[t[1]] ^ rcon;
+      t[1] = sbox[t[2]];
+      t[2] = sbox[t[3]];
+      t[3] = sbox[first];
+      rcon = xtime(rcon);
+    }
+    for (int j = 0; j < 4; j++) ctx->rk[i + j] = ctx->rk[i - 16 + j] ^ t[j];
+  }
+  return 0;
+}
+
+int mbedtls_aes_crypt_ecb(mbedtls_aes_context *ctx, int mode, const unsigned char input[16],
+                          unsigned char output[16]) {
+  if (mode != MBEDTLS_AES_ENCRYPT) return MBEDTLS_ERR_AES_INVALID_KEY_LENGTH;
+  uint8_t s[16];
+  for (int i = 0; i < 16; i++) s[i] = input[i] ^ ctx->rk[i];
+
+  for (int round = 1; round <= 10; round++) {
+    // SubBytes and ShiftRows (state is column-major: s[col * 4 + row])
+    uint8_t t[16];
+    for (int col = 0; col < 4; col++) {
+      for (int row = 0; row < 4; row++) t[col * 4 + row] = sbox[s[((col + row) % 4) * 4 + row]];
+    }
+    // MixColumns, except in the last round
+    if (round < 10) {
+      for (int col = 0; col < 4; col++) {
+        uint8_t *c = t + col * 4;
+        uint8_t all = c[0] ^ c[1] ^ c[2] ^ c[3];
+        uint8_t first = c[0];
+        c[0] ^= all ^ xtime(c[0] ^ c[1]);
+        c[1] ^= all ^ xtime(c[1] ^ c[2]);
+        c[2] ^= all ^ xtime(c[2] ^ c[3]);
+        c[3] ^= all ^ xtime(c[3] ^ first);
+      }
+    }
+    for (int i = 0; i < 16; i++) s[i] = t[i] ^ ctx->rk[round * 16 + i];
+  }
+  memcpy(output, s, 16);
+  return 0;
+}
+
+// GCM (NIST SP 800-38D)
+
+static uint64_t load64(const uint8_t *p) {
+  uint64_t v = 0;
+  for (int i = 0; i < 8; i++) v = v << 8 | p[i];
+  return v;
+}
+
+static void store64(uint8_t *p, uint64_t v) {
+  for (int i = 7; i >= 0; i--) {
+    p[i] = (uint8_t)v;
+    v >>= 8;
+  }
+}
+
+// y = y * H in GF(2^128), bit-reflected as the spec describes
+static void gmul(const mbedtls_gcm_context *ctx, uint64_t &yHigh, uint64_t &yLow) {
+  uint64_t zHigh = 0, zLow = 0;
+  uint64_t vHigh = ctx->hHigh, vLow = ctx->hLow;
+  for (int i = 0; i < 128; i++) {
+    uint64_t bit = i < 64 ? yHigh >> (63 - i) & 1 : yLow >> (127 - i) & 1;
+    if (bit) {
+      zHigh ^= vHigh;
+      zLow ^= vLow;
+    }
+    bool carry = vLow & 1;
+    vLow = vLow >> 1 | vHigh << 63;
+    vHigh >>= 1;
+    if (carry) vHigh ^= 0xE100000000000000ULL;
+  }
+  yHigh = zHigh;
+  yLow = zLow;
+}
+
+static void ghash(const mbedtls_gcm_context *ctx, uint64_t &yHigh, uint64_t &yLow, const uint8_t *data,
+                  size_t len) {
+  while (len > 0) {
+    uint8_t block[16] = {0};
+    size_t n = len < 16 ? len : 16;
+    memcpy(block, data, n);
+    yHigh ^= load64(block);
+    yLow ^= load64(block + 8);
+    gmul(ctx, yHigh, yLow);
+    data += n;
+    len -= n;
+  }
+}
+
+void mbedtls_gcm_init(mbedtls_gcm_context *ctx) { memset(ctx, 0, sizeof(*ctx)); }
+void mbedtls_gcm_free(mbedtls_gcm_context *ctx) { memset(ctx, 0, sizeof(*ctx)); }
+
+int mbedtls_gcm_setkey(mbedtls_gcm_context *ctx, mbedtls_cipher_id_t cipher, const unsigned char *key,
+                       unsigned int keybits) {
+  if (cipher != MBEDTLS_CIPHER_ID_AES) return MBEDTLS_ERR_GCM_BAD_INPUT;
+  int err = mbedtls_aes_setkey_enc(&ctx->aes, key, keybits);
+  if (err) return err;
+  uint8_t h[16] = {0};
+  mbedtls_aes_crypt_ecb(&ctx->aes, MBEDTLS_AES_ENCRYPT, h, h);
+  ctx->hHigh = load64(h);
+  ctx->hLow = load64(h + 8);
+  return 0;
+}
+
+// Encrypts or decrypts with CTR mode from J0 + 1 and computes the full tag
+static int gcmCrypt(mbedtls_gcm_context *ctx, int mode, size_t length, const unsigned char *iv, size_t iv_len,
+                    const unsigned char *add, size_t add_len, const unsigned char *input, unsigned char *output,
+                    uint8_t tag[16]) {
+  if (iv_len != 12) return MBEDTLS_ERR_GCM_BAD_INPUT;
+  uint8_t counter[16];
+  memcpy(counter, iv, 12);
+  counter[12] = counter[13] = counter[14] = 0;
+  counter[15] = 1;
+  uint8_t ekj0[16];
+  mbedtls_aes_crypt_ecb(&ctx->aes, MBEDTLS_AES_ENCRYPT, counter, ekj0);
+
+  uint64_t yHigh = 0, yLow = 0;
+  ghash(ctx, yHigh, yLow, add, add_len);
+  if (mode == MBEDTLS_GCM_DECRYPT) ghash(ctx, yHigh, yLow, input, length);
+
+  for (size_t offset = 0; offset < length; offset += 16) {
+    for (int i = 15; i >= 12 && ++counter[i] == 0; i--) {}
+    uint8_t keystream[16];
+    mbedtls_aes_crypt_ecb(&ctx->aes, MBEDTLS_AES_ENCRYPT, counter, keystream);
+    size_t n = length - offset < 16 ? length - offset : 16;
+    for (size_t i = 0; i < n; i++) output[offset + i] = input[offset + i] ^ keystream[i];
+  }
+
+  if (mode == MBEDTLS_GCM_ENCRYPT) ghash(ctx, yHigh, yLow, output, length);
+  yHigh ^= (uint64_t)add_len * 8;
+  yLow ^= (uint64_t)length * 8;
+  gmul(ctx, yHigh, yLow);
+  store64(tag, yHigh);
+  store64(tag + 8, yLow);
+  for (int i = 0; i < 16; i++) tag[i] ^= ekj0[i];
+  return 0;
+}
+
+int mbedtls_gcm_crypt_and_tag(mbedtls_gcm_context *ctx, int mode, size_t length, const unsigned char *iv,
+                              size_t iv_len, const unsigned char *add, size_t add_len, const unsigned char *input,
+                              unsigned char *output, size_t tag_len, unsigned char *tag) {
+  if (tag_len < 4 || tag_len > 16) return MBEDTLS_ERR_GCM_BAD_INPUT;
+  uint8_t full[16];
+  int err = gcmCrypt(ctx, mode, length, iv, iv_len, add, add_len, input, output, full);
+  if (err) return err;
+  memcpy(tag, full, tag_len);
+  return 0;
+}
+
+int mbedtls_gcm_auth_decrypt(mbedtls_gcm_context *ctx, size_t length, const unsigned char *iv, size_t iv_len,
+                             const unsigned char *add, size_t add_len, const unsigned char *tag, size_t tag_len,
+                             const unsigned char *input, unsigned char *output) {
+  if (tag_len < 4 || tag_len > 16) return MBEDTLS_ERR_GCM_BAD_INPUT;
+  uint8_t full[16];
+  int err = gcmCrypt(ctx, MBEDTLS_GCM_DECRYPT, length, iv, iv_len, add, add_len, input, output, full);
+  if (err) return err;
+
+  uint8_t diff = 0;
+  for (size_t i = 0; i < tag_len; i++) diff |= full[i] ^ tag[i];
+  if (diff) {
+    memset(output, 0, length);
+    return MBEDTLS_ERR_GCM_AUTH_FAILED;
+  }
+  return 0;
+}
@@ -0,0 +1,55 @@
+// Controls for the host stand-ins, used by the native driver and benchmarks
+#pragma once
+
+#include <Arduino.h>
+
+// Clock
+void simAdvanceMicros(unsigned long us);
+// esp_timer deadlines, for the clock
+bool simNextTimer(unsigned long long &due);
+void simFireTimers(unsigned long long now);
+
+// Inputs
+// Key taps are queued and do not overlap: each is held down for
+// SIM_KEY_TAP_MS, then released for SIM_KEY_GAP_MS before the next.
+static const unsigned long SIM_KEY_TAP_MS = 40;
+static const unsigned long SIM_KEY_GAP_MS = 20;
+void simPressKey(char key);
+void simHoldKey(char key, unsigned long ms);
+bool simKeysIdle();
+void simSetPot(int raw);
+// Replays recorded ADC readings, one every periodUs from now, through
+// analogRead() and the DMA ADC; the last value holds once it runs out.
+// Trace files hold one raw value per line, '#' starts a comment line.
+// simSetPot() ends a replay.
+void simSetAdcTrace(const uint16_t *values, size_t count, unsigned long periodUs);
+bool simLoadAdcTrace(const char *path, unsigned long periodUs);
+unsigned long long simAdcTraceEndMicros();
+
+// Radio
+typedef void (*sim_radio_cb_t)(const uint8_t *mac, const uint8_t *data, int len);
+void simSetRadioHandler(sim_radio_cb_t handler);
+void simDeliver(const uint8_t *mac, const uint8_t *data, int len);
+void simPollRadio();
+
+// Display
+void simSetI2cHz(unsigned long hz);
+
+// Counters
+struct SimStats {
+  unsigned long espNowSends;
+  unsigned long espNowBytes;
+  unsigned long espNowReceives;
+  unsigned long framesFlushed;
+  unsigned long i2cBytes;
+  unsigned long prefsWrites;
+  unsigned long prefsReads;
+  unsigned long flashBytesRead;
+  unsigned long flashBytesWritten;
+  unsigned long flashWrites;
+  unsigned long flashErases;
+};
+
+const SimStats &simStats();
+SimStats &simMutableStats();
+void simResetStats();
@@ -0,0 +1,471 @@
+#include "NetSim.h"
+
+#include <MessageCodec.h>
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Every node is provisioned with the same key
+static const uint8_t networkKey[FrameCipher::KEY_LEN] = {
+  0x3c, 0x8e, 0x51, 0x07, 0xd2, 0x94, 0x6a, 0xf1, 0x2b, 0x70, 0xc9, 0x15, 0xe8, 0x46, 0xbd, 0x33,
+};
+
+static const char *const words[] = {
+  "HELLO", "WHERE", "ARE", "YOU", "MEET", "AT", "THE", "BRIDGE", "CAMP", "NORTH", "SOUTH", "GATE", "RIVER",
+  "WATER", "FOOD", "NEED", "HELP", "COMING", "LATE", "SOON", "OK", "YES", "NO", "CALL", "ME", "WHEN", "BACK",
+  "HOME", "TONIGHT", "TOMORROW", "MORNING", "RADIO", "BATTERY", "LOW", "FULL", "TRAIL", "SIGNAL", "WEATHER",
+};
+static const int WORDS = sizeof(words) / sizeof(words[0]);
+
+// Nodes are serviced for this long after anything happens to them
+static const uint64_t BUSY_US = 50000;
+
+static const uint32_t NO_TX = UINT32_MAX;
+
+struct NetworkSim::Transmission {
+  uint32_t sender;
+  int32_t target;  // node index of a unicast, -1 for broadcast
+  bool targetHeard;
+  uint16_t refs;   // the transmission itself and each reception waiting for onReceive
+  uint8_t len;
+  uint8_t frame[FRAME_MAX_LEN];
+};
+
+struct NetworkSim::Node {
+  struct Queued {
+    uint8_t mac[6];
+    uint8_t len;
+    uint8_t frame[FRAME_MAX_LEN];
+  };
+
+  Node(NetworkSim *sim, uint32_t index, int txQueue)
+    : sim(sim), index(index), id(index + 1), mesh(radioSend, updatePeer, this), fragmenter(deliveryStatus, this),
+      link(transmitFrame, linkStatus, this), queue(txQueue) {
+    uint8_t m[6] = {0x02, 0x00, 0x00, 0x00, (uint8_t)(id >> 8), (uint8_t)id};
+    memcpy(mac, m, 6);
+  }
+
+  NetworkSim *sim;
+  uint32_t index;
+  uint16_t id;
+  uint8_t mac[6];
+  double x = 0;
+  double y = 0;
+  std::vector<uint32_t> neighbours;
+
+  Mesh mesh;
+  Fragmenter fragmenter;
+  ReliableLink link;
+  FrameCipher cipher;
+  uint32_t lastEpoch = 0;  // the cipher's epoch counter, kept here rather than in Preferences
+  int outstanding = 0;  // unicast messages waiting for their delivery report
+  int peers = 1;        // in the ESP-NOW peer list, starting with the broadcast address
+  std::vector<bool> seen;  // message ids received
+
+  // Radio
+  std::vector<Queued> queue;
+  int queueHead = 0;
+  int queued = 0;
+  bool attemptPending = false;
+  bool transmitting = false;
+  int retries = 0;
+  uint64_t airtimeUs = 0;
+
+  // What the radio hears: the first transmission since it last went quiet,
+  // which any overlap spoils
+  int hearing = 0;
+  uint32_t heardTx = NO_TX;
+  uint64_t heardSince = 0;
+  bool corrupted = false;
+
+  // Service
+  uint64_t nextTickUs = 0;
+  uint64_t busyUntilUs = 0;
+};
+
+static uint32_t nextEpoch(void *ctx) {
+  return ++*(uint32_t *)ctx;
+}
+
+uint32_t simPercentile(const std::vector<uint32_t> &sorted, int perMille) {
+  if (sorted.empty()) return 0;
+  size_t rank = (sorted.size() * perMille + 999) / 1000;
+  return sorted[rank ? rank - 1 : 0];
+}
+
+NetworkSim::NetworkSim(const SimConfig &config) : config_(config), rng_(config.seed), results_() {
+  for (int i = 0; i < config_.nodes; i++) {
+    nodes_.emplace_back(new Node(this, i, config_.channel.txQueue));
+    Node &node = *nodes_.back();
+    node.mesh.begin(node.id, 0);
+    node.mesh.setRouting(config_.routing);
+    node.link.begin(node.id, rng_.next());
+    node.cipher.setEpochSource(nextEpoch, &node.lastEpoch);
+    node.cipher.begin(networkKey, node.id);
+    node.link.setSealer(FrameCipher::sealFrame, &node.cipher);
+    node.mesh.setSealer(FrameCipher::sealFrame, &node.cipher);
+  }
+  placeNodes();
+}
+
+NetworkSim::~NetworkSim() {}
+
+unsigned long NetworkSim::airtimeUs(const ChannelConfig &channel, size_t len) {
+  return channel.preambleUs + (unsigned long)ceil((channel.macBytes + len) * 8 / channel.bitRate * 1e6);
+}
+
+void NetworkSim::placeNodes() {
+  for (auto &node : nodes_) {
+    node->x = rng_.unit() * config_.areaM;
+    node->y = rng_.unit() * config_.areaM;
+  }
+  double range2 = config_.rangeM * config_.rangeM;
+  size_t links = 0;
+  for (auto &a : nodes_) {
+    for (auto &b : nodes_) {
+      double dx = a->x - b->x;
+      double dy = a->y - b->y;
+      if (a != b && dx * dx + dy * dy <= range2) a->neighbours.push_back(b->index);
+    }
+    links += a->neighbours.size();
+  }
+  results_.neighbours = nodes_.empty() ? 0 : (double)links / nodes_.size();
+}
+
+void NetworkSim::schedule(uint64_t timeUs, EventType type, uint32_t node, uint32_t tx) {
+  events_.push(Event{timeUs, order_++, type, node, tx});
+}
+
+// FNV-1a over what happened, to compare runs
+void NetworkSim::note(uint64_t value) {
+  for (int i = 0; i < 8; i++) {
+    results_.digest ^= (value >> (8 * i)) & 0xFF;
+    results_.digest *= 0x100000001B3ULL;
+  }
+}
+
+// Services the node soon, if it was waiting for an idle tick
+void NetworkSim::wake(Node &node) {
+  node.busyUntilUs = now_ + BUSY_US;
+  uint64_t soon = now_ + config_.busyTickMs * 1000;
+  if (node.nextTickUs > soon) {
+    node.nextTickUs = soon;
+    schedule(soon, EV_TICK, node.index);
+  }
+}
+
+// As serviceLink() in the sketch
+void NetworkSim::tick(Node &node) {
+  unsigned long ms = nowMs();
+  node.link.tick(ms);
+  node.mesh.tick(ms);
+  node.fragmenter.pump(node.link, ms);
+  node.fragmenter.expire(ms);
+
+  bool busy = node.link.inFlight() > 0 || node.outstanding > 0 || node.queued > 0 || now_ < node.busyUntilUs;
+  node.nextTickUs = now_ + (busy ? config_.busyTickMs : config_.idleTickMs) * 1000;
+  schedule(node.nextTickUs, EV_TICK, node.index);
+}
+
+// As sendText() in the sketch, with a random destination and text
+void NetworkSim::generate(Node &node) {
+  double gapSec = -log(1 - rng_.unit()) * 3600 / config_.messagesPerNodeHour;
+  schedule(now_ + (uint64_t)(gapSec * 1e6), EV_GENERATE, node.index);
+
+  uint32_t msgId = sent_.size();
+  bool broadcast = config_.nodes < 2 || rng_.chance(config_.broadcastShare);
+  uint16_t dest = FRAME_BROADCAST;
+  if (!broadcast) {
+    uint32_t other = rng_.below(config_.nodes - 1);
+    dest = nodes_[other < node.index ? other : other + 1]->id;
+  }
+  sent_.push_back(Sent{now_, dest});
+  results_.offered++;
+
+  char text[MESSAGE_MAX_TEXT + 1];
+  int len = snprintf(text, sizeof(text), "M%u", (unsigned)msgId);
+  int n = 1 + rng_.below(2 * config_.words - 1);
+  for (int w = 0; w < n; w++) {
+    const char *word = words[rng_.below(WORDS)];
+    if (len + 1 + strlen(word) > MESSAGE_MAX_TEXT) break;
+    len += snprintf(text + len, sizeof(text) - len, " %s", word);
+  }
+
+  uint8_t encoded[Fragmenter::MAX_MESSAGE_LEN];
+  size_t encodedLen = messageEncode(text, len, encoded, sizeof(encoded));
+  if (encodedLen == 0 || !node.fragmenter.send(dest, encoded, encodedLen, msgId)) {
+    results_.blocked++;
+    return;
+  }
+  if (broadcast) {
+    results_.broadcasts++;
+  } else {
+    results_.unicasts++;
+    node.outstanding++;
+  }
+  node.fragmenter.pump(node.link, nowMs());
+  wake(node);
+}
+
+bool NetworkSim::transmitFrame(void *ctx, const uint8_t *frame, size_t len) {
+  return ((Node *)ctx)->mesh.transmit(frame, len);
+}
+
+void NetworkSim::linkStatus(void *ctx, uint32_t tag, bool delivered) {
+  Fragmenter::linkStatus(&((Node *)ctx)->fragmenter, tag, delivered);
+}
+
+void NetworkSim::deliveryStatus(void *ctx, uint32_t tag, bool delivered) {
+  Node &node = *(Node *)ctx;
+  NetworkSim &sim = *node.sim;
+  const Sent &sent = sim.sent_[tag];
+  if (sent.dest == FRAME_BROADCAST) return;
+  node.outstanding--;
+  if (delivered) {
+    sim.results_.delivered++;
+    sim.results_.deliveryMs.push_back((uint32_t)((sim.now_ - sent.us) / 1000));
+  } else {
+    sim.results_.failed++;
+  }
+  sim.note(sim.now_ ^ (uint64_t)tag << 32 ^ delivered);
+}
+
+// esp_now_add_peer() and esp_now_del_peer() for Mesh's next hops
+bool NetworkSim::updatePeer(void *ctx, const uint8_t *mac, bool add) {
+  Node &node = *(Node *)ctx;
+  if (!add) {
+    node.peers--;
+    return true;
+  }
+  if (node.peers >= node.sim->config_.channel.maxPeers) return false;
+  node.peers++;
+  return true;
+}
+
+// esp_now_send(): queues the frame for the radio
+bool NetworkSim::radioSend(void *ctx, const uint8_t *mac, const uint8_t *frame, size_t len, bool forwarded) {
+  Node &node = *(Node *)ctx;
+  NetworkSim &sim = *node.sim;
+  if (node.queued == (int)node.queue.size()) {
+    sim.results_.queueFull++;
+    return false;
+  }
+  Node::Queued &q = node.queue[(node.queueHead + node.queued) % node.queue.size()];
+  memcpy(q.mac, mac, 6);
+  memcpy(q.frame, frame, len);
+  q.len = len;
+  node.queued++;
+  if (forwarded) node.link.noteOtherTransmit();
+  if (!node.transmitting && !node.attemptPending) sim.backoff(node, 0);
+  sim.wake(node);
+  return true;
+}
+
+void NetworkSim::backoff(Node &node, unsigned long extraUs) {
+  const ChannelConfig &c = config_.channel;
+  node.attemptPending = true;
+  schedule(now_ + extraUs + c.difsUs + rng_.below(c.contentionWindow + 1) * c.slotUs, EV_ATTEMPT, node.index);
+}
+
+// Starts the frame at the head of the queue, unless the channel is busy
+void NetworkSim::attempt(Node &node) {
+  node.attemptPending = false;
+  if (node.transmitting || node.queued == 0) return;
+  if (node.hearing > 0 && now_ >= node.heardSince + config_.channel.senseUs) {
+    backoff(node, 0);
+    return;
+  }
+
+  uint32_t tx;
+  if (!freeTxs_.empty()) {
+    tx = freeTxs_.back();
+    freeTxs_.pop_back();
+  } else {
+    tx = txs_.size();
+    txs_.push_back(Transmission());
+  }
+  const Node::Queued &q = node.queue[node.queueHead];
+  Transmission &t = txs_[tx];
+  t.sender = node.index;
+  t.target = memcmp(q.mac, Mesh::BROADCAST_MAC, 6) == 0 ? -1 : (int32_t)((q.mac[4] << 8 | q.mac[5]) - 1);
+  t.targetHeard = false;
+  t.refs = 1;
+  t.len = q.len;
+  memcpy(t.frame, q.frame, q.len);
+
+  unsigned long airtime = airtimeUs(config_.channel, q.len);
+  node.transmitting = true;
+  node.airtimeUs += airtime;
+  if (node.hearing > 0) node.corrupted = true;
+  results_.transmissions++;
+
+  for (uint32_t n : node.neighbours) {
+    Node &r = *nodes_[n];
+    if (r.hearing++ == 0) {
+      r.heardTx = tx;
+      r.heardSince = now_;
+      r.corrupted = r.transmitting;
+    } else {
+      r.corrupted = true;
+    }
+  }
+  schedule(now_ + airtime, EV_TX_END, node.index, tx);
+}
+
+void NetworkSim::endTransmission(uint32_t tx) {
+  Node &node = *nodes_[txs_[tx].sender];
+  node.transmitting = false;
+
+  for (uint32_t n : node.neighbours) {
+    Node &r = *nodes_[n];
+    r.hearing--;
+    if (r.heardTx != tx || r.corrupted) {
+      results_.collisions++;
+      continue;
+    }
+    if (rng_.chance(config_.channel.loss)) {
+      results_.lost++;
+      continue;
+    }
+    if ((int32_t)n == txs_[tx].target) txs_[tx].targetHeard = true;
+    txs_[tx].refs++;
+    schedule(now_ + config_.channel.rxLatencyUs, EV_RX, n, tx);
+  }
+
+  // The MAC retries unicasts that were not acknowledged
+  const Transmission &t = txs_[tx];
+  bool unicast = t.target >= 0;
+  bool ok = !unicast || t.targetHeard;
+  if (!ok && node.retries < config_.channel.macRetries) {
+    node.retries++;
+    results_.macRetries++;
+    backoff(node, config_.channel.ackUs);
+  } else {
+    node.retries = 0;
+    node.queueHead = (node.queueHead + 1) % node.queue.size();
+    node.queued--;
+    node.link.onLinkStatus(ok, nowMs());
+    if (node.queued > 0) backoff(node, unicast ? config_.channel.ackUs : 0);
+    wake(node);
+  }
+  releaseTx(tx);
+}
+
+void NetworkSim::receive(Node &node, uint32_t tx) {
+  const Transmission &t = txs_[tx];
+  results_.receptions++;
+  process(node, nodes_[t.sender]->mac, t.frame, t.len);
+  releaseTx(tx);
+}
+
+void NetworkSim::releaseTx(uint32_t tx) {
+  if (--txs_[tx].refs == 0) freeTxs_.push_back(tx);
+}
+
+// As processReceived() in the sketch
+void NetworkSim::process(Node &node, const uint8_t *mac, const uint8_t *data, size_t len) {
+  unsigned long ms = nowMs();
+  wake(node);
+  FrameView frame;
+  if (!frameDecode(data, len, frame)) return;
+  if (!node.mesh.receive(mac, data, len, frame, ms)) return;
+
+  uint8_t plain[FRAME_MAX_PAYLOAD];
+  uint32_t epoch = 0;
+  int plainLen = node.cipher.open(frame, plain, &epoch);
+  if (plainLen < 0) return;  // counted by the cipher
+  frame.payload = plain;
+  frame.payloadLen = plainLen;
+  node.mesh.heard(mac, frame.header, ms);
+  if (frame.header.type == FRAME_BEACON || !node.link.receive(frame, ms, epoch) || frame.header.type != FRAME_TEXT) {
+    return;
+  }
+
+  uint8_t encoded[Fragmenter::MAX_MESSAGE_LEN];
+  size_t encodedLen = node.fragmenter.receive(frame, encoded, sizeof(encoded), ms);
+  if (encodedLen == 0) return;
+  char text[MESSAGE_MAX_TEXT + 1];
+  size_t textLen = messageDecode(encoded, encodedLen, text, MESSAGE_MAX_TEXT);
+  text[textLen] = '\0';
+  uint32_t msgId = text[0] == 'M' ? strtoul(text + 1, nullptr, 10) : UINT32_MAX;
+  if (textLen == 0 || msgId >= sent_.size()) {
+    results_.rejected++;
+    return;
+  }
+
+  if (node.seen.size() <= msgId) node.seen.resize(msgId + 1);
+  if (node.seen[msgId]) {
+    results_.duplicates++;
+    return;
+  }
+  node.seen[msgId] = true;
+  results_.received++;
+  results_.latencyMs.push_back((uint32_t)((now_ - sent_[msgId].us) / 1000));
+  note(now_ ^ (uint64_t)msgId << 32 ^ node.index);
+}
+
+SimResults NetworkSim::run() {
+  uint64_t endUs = (uint64_t)(config_.hours * 3600e6);
+  for (auto &node : nodes_) {
+    node->nextTickUs = rng_.below(config_.idleTickMs * 1000);
+    schedule(node->nextTickUs, EV_TICK, node->index);
+    if (config_.messagesPerNodeHour > 0) {
+      double gapSec = -log(1 - rng_.unit()) * 3600 / config_.messagesPerNodeHour;
+      schedule((uint64_t)(gapSec * 1e6), EV_GENERATE, node->index);
+    }
+  }
+
+  while (!events_.empty() && events_.top().timeUs <= endUs) {
+    Event e = events_.top();
+    events_.pop();
+    now_ = e.timeUs;
+    results_.events++;
+    Node &node = *nodes_[e.node];
+    switch (e.type) {
+      case EV_TICK:
+        if (e.timeUs == node.nextTickUs) tick(node);  // otherwise replaced by an earlier tick
+        break;
+      case EV_GENERATE:
+        generate(node);
+        break;
+      case EV_ATTEMPT:
+        attempt(node);
+        break;
+      case EV_TX_END:
+        endTransmission(e.tx);
+        break;
+      case EV_RX:
+        receive(node, e.tx);
+        break;
+    }
+  }
+
+  results_.simSeconds = endUs / 1e6;
+  uint64_t airtime = 0;
+  for (auto &node : nodes_) {
+    airtime += node->airtimeUs;
+    const Mesh::Stats &m = node->mesh.stats();
+    results_.mesh.unicasts += m.unicasts;
+    results_.mesh.floods += m.floods;
+    results_.mesh.relayed += m.relayed;
+    results_.mesh.duplicates += m.duplicates;
+    results_.mesh.ttlExpired += m.ttlExpired;
+    results_.mesh.relayOverflows += m.relayOverflows;
+    results_.mesh.beacons += m.beacons;
+    results_.mesh.peersRefused += m.peersRefused;
+    const ReliableLink::Stats &l = node->link.stats();
+    results_.link.sent += l.sent;
+    results_.link.retransmits += l.retransmits;
+    results_.link.delivered += l.delivered;
+    results_.link.failed += l.failed;
+    results_.link.duplicates += l.duplicates;
+    results_.link.acksSent += l.acksSent;
+    results_.rejected += node->cipher.stats().rejected + node->cipher.stats().replays;
+  }
+  results_.airtimeShare = nodes_.empty() || endUs == 0 ? 0 : (double)airtime / endUs / nodes_.size();
+  std::sort(results_.latencyMs.begin(), results_.latencyMs.end());
+  std::sort(results_.deliveryMs.begin(), results_.deliveryMs.end());
+  return results_;
+}
@@ -0,0 +1,194 @@
+// Discrete-event simulation of many nodes sharing one ESP-NOW channel.
+//
+// Each node runs the radio path of v7.cpp, built from the same libraries:
+// MessageCodec, Fragmenter, ReliableLink, FrameCipher and Mesh, serviced
+// the way serviceLink() and processReceived() do it. The sketch itself
+// keeps its state in globals, so it cannot be instantiated hundreds of times;
+// keypad, display and history are left out.
+//
+// Nodes sit at random points in a square and hear each other within range.
+// The channel model:
+//   - airtime: PHY preamble plus the 802.11 action frame around the
+//     payload, at a fixed bit rate
+//   - carrier sense: a node defers while it hears a transmission that has
+//     been on air for longer than the sensing time, then backs off a random
+//     number of slots
+//   - collisions: two transmissions overlapping at a receiver both fail
+//     there, and a node cannot hear while it transmits (hidden nodes
+//     collide freely)
+//   - loss: each reception that survives is also lost with a fixed chance
+//   - a bounded transmit queue per radio, beyond which esp_now_send fails
+//   - a bounded peer list, as ESP-NOW's, which unicast next hops must be in
+//   - unicast is acknowledged by the MAC, which retries a few times before
+//     reporting failure; broadcast always reports success
+//   - latency from the end of a frame to onReceive
+//
+// Time is virtual and in microseconds. Events at the same time run in the
+// order they were scheduled, and all randomness comes from one generator,
+// so a run is fully determined by its configuration and seed. Nodes are
+// serviced every few milliseconds while they have work, and rarely while
+// idle, which is what makes hours of traffic quick to simulate.
+#pragma once
+
+#include <Fragmenter.h>
+#include <FrameCipher.h>
+#include <Mesh.h>
+#include <ReliableLink.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <queue>
+#include <vector>
+
+// xorshift64*
+class SimRng {
+public:
+  explicit SimRng(uint64_t seed) : state_(seed ? seed : 1) {}
+  uint32_t next() {
+    state_ ^= state_ >> 12;
+    state_ ^= state_ << 25;
+    state_ ^= state_ >> 27;
+    return (uint32_t)((state_ * 0x2545F4914F6CDD1DULL) >> 32);
+  }
+  uint32_t below(uint32_t n) { return next() % n; }
+  // Uniform in [0, 1)
+  double unit() { return next() / 4294967296.0; }
+  bool chance(double p) { return unit() < p; }
+
+private:
+  uint64_t state_;
+};
+
+struct ChannelConfig {
+  double bitRate = 1e6;              // ESP-NOW's default 1 Mbps
+  unsigned long preambleUs = 192;    // long DSSS preamble and PLCP header
+  unsigned long macBytes = 43;       // action frame header, vendor element and FCS
+  unsigned long ackUs = 314;         // SIFS and the MAC ACK
+  unsigned long difsUs = 50;
+  unsigned long slotUs = 20;
+  unsigned long senseUs = 15;        // before a new transmission is sensed
+  int contentionWindow = 31;         // backoff slots, drawn from 0..contentionWindow
+  int macRetries = 2;                // unicast attempts after the first
+  int txQueue = 8;                   // frames a radio holds before esp_now_send fails
+  int maxPeers = 20;                 // ESP-NOW's peer list, the broadcast address included
+  unsigned long rxLatencyUs = 200;   // end of frame to onReceive
+  double loss = 0.01;                // chance a clean reception is still lost
+};
+
+struct SimConfig {
+  int nodes = 50;
+  uint64_t seed = 1;
+  double hours = 1;
+  double areaM = 600;    // side of the square
+  double rangeM = 200;
+  double messagesPerNodeHour = 6;
+  double broadcastShare = 0.1;
+  int words = 4;         // average words per message
+  bool routing = true;   // false floods everything, as Mesh::setRouting()
+  unsigned long busyTickMs = 5;    // serviceLink() interval on the device
+  unsigned long idleTickMs = 100;
+  ChannelConfig channel;
+};
+
+struct SimResults {
+  double simSeconds;
+  uint64_t events;
+
+  // Messages
+  uint64_t offered;     // generated by the traffic model
+  uint64_t blocked;     // both outgoing slots busy, as "Send Failed" on the device
+  uint64_t unicasts;    // accepted for one node
+  uint64_t delivered;   // reported delivered to the sender
+  uint64_t failed;      // reported failed to the sender
+  uint64_t broadcasts;
+  uint64_t received;    // complete messages at their destinations (broadcasts: at every node)
+  uint64_t duplicates;  // a message received again by the same node
+  std::vector<uint32_t> latencyMs;    // send to arrival, sorted
+  std::vector<uint32_t> deliveryMs;   // send to the sender's delivery report, sorted
+
+  // Frames
+  uint64_t transmissions;  // MAC attempts, retries included
+  uint64_t macRetries;
+  uint64_t queueFull;      // esp_now_send refused
+  uint64_t receptions;     // clean frames handed to onReceive
+  uint64_t collisions;     // receptions lost to overlap or to transmitting
+  uint64_t lost;           // receptions lost at random
+  double airtimeShare;     // transmitting time over simulated time, averaged over nodes
+
+  // Summed over nodes
+  Mesh::Stats mesh;
+  ReliableLink::Stats link;
+  uint64_t rejected;  // frames that did not decrypt
+
+  double neighbours;  // average per node
+  uint64_t digest;    // changes with any difference in what happened
+};
+
+// Exact percentile (per mille) of sorted samples
+uint32_t simPercentile(const std::vector<uint32_t> &sorted, int perMille);
+
+class NetworkSim {
+public:
+  explicit NetworkSim(const SimConfig &config);
+  ~NetworkSim();
+
+  SimResults run();
+
+  // Per-frame airtime in microseconds, ACK excluded
+  static unsigned long airtimeUs(const ChannelConfig &channel, size_t len);
+
+private:
+  struct Node;
+  struct Transmission;
+
+  enum EventType : uint8_t { EV_TICK, EV_GENERATE, EV_ATTEMPT, EV_TX_END, EV_RX };
+
+  struct Event {
+    uint64_t timeUs;
+    uint64_t order;
+    EventType type;
+    uint32_t node;
+    uint32_t tx;  // Transmission index for EV_TX_END and EV_RX
+    bool operator>(const Event &other) const {
+      return timeUs != other.timeUs ? timeUs > other.timeUs : order > other.order;
+    }
+  };
+
+  struct Sent {
+    uint64_t us;
+    uint16_t dest;
+  };
+
+  // Callbacks for the libraries, with the Node as ctx
+  static bool radioSend(void *ctx, const uint8_t *mac, const uint8_t *frame, size_t len, bool forwarded);
+  static bool transmitFrame(void *ctx, const uint8_t *frame, size_t len);
+  static void linkStatus(void *ctx, uint32_t tag, bool delivered);
+  static void deliveryStatus(void *ctx, uint32_t tag, bool delivered);
+  static bool updatePeer(void *ctx, const uint8_t *mac, bool add);
+
+  void schedule(uint64_t timeUs, EventType type, uint32_t node, uint32_t tx = 0);
+  void placeNodes();
+  void wake(Node &node);
+  void tick(Node &node);
+  void generate(Node &node);
+  void backoff(Node &node, unsigned long extraUs);
+  void attempt(Node &node);
+  void endTransmission(uint32_t tx);
+  void receive(Node &node, uint32_t tx);
+  void releaseTx(uint32_t tx);
+  void process(Node &node, const uint8_t *mac, const uint8_t *data, size_t len);
+  void note(uint64_t value);
+  unsigned long nowMs() const { return (unsigned long)(now_ / 1000); }
+
+  SimConfig config_;
+  SimRng rng_;
+  uint64_t now_ = 0;
+  uint64_t order_ = 0;
+  std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events_;
+  std::vector<std::unique_ptr<Node>> nodes_;
+  std::vector<Transmission> txs_;
+  std::vector<uint32_t> freeTxs_;
+  // Every message generated, by id; the id leads the message text
+  std::vector<Sent> sent_;
+  SimResults results_;
+};
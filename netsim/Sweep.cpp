@@ -0,0 +1,251 @@
+#include "Sweep.h"
+
+#include <MessageCodec.h>
+#include <algorithm>
+#include <chrono>
+#include <stdlib.h>
+#include <string.h>
+
+struct Parameter {
+  const char *name;
+  void (*set)(SimConfig &config, double value);
+};
+
+static const Parameter parameters[] = {
+  {"nodes", [](SimConfig &c, double v) { c.nodes = (int)v; }},
+  {"hours", [](SimConfig &c, double v) { c.hours = v; }},
+  {"seed", [](SimConfig &c, double v) { c.seed = (uint64_t)v; }},
+  {"area", [](SimConfig &c, double v) { c.areaM = v; }},
+  {"range", [](SimConfig &c, double v) { c.rangeM = v; }},
+  {"rate", [](SimConfig &c, double v) { c.messagesPerNodeHour = v; }},
+  {"broadcast", [](SimConfig &c, double v) { c.broadcastShare = v; }},
+  {"words", [](SimConfig &c, double v) { c.words = (int)v; }},
+  {"flood", [](SimConfig &c, double v) { c.routing = v == 0; }},
+  {"loss", [](SimConfig &c, double v) { c.channel.loss = v; }},
+  {"retries", [](SimConfig &c, double v) { c.channel.macRetries = (int)v; }},
+  {"cw", [](SimConfig &c, double v) { c.channel.contentionWindow = (int)v; }},
+  {"queue", [](SimConfig &c, double v) { c.channel.txQueue = (int)v; }},
+  {"peers", [](SimConfig &c, double v) { c.channel.maxPeers = (int)v; }},
+  {"bitrate", [](SimConfig &c, double v) { c.channel.bitRate = v; }},
+  {"busy_tick", [](SimConfig &c, double v) { c.busyTickMs = (unsigned long)v; }},
+  {"idle_tick", [](SimConfig &c, double v) { c.idleTickMs = (unsigned long)v; }},
+};
+
+bool simSetParameter(SimConfig &config, const char *name, double value) {
+  for (const Parameter &p : parameters) {
+    if (strcmp(p.name, name) == 0) {
+      p.set(config, value);
+      return true;
+    }
+  }
+  return false;
+}
+
+const char *simParameterNames() {
+  static std::string names;
+  if (names.empty()) {
+    for (const Parameter &p : parameters) names += (names.empty() ? "" : " ") + std::string(p.name);
+  }
+  return names.c_str();
+}
+
+bool simConfigValid(const SimConfig &c) {
+  return c.nodes >= 1 && c.nodes <= 0xFFFE && c.hours >= 0 && c.words >= 1 && c.areaM > 0 && c.rangeM >= 0 &&
+         c.messagesPerNodeHour >= 0 && c.channel.bitRate > 0 && c.channel.contentionWindow >= 0 &&
+         c.channel.macRetries >= 0 && c.channel.txQueue >= 1 && c.channel.maxPeers >= 1 && c.busyTickMs >= 1 &&
+         c.idleTickMs >= 1;
+}
+
+bool sweepParseAxis(const char *spec, SweepAxis &axis) {
+  const char *eq = strchr(spec, '=');
+  if (!eq) return false;
+  axis.name.assign(spec, eq - spec);
+  axis.values.clear();
+  SimConfig probe;
+  if (!simSetParameter(probe, axis.name.c_str(), 0)) return false;
+
+  char *end;
+  double first = strtod(eq + 1, &end);
+  if (end == eq + 1) return false;
+  if (*end == ':') {
+    double last = strtod(end + 1, &end);
+    if (*end != ':') return false;
+    double step = strtod(end + 1, &end);
+    if (*end || step <= 0 || last < first) return false;
+    // Stepping by count keeps fractional steps from drifting past last
+    for (long i = 0; first + i * step <= last * (1 + 1e-12); i++) axis.values.push_back(first + i * step);
+    return true;
+  }
+  axis.values.push_back(first);
+  while (*end == ',') {
+    const char *start = end + 1;
+    axis.values.push_back(strtod(start, &end));
+    if (end == start) return false;
+  }
+  return *end == '\0';
+}
+
+Sweep::Sweep(const SimConfig &base, const std::vector<SweepAxis> &axes, int seeds)
+  : axes_(axes), seeds_(seeds < 1 ? 1 : seeds) {
+  // Every combination, the last axis varying fastest
+  size_t count = 1;
+  for (const SweepAxis &axis : axes_) count *= axis.values.size();
+  for (size_t i = 0; i < count; i++) {
+    Point point;
+    point.config = base;
+    point.values.resize(axes_.size());
+    size_t rest = i;
+    for (size_t a = axes_.size(); a-- > 0;) {
+      point.values[a] = axes_[a].values[rest % axes_[a].values.size()];
+      rest /= axes_[a].values.size();
+      simSetParameter(point.config, axes_[a].name.c_str(), point.values[a]);
+    }
+    point.total = SimResults();
+    point.hostSeconds = 0;
+    points_.push_back(point);
+  }
+}
+
+bool Sweep::valid() const {
+  for (const Point &point : points_) {
+    if (!simConfigValid(point.config)) return false;
+  }
+  return true;
+}
+
+// Rough run time: traffic grows with the nodes and the frames each one hears
+static double cost(const SimConfig &c) {
+  double neighbours = c.nodes * 3.14 * c.rangeM * c.rangeM / (c.areaM * c.areaM);
+  return c.nodes * c.hours * (1 + neighbours);
+}
+
+static void add(SimResults &total, const SimResults &r) {
+  total.simSeconds += r.simSeconds;
+  total.events += r.events;
+  total.offered += r.offered;
+  total.blocked += r.blocked;
+  total.unicasts += r.unicasts;
+  total.delivered += r.delivered;
+  total.failed += r.failed;
+  total.broadcasts += r.broadcasts;
+  total.received += r.received;
+  total.duplicates += r.duplicates;
+  total.latencyMs.insert(total.latencyMs.end(), r.latencyMs.begin(), r.latencyMs.end());
+  total.deliveryMs.insert(total.deliveryMs.end(), r.deliveryMs.begin(), r.deliveryMs.end());
+  total.transmissions += r.transmissions;
+  total.macRetries += r.macRetries;
+  total.queueFull += r.queueFull;
+  total.receptions += r.receptions;
+  total.collisions += r.collisions;
+  total.lost += r.lost;
+  total.airtimeShare += r.airtimeShare;
+  total.mesh.unicasts += r.mesh.unicasts;
+  total.mesh.floods += r.mesh.floods;
+  total.mesh.relayed += r.mesh.relayed;
+  total.mesh.duplicates += r.mesh.duplicates;
+  total.mesh.ttlExpired += r.mesh.ttlExpired;
+  total.mesh.relayOverflows += r.mesh.relayOverflows;
+  total.mesh.beacons += r.mesh.beacons;
+  total.mesh.peersRefused += r.mesh.peersRefused;
+  total.link.sent += r.link.sent;
+  total.link.retransmits += r.link.retransmits;
+  total.link.delivered += r.link.delivered;
+  total.link.failed += r.link.failed;
+  total.link.duplicates += r.link.duplicates;
+  total.link.acksSent += r.link.acksSent;
+  total.rejected += r.rejected;
+  total.neighbours += r.neighbours;
+  total.digest = (total.digest ^ r.digest) * 0x100000001B3ULL;
+}
+
+void Sweep::run(WorkPool &pool) {
+  // MessageCodec builds its tables on first use; do that before the threads
+  uint8_t scratch[8];
+  messageEncode("A", 1, scratch, sizeof(scratch));
+
+  std::vector<SimResults> results(runs());
+  std::vector<double> hostSeconds(runs());
+  std::vector<size_t> order(runs());
+  for (size_t i = 0; i < order.size(); i++) order[i] = i;
+  // Longest first, so a long run does not start last and hold up the end
+  std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+    return cost(points_[a / seeds_].config) > cost(points_[b / seeds_].config);
+  });
+
+  for (size_t i : order) {
+    pool.submit([this, i, &results, &hostSeconds] {
+      SimConfig config = points_[i / seeds_].config;
+      config.seed += i % seeds_;
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      results[i] = NetworkSim(config).run();
+      hostSeconds[i] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    });
+  }
+  pool.wait();
+
+  digest_ = 0;
+  for (size_t i = 0; i < results.size(); i++) {
+    Point &point = points_[i / seeds_];
+    add(point.total, results[i]);
+    point.hostSeconds += hostSeconds[i];
+    digest_ = (digest_ ^ results[i].digest) * 0x100000001B3ULL;
+    results[i] = SimResults();  // the latencies are in the total now
+  }
+  for (Point &point : points_) {
+    std::sort(point.total.latencyMs.begin(), point.total.latencyMs.end());
+    std::sort(point.total.deliveryMs.begin(), point.total.deliveryMs.end());
+    point.total.airtimeShare /= seeds_;
+    point.total.neighbours /= seeds_;
+  }
+}
+
+static double share(uint64_t part, uint64_t whole) {
+  return whole ? part * 100.0 / whole : 0.0;
+}
+
+static uint64_t expected(const Sweep::Point &point) {
+  return point.total.unicasts + point.total.broadcasts * (point.config.nodes - 1);
+}
+
+void Sweep::print(FILE *out) const {
+  for (const SweepAxis &axis : axes_) fprintf(out, "%10s ", axis.name.c_str());
+  fprintf(out, "%8s %8s %8s %6s %8s %8s %8s %8s %8s %8s %8s\n", "deliver%", "receive%", "dups", "neigh", "lat p50",
+          "lat p99", "rep p99", "air%", "collide%", "refused", "host s");
+  for (const Point &point : points_) {
+    const SimResults &r = point.total;
+    for (double v : point.values) fprintf(out, "%10g ", v);
+    fprintf(out, "%8.1f %8.1f %8llu %6.1f %8lu %8lu %8lu %8.3f %8.1f %8llu %8.2f\n", share(r.delivered, r.unicasts),
+            share(r.received, expected(point)), (unsigned long long)r.duplicates, r.neighbours,
+            (unsigned long)simPercentile(r.latencyMs, 500), (unsigned long)simPercentile(r.latencyMs, 990),
+            (unsigned long)simPercentile(r.deliveryMs, 990), r.airtimeShare * 100,
+            share(r.collisions, r.receptions + r.collisions + r.lost), (unsigned long long)r.queueFull,
+            point.hostSeconds);
+  }
+}
+
+bool Sweep::writeCsv(const char *path) const {
+  FILE *f = fopen(path, "w");
+  if (!f) return false;
+  for (const SweepAxis &axis : axes_) fprintf(f, "%s,", axis.name.c_str());
+  fprintf(f, "runs,offered,blocked,unicasts,delivered,failed,broadcasts,received,expected,duplicates,"
+             "latency_p50_ms,latency_p99_ms,latency_max_ms,report_p50_ms,report_p99_ms,transmissions,mac_retries,"
+             "queue_full,receptions,collisions,lost,rejected,airtime_share,neighbours,mesh_relayed,"
+             "link_retransmits,host_seconds\n");
+  for (const Point &point : points_) {
+    const SimResults &r = point.total;
+    for (double v : point.values) fprintf(f, "%g,", v);
+    fprintf(f, "%d,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu,", seeds_, (unsigned long long)r.offered,
+            (unsigned long long)r.blocked, (unsigned long long)r.unicasts, (unsigned long long)r.delivered,
+            (unsigned long long)r.failed, (unsigned long long)r.broadcasts, (unsigned long long)r.received,
+            (unsigned long long)expected(point), (unsigned long long)r.duplicates);
+    fprintf(f, "%lu,%lu,%lu,%lu,%lu,", (unsigned long)simPercentile(r.latencyMs, 500),
+            (unsigned long)simPercentile(r.latencyMs, 990), (unsigned long)simPercentile(r.latencyMs, 1000),
+            (unsigned long)simPercentile(r.deliveryMs, 500), (unsigned long)simPercentile(r.deliveryMs, 990));
+    fprintf(f, "%llu,%llu,%llu,%llu,%llu,%llu,%llu,%.6f,%.2f,%lu,%lu,%.3f\n", (unsigned long long)r.transmissions,
+            (unsigned long long)r.macRetries, (unsigned long long)r.queueFull, (unsigned long long)r.receptions,
+            (unsigned long long)r.collisions, (unsigned long long)r.lost, (unsigned long long)r.rejected,
+            r.airtimeShare, r.neighbours, (unsigned long)r.mesh.relayed, (unsigned long)r.link.retransmits,
+            point.hostSeconds);
+  }
+  return fclose(f) == 0;
+}
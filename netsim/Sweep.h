@@ -0,0 +1,66 @@
+// Parameter sweeps over the network simulation.
+//
+// A sweep runs every combination of the values given for each swept
+// parameter (the points), each with several seeds, as independent
+// simulations on a WorkPool. Results are collected by run index and summed
+// per point in that order, so the report and its digest do not depend on
+// the number of threads or on which thread ran what.
+//
+// Parameters are set by name, as on the command line:
+//   nodes hours seed area range rate broadcast words flood
+//   loss retries cw queue peers bitrate busy_tick idle_tick
+// Values are a comma-separated list, or first:last:step.
+#pragma once
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "NetSim.h"
+#include "WorkPool.h"
+
+// Returns false for an unknown name
+bool simSetParameter(SimConfig &config, const char *name, double value);
+// Space-separated, for usage messages
+const char *simParameterNames();
+bool simConfigValid(const SimConfig &config);
+
+struct SweepAxis {
+  std::string name;
+  std::vector<double> values;
+};
+
+// "name=v1,v2,..." or "name=first:last:step"; false if malformed or unknown
+bool sweepParseAxis(const char *spec, SweepAxis &axis);
+
+class Sweep {
+public:
+  struct Point {
+    SimConfig config;            // with the first seed
+    std::vector<double> values;  // one per axis
+    SimResults total;            // summed over seeds; latencies merged and sorted
+    double hostSeconds;          // summed over seeds
+  };
+
+  // seeds: runs per point, with seeds base.seed, base.seed + 1, ...
+  Sweep(const SimConfig &base, const std::vector<SweepAxis> &axes, int seeds);
+
+  // False if a point is not a valid configuration
+  bool valid() const;
+  size_t runs() const { return points_.size() * seeds_; }
+
+  void run(WorkPool &pool);
+
+  const std::vector<Point> &points() const { return points_; }
+  // Over every run, in run order
+  uint64_t digest() const { return digest_; }
+
+  void print(FILE *out) const;
+  bool writeCsv(const char *path) const;
+
+private:
+  std::vector<SweepAxis> axes_;
+  int seeds_;
+  std::vector<Point> points_;
+  uint64_t digest_ = 0;
+};
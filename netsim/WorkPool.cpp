@@ -0,0 +1,74 @@
+#include "WorkPool.h"
+
+WorkPool::WorkPool(int threads) {
+  if (threads <= 0) threads = std::thread::hardware_concurrency();
+  if (threads <= 0) threads = 1;
+  for (int i = 0; i < threads; i++) queues_.emplace_back(new Queue());
+  for (int i = 0; i < threads; i++) threads_.emplace_back(&WorkPool::work, this, i);
+}
+
+WorkPool::~WorkPool() {
+  wait();
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread &t : threads_) t.join();
+}
+
+void WorkPool::submit(Task task) {
+  size_t q;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    q = next_;
+    next_ = (next_ + 1) % queues_.size();
+    unfinished_++;
+    queued_++;
+  }
+  {
+    std::lock_guard<std::mutex> guard(queues_[q]->lock);
+    queues_[q]->tasks.push_back(std::move(task));
+  }
+  wake_.notify_one();
+}
+
+void WorkPool::wait() {
+  std::unique_lock<std::mutex> guard(lock_);
+  idle_.wait(guard, [this] { return unfinished_ == 0; });
+}
+
+// Oldest first, from the own queue and then the others
+bool WorkPool::take(size_t self, Task &task) {
+  for (size_t i = 0; i < queues_.size(); i++) {
+    size_t q = (self + i) % queues_.size();
+    std::unique_lock<std::mutex> guard(queues_[q]->lock);
+    std::deque<Task> &tasks = queues_[q]->tasks;
+    if (tasks.empty()) continue;
+    task = std::move(tasks.front());
+    tasks.pop_front();
+    guard.unlock();
+    std::lock_guard<std::mutex> counts(lock_);
+    queued_--;
+    if (i != 0) steals_++;
+    return true;
+  }
+  return false;
+}
+
+void WorkPool::work(size_t self) {
+  for (;;) {
+    Task task;
+    if (take(self, task)) {
+      task();
+      std::lock_guard<std::mutex> guard(lock_);
+      if (--unfinished_ == 0) idle_.notify_all();
+      continue;
+    }
+    // A task is counted just before it is pushed, so this may find the
+    // queues empty once more and loop
+    std::unique_lock<std::mutex> guard(lock_);
+    wake_.wait(guard, [this] { return queued_ > 0 || stopping_; });
+    if (stopping_ && queued_ == 0) return;
+  }
+}
@@ -0,0 +1,56 @@
+// Runs tasks on a fixed set of threads, with work stealing.
+//
+// Each thread has its own queue. submit() deals tasks out round robin, and
+// a thread runs the tasks in its own queue in the order submitted and, once
+// that is empty, steals the oldest task from another queue. Simulations
+// differ in length by orders of magnitude (nodes, hours, traffic), so a
+// caller that submits the longest first has them started first everywhere,
+// and a thread that drew short ones takes over the rest of a long queue
+// instead of idling.
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkPool {
+public:
+  typedef std::function<void()> Task;
+
+  // threads 0: one per core
+  explicit WorkPool(int threads = 0);
+  // Waits for the tasks submitted, then stops the threads
+  ~WorkPool();
+
+  void submit(Task task);
+  // Returns once every task submitted so far has run
+  void wait();
+
+  int threads() const { return (int)threads_.size(); }
+  // Tasks taken from another thread's queue
+  unsigned long steals() const { return steals_; }
+
+private:
+  struct Queue {
+    std::mutex lock;
+    std::deque<Task> tasks;
+  };
+
+  bool take(size_t self, Task &task);
+  void work(size_t self);
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+  std::mutex lock_;  // guards the fields below
+  std::condition_variable wake_;
+  std::condition_variable idle_;
+  size_t queued_ = 0;      // tasks in the queues
+  size_t unfinished_ = 0;  // tasks submitted and not yet run to the end
+  size_t next_ = 0;        // queue for the next task
+  unsigned long steals_ = 0;
+  bool stopping_ = false;
+};
@@ -0,0 +1,126 @@
+// Driver for [env:netsim]: simulates a network of nodes for a while and
+// reports delivery, latency and channel use.
+//
+//   program [--nodes N] [--hours H] [--seed S] [--area M] [--range M]
+//           [--rate MSGS_PER_NODE_HOUR] [--broadcast SHARE] [--words N]
+//           [--loss P] [--flood] [--PARAMETER VALUE]...
+//           [--sweep PARAMETER=VALUES]... [--seeds N] [--threads N] [--csv FILE]
+//
+// The same options and seed always give the same results, down to the
+// digest line, so a change to the libraries that alters behaviour shows up
+// as a different digest. Every parameter in Sweep.h can be set as an option.
+//
+// --sweep and --seeds run a parameter sweep instead of one simulation, on
+// --threads threads (default one per core), and print one line per point
+// with the seeds' results summed; --csv also writes them to FILE. E.g.
+//
+//   program --sweep nodes=20,50,100 --sweep rate=6,30 --seeds 4 --csv sweep.csv
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "NetSim.h"
+#include "Sweep.h"
+
+static double share(uint64_t part, uint64_t whole) {
+  return whole ? part * 100.0 / whole : 0.0;
+}
+
+static void printResults(const SimConfig &config, const SimResults &r) {
+  uint64_t expected = r.unicasts + r.broadcasts * (config.nodes - 1);
+  printf("nodes            %d, %.1f neighbours each, %.0f m square, %.0f m range\n", config.nodes, r.neighbours,
+         config.areaM, config.rangeM);
+  printf("messages         %llu offered, %llu blocked, %llu unicast, %llu broadcast\n",
+         (unsigned long long)r.offered, (unsigned long long)r.blocked, (unsigned long long)r.unicasts,
+         (unsigned long long)r.broadcasts);
+  printf("delivery         %llu delivered (%.1f%%), %llu failed, %llu pending\n", (unsigned long long)r.delivered,
+         share(r.delivered, r.unicasts), (unsigned long long)r.failed,
+         (unsigned long long)(r.unicasts - r.delivered - r.failed));
+  printf("received         %llu of %llu expected (%.1f%%), %llu duplicates\n", (unsigned long long)r.received,
+         (unsigned long long)expected, share(r.received, expected), (unsigned long long)r.duplicates);
+  printf("latency          p50 %lu ms, p99 %lu ms, max %lu ms\n", (unsigned long)simPercentile(r.latencyMs, 500),
+         (unsigned long)simPercentile(r.latencyMs, 990), (unsigned long)simPercentile(r.latencyMs, 1000));
+  printf("delivery report  p50 %lu ms, p99 %lu ms, max %lu ms\n", (unsigned long)simPercentile(r.deliveryMs, 500),
+         (unsigned long)simPercentile(r.deliveryMs, 990), (unsigned long)simPercentile(r.deliveryMs, 1000));
+  printf("frames           %llu sent, %llu MAC retries, %llu refused (queue full), %.3f%% airtime per node\n",
+         (unsigned long long)r.transmissions, (unsigned long long)r.macRetries, (unsigned long long)r.queueFull,
+         r.airtimeShare * 100);
+  printf("receptions       %llu clean, %llu collided, %llu lost, %llu rejected\n",
+         (unsigned long long)r.receptions, (unsigned long long)r.collisions, (unsigned long long)r.lost,
+         (unsigned long long)r.rejected);
+  printf("mesh             %lu unicasts, %lu floods, %lu relayed, %lu duplicates, %lu TTL expired, %lu beacons\n",
+         (unsigned long)r.mesh.unicasts, (unsigned long)r.mesh.floods, (unsigned long)r.mesh.relayed,
+         (unsigned long)r.mesh.duplicates, (unsigned long)r.mesh.ttlExpired, (unsigned long)r.mesh.beacons);
+  printf("peer list        %lu next hops refused for want of room\n", (unsigned long)r.mesh.peersRefused);
+  printf("link             %lu sent, %lu retransmits, %lu delivered, %lu failed, %lu ACKs\n",
+         (unsigned long)r.link.sent, (unsigned long)r.link.retransmits, (unsigned long)r.link.delivered,
+         (unsigned long)r.link.failed, (unsigned long)r.link.acksSent);
+  printf("digest           %016llx\n", (unsigned long long)r.digest);
+}
+
+static int runSweep(const SimConfig &config, const std::vector<SweepAxis> &axes, int seeds, int threads,
+                    const char *csvPath) {
+  Sweep sweep(config, axes, seeds);
+  if (!sweep.valid()) {
+    fprintf(stderr, "bad configuration in the sweep\n");
+    return 2;
+  }
+  WorkPool pool(threads);
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  sweep.run(pool);
+  double hostSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  sweep.print(stdout);
+  double cpuSec = 0;
+  for (const Sweep::Point &point : sweep.points()) cpuSec += point.hostSeconds;
+  printf("sweep            %zu runs on %d threads in %.2f s (%.1f run-seconds, %lu steals)\n", sweep.runs(),
+         pool.threads(), hostSec, cpuSec, pool.steals());
+  printf("digest           %016llx\n", (unsigned long long)sweep.digest());
+  if (csvPath && !sweep.writeCsv(csvPath)) {
+    fprintf(stderr, "cannot write %s\n", csvPath);
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  SimConfig config;
+  std::vector<SweepAxis> axes;
+  int seeds = 0;
+  int threads = 0;
+  const char *csvPath = nullptr;
+  for (int i = 1; i < argc; i++) {
+    SweepAxis axis;
+    if (!strcmp(argv[i], "--flood")) config.routing = false;
+    else if (!strcmp(argv[i], "--sweep") && i + 1 < argc && sweepParseAxis(argv[i + 1], axis)) {
+      axes.push_back(axis);
+      i++;
+    } else if (!strcmp(argv[i], "--seeds") && i + 1 < argc) seeds = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--threads") && i + 1 < argc) threads = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--csv") && i + 1 < argc) csvPath = argv[++i];
+    else if (!strncmp(argv[i], "--", 2) && i + 1 < argc && simSetParameter(config, argv[i] + 2, atof(argv[i + 1]))) {
+      i++;
+    } else {
+      fprintf(stderr,
+              "usage: %s [--PARAMETER VALUE]... [--flood] [--sweep PARAMETER=V1,V2,...|FIRST:LAST:STEP]..."
+              " [--seeds N] [--threads N] [--csv FILE]\nparameters: %s\n",
+              argv[0], simParameterNames());
+      return 2;
+    }
+  }
+  if (!axes.empty() || seeds > 0) return runSweep(config, axes, seeds, threads, csvPath);
+  if (!simConfigValid(config)) {
+    fprintf(stderr, "bad configuration\n");
+    return 2;
+  }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  SimResults results = NetworkSim(config).run();
+  double hostSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  printResults(config, results);
+  printf("simulated        %.2f h in %.2f s (%.0fx real time, %llu events)\n", config.hours, hostSec,
+         hostSec > 0 ? results.simSeconds / hostSec : 0.0, (unsigned long long)results.events);
+  return 0;
+}
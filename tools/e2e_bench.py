@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Runs the end-to-end scenarios against the host build and compares runs.
+
+    pio run -e native
+    tools/e2e_bench.py .pio/build/native/program -o e2e.json [-c baseline.json]
+
+Each scenario runs the native driver with an echo peer and --json, so every
+message goes from keypresses through encryption, framing, the simulated
+radio, the peer, onReceive, decryption, saveMessage and render. The results
+of all scenarios are written as one JSON object keyed by scenario name.
+With -c, the key figures are printed next to those of an earlier run, with
+the change in percent; changes of 5% or more for the worse are marked.
+
+Latencies are in device time and, like the per-message counts, the same on
+every run of the same tree. messages_per_second is host time and varies.
+"""
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+# Random-looking text that does not compress, long enough to need two fragments
+LONG_TEXT = " ".join(["QXJ7 ZPV9 KRW3 MTB5 YHN2 GDF8 LSC4 VWE6"] * 10)
+
+SCENARIOS = [
+    ("knob-short", ["--input", "knob", "--messages", "20", "--text", "HELLO WORLD"]),
+    ("abc-short", ["--input", "abc", "--messages", "20", "--text", "HELLO WORLD"]),
+    ("t9-sentence", ["--input", "t9", "--messages", "20", "--text", "MEET AT THE GATE AT TEN"]),
+    ("knob-long", ["--input", "knob", "--messages", "3", "--text", LONG_TEXT]),
+]
+
+# (key, label, lower is better)
+FIGURES = [
+    ("messages_per_second", "msgs/s", False),
+    ("latency_us.p50", "p50 us", True),
+    ("latency_us.p99", "p99 us", True),
+    ("allocations_per_message", "allocs/msg", True),
+    ("flash_bytes_per_message", "flash B/msg", True),
+    ("radio_bytes_per_message", "radio B/msg", True),
+    ("i2c_bytes_per_message", "I2C B/msg", True),
+]
+
+
+def figure(results, key):
+    for part in key.split("."):
+        if not isinstance(results, dict) or part not in results:
+            return None
+        results = results[part]
+    return results
+
+
+def run(program, args):
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, "run.json")
+        subprocess.run([program, "--peer", "--json", path] + args, check=True, stdout=subprocess.DEVNULL)
+        with open(path) as f:
+            return json.load(f)
+
+
+def compare(current, baseline):
+    print("%-12s %-12s %12s %12s %8s" % ("scenario", "figure", "baseline", "current", "change"))
+    for name, _ in SCENARIOS:
+        for key, label, lower in FIGURES:
+            new = figure(current.get(name), key)
+            old = figure(baseline.get(name), key)
+            if new is None or old is None:
+                continue
+            change = (new - old) * 100.0 / old if old else 0.0
+            worse = change > 0 if lower else change < 0
+            mark = " !" if worse and abs(change) >= 5 else ""
+            print("%-12s %-12s %12.1f %12.1f %+7.1f%%%s" % (name, label, old, new, change, mark))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("program", help="native driver, e.g. .pio/build/native/program")
+    parser.add_argument("-o", "--output", help="write the results here")
+    parser.add_argument("-c", "--compare", help="results of an earlier run")
+    opts = parser.parse_args()
+
+    results = {}
+    for name, args in SCENARIOS:
+        results[name] = run(opts.program, args)
+        r = results[name]
+        print("%-12s %8.1f msgs/s  p50 %6d us  p99 %6d us  %6.1f allocs  %6.1f flash B  per message"
+              % (name, r["messages_per_second"], r["latency_us"]["p50"], r["latency_us"]["p99"],
+                 r["allocations_per_message"], r["flash_bytes_per_message"]), file=sys.stderr)
+        if r["echo_timeouts"]:
+            print("%s: %d messages were not echoed" % (name, r["echo_timeouts"]), file=sys.stderr)
+
+    if opts.output:
+        with open(opts.output, "w") as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+            f.write("\n")
+    if opts.compare:
+        with open(opts.compare) as f:
+            compare(results, json.load(f))
+    return 1 if any(r["echo_timeouts"] for r in results.values()) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
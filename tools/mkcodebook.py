@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""Chooses the MSG_PACKED codebook in lib/MessageCodec/MessageCodec.cpp.
+
+    tools/mkcodebook.py tools/t9words.txt
+
+Prints the body of the codebook[] initializer. The corpus is the word list
+weighted by rank, each word with and without a trailing space, plus the quick
+replies with sample parameters. Starting from the substrings that occur most,
+it repeatedly parses the corpus greedily and swaps the entries that saved
+the least for the next candidates.
+"""
+import collections
+import sys
+
+ENTRIES = 219  # byte values left after the 37 alphabet symbols
+MAX_ENTRY = 8
+ROUNDS = 40
+SWAP = 10
+
+QUICK_REPLIES = [
+    "OK", "YES", "NO", "ON MY WAY", "RUNNING 10 MIN LATE", "BACK IN 5 MIN", "MEET AT THE GATE",
+    "WHERE ARE YOU", "I AM SAFE", "NEED HELP AT CAMP", "CALL ME", "ARRIVED", "THANKS", "SEE YOU SOON",
+    "WAIT FOR ME", "BATTERY LOW",
+]
+
+
+def parse(text, buckets, weight, use):
+    i = 0
+    cost = 0
+    while i < len(text):
+        for entry in buckets.get(text[i], ()):
+            if text.startswith(entry, i):
+                use[entry] += weight
+                i += len(entry)
+                break
+        else:
+            i += 1
+        cost += 1
+    return cost
+
+
+def main():
+    words = [w.strip() for w in open(sys.argv[1]) if w.strip()]
+    corpus = collections.Counter()
+    for rank, word in enumerate(words):
+        corpus[word + " "] += 1000 / (rank + 10)
+        corpus[word] += 100 / (rank + 10)  # last word of a message
+    for reply in QUICK_REPLIES:
+        corpus[reply] += 5
+
+    candidates = collections.Counter()
+    for text, weight in corpus.items():
+        for i in range(len(text)):
+            for n in range(2, MAX_ENTRY + 1):
+                if i + n <= len(text):
+                    candidates[text[i:i + n]] += weight
+    pool = [s for s, _ in sorted(candidates.items(), key=lambda kv: -kv[1] * (len(kv[0]) - 1))][:3000]
+
+    book, rest = pool[:ENTRIES], pool[ENTRIES:]
+    for _ in range(ROUNDS):
+        buckets = collections.defaultdict(list)
+        for entry in sorted(book, key=len, reverse=True):
+            buckets[entry[0]].append(entry)
+        use = collections.Counter()
+        cost = sum(weight * parse(text, buckets, weight, use) for text, weight in corpus.items())
+        drop = set(sorted(book, key=lambda e: use[e] * (len(e) - 1))[:SWAP])
+        book = [e for e in book if e not in drop]
+        while len(book) < ENTRIES and rest:
+            book.append(rest.pop(0))
+        print("corpus cost %.1f" % cost, file=sys.stderr)
+
+    # By first letter, longest first: the order the encoder relies on
+    book.sort(key=lambda e: (e[0], -len(e), e))
+    line = " "
+    for entry in book:
+        item = ' "%s",' % entry
+        if len(line) + len(item) > 100:
+            print(line)
+            line = " "
+        line += item
+    print(line)
+
+
+if __name__ == "__main__":
+    main()
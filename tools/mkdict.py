@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Builds the T9 dictionary in lib/T9/T9Words.cpp from a word list.
+
+    tools/mkdict.py tools/t9words.txt > lib/T9/T9Words.cpp
+
+The list holds one word per line (or several per line), most common first;
+words are upper-cased and anything that is not A-Z is skipped. The layout
+is described in lib/T9/T9.h.
+"""
+import sys
+
+MAX_WORD = 16
+
+
+class Node:
+    def __init__(self):
+        self.children = {}
+        self.rank = None
+        self.best = 0xFFFF
+        self.offset = 0
+
+
+def build(words):
+    root = Node()
+    for rank, word in enumerate(words):
+        node = root
+        node.best = min(node.best, rank)
+        for letter in word:
+            node = node.children.setdefault(letter, Node())
+            node.best = min(node.best, rank)
+        node.rank = rank
+    return root
+
+
+def layout(root):
+    order = []
+    stack = [root]
+    offset = 8
+    while stack:
+        node = stack.pop()
+        node.offset = offset
+        order.append(node)
+        offset += 3 + (2 if node.rank is not None else 0) + 4 * len(node.children)
+        for letter in sorted(node.children, reverse=True):
+            stack.append(node.children[letter])
+    return order, offset
+
+
+def encode(words):
+    root = build(words)
+    order, size = layout(root)
+    out = bytearray(b"T9D\x01")
+    out += len(words).to_bytes(2, "little") + bytes(2)
+    for node in order:
+        out.append((0x80 if node.rank is not None else 0) | len(node.children))
+        out += node.best.to_bytes(2, "little")
+        if node.rank is not None:
+            out += node.rank.to_bytes(2, "little")
+        for letter in sorted(node.children):
+            out.append(ord(letter))
+            out += node.children[letter].offset.to_bytes(3, "little")
+    assert len(out) == size
+    return out, len(order)
+
+
+def main():
+    seen = set()
+    words = []
+    with open(sys.argv[1]) as f:
+        for word in f.read().split():
+            word = word.upper()
+            if word.isalpha() and word.isascii() and len(word) <= MAX_WORD and word not in seen:
+                seen.add(word)
+                words.append(word)
+    data, nodes = encode(words)
+
+    sys.stdout.reconfigure(newline="\r\n")  # the tree uses CRLF
+
+    print("// Generated by tools/mkdict.py from %s: %d words, %d nodes, %d bytes."
+          % (sys.argv[1].split("/")[-1], len(words), nodes, len(data)))
+    print("// Do not edit.")
+    print('#include "T9.h"')
+    print()
+    print("const uint8_t t9Words[] = {")
+    for i in range(0, len(data), 16):
+        print("  " + " ".join("0x%02x," % b for b in data[i:i + 16]))
+    print("};")
+    print("const size_t t9WordsLen = sizeof(t9Words);")
+
+
+if __name__ == "__main__":
+    main()
@@ -4,6 +4,24 @@
 #include <U8g2lib.h>
 #include <Keypad.h>
 #include <Preferences.h>
+#include <Frame.h>
+#include <MessageLog.h>
+#include <HistoryCache.h>
+#include <HistoryIndex.h>
+#include <HistoryRecord.h>
+#include <ReliableLink.h>
+#include <Fragmenter.h>
+#include <FrameCipher.h>
+#include <KeyEvents.h>
+#include <KnobFilter.h>
+#include <MessageCodec.h>
+#include <Mesh.h>
+#include <Metrics.h>
+#include <MultiTap.h>
+#include <SpscQueue.h>
+#include <T9.h>
+#include <driver/adc.h>
+#include <esp_timer.h>
 
 // OLED Setup
 U8G2_SH1106_128X64_NONAME_F_HW_I2C display(U8G2_R0, U8X8_PIN_NONE, 9, 8);  // SCL = 9, SDA = 8
@@ -21,18 +39,79 @@ byte rowPins[ROWS] = {42, 41, 40, 39};
 byte colPins[COLS] = {38, 37, 36, 35};
 Keypad keypad = Keypad(makeKeymap(keys), rowPins, colPins, ROWS, COLS);
 
-// Preferences
-Preferences prefs;
+// Scanned every 2 ms from an esp_timer; held keys repeat after 400 ms
+const uint64_t keyScanUs = 2000;
+KeyEvents keyEvents(keypad, 400, 80);
+
+// Metrics, shown by '0' in history and dumped as CSV by '#' there or by
+// 'm' over Serial. Durations are in microseconds unless marked otherwise.
+Histogram loopTime("loop", "us");  // from one pass to the next
+Histogram saveTime("save", "us");
+Histogram loadTime("load", "us");
+Histogram renderTime("render", "us");  // drawing and pushing changed pages
+Histogram receiveTime("on_receive", "us");  // in the Wi-Fi task
+Histogram keyLatency("key_screen", "us");  // scan that saw a key to the flush showing it
+Histogram loopRate("loop_rate", "loops/s");  // sampled every second
+Histogram rxPeak("rx_peak", "frames");  // rx queue high water, sampled every second
+Histogram ackTime("ack_rtt", "ms");  // send to delivery report, unicast only
+Histogram rxDepth("rx_queue", "frames");
+Histogram statusDepth("status_queue", "results");
+Histogram inFlightDepth("in_flight", "frames");
+Counter radioSends("radio_tx");
+Counter radioSendErrors("radio_tx_err");
+Counter radioReceives("radio_rx");  // in the Wi-Fi task
+Counter framesPushed("frames_push");
+Counter framesSkipped("frames_skip");  // nothing changed on the panel
+Counter potOverruns("adc_overrun");
+// Totals kept by the libraries, added in by sampleMetrics() every second
+Counter rxOverflows("rx_overflow");
+Counter keysDropped("keys_dropped");
+Counter cacheHits("cache_hit");
+Counter cacheMisses("cache_miss");
+Counter logRecords("log_records");
+Counter logPayload("log_payload");  // bytes of record data
+Counter logBytes("log_bytes");  // programmed into flash, headers included
+Counter logWrites("log_writes");
+Counter logErases("log_erases");
+Counter logCompactions("log_compact");  // erases done ahead of time
+// The Wi-Fi task resets its own metrics when this moves on (see resetMetrics)
+volatile uint32_t metricsResets = 0;
+
+// History (circular log on the "msglog" flash partition)
+MessageLog messageLog;
+HistoryIndex messageIndex;  // by time, peer, direction and text, on "msgidx"
 int messageCount = 0;
 int historyIndex = 0;
 
+// History entry flags
+const uint8_t HISTORY_AWAITING_ACK = 0x01;
+const uint8_t HISTORY_DELIVERED = 0x02;
+const uint8_t HISTORY_FAILED = 0x04;
+
 // Modes
+// A message is kept whole in one history record: its text within
+// HistoryRecord::MAX_TEXT, and encoded (a tag byte and at most a byte per
+// character) after the record header within MessageLog::MAX_RECORD_LEN
+const unsigned int maxMessageLength = MESSAGE_MAX_TEXT;
+static_assert(maxMessageLength <= HistoryRecord::MAX_TEXT, "history records hold the whole text");
+static_assert(HISTORY_HEADER_LEN + 1 + maxMessageLength <= MessageLog::MAX_RECORD_LEN, "a message fits one log record");
 String messageBuffer = "";
 bool isTypingMode = true;  // Start in typing mode
 
+// Moved on by everything that can change what the screen shows, so render()
+// only rebuilds and compares the UI state when it has
+uint32_t uiVersion = 0;
+
 // ESP-NOW
-uint8_t peerAddress[] = {0xA0, 0x85, 0xE3, 0xF0, 0x8F, 0x18};
-int shift = 3;
+uint16_t nodeId = 0;  // low two bytes of our MAC
+uint16_t sendDest = FRAME_BROADCAST;  // 'A' while typing picks another node
+Counter rxDropped("rx_dropped");
+Counter rxRejected("rx_rejected");  // failed decryption or authentication
+
+// Encryption (AES-GCM). The network key is 16 bytes stored as "key" in the
+// "crypto" Preferences namespace; "key <32 hex digits>" on the serial
+// console sets it. Nothing is sent or received until it is.
+FrameCipher cipher;
 
 // Characters
 const char characterSet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 ";
@@ -40,78 +119,886 @@ const int numCharacters = sizeof(characterSet) - 1; // Exclude null terminator
 int currentCharIndex = 0;
 int lastStableCharIndex = -1;
 
-// Potentiometer
-const int potPin = 1;  // GPIO1
+// Text entry: the knob with '0', multi-tap on the digit keys, or T9 with
+// '1' for the next match and '0' for space. 'B' switches while typing.
+enum InputMode { INPUT_KNOB, INPUT_MULTITAP, INPUT_T9, INPUT_MODES };
+const char *const inputModeNames[INPUT_MODES] = {"Knob", "ABC", "T9"};
+InputMode inputMode = INPUT_KNOB;
+MultiTap multiTap(1000);
+T9Dictionary t9Dictionary(t9Words, t9WordsLen);
+T9Input t9(t9Dictionary);
+
+void appendText(const char *text) {
+  for (; *text && messageBuffer.length() < maxMessageLength; text++) messageBuffer += *text;
+}
+
+void appendChar(char c) {
+  char text[2] = {c, '\0'};
+  appendText(text);
+}
+
+// Adds the letter or word still being composed to the message
+void commitEntry() {
+  char c = multiTap.commit();
+  if (c) appendChar(c);
+  if (!t9.empty()) {
+    appendText(t9.text());
+    t9.clear();
+  }
+}
+
+// Quick replies: '#' on an empty message opens the picker. A reply with a
+// "{}" waits for its parameter to be typed and sent with '#'.
+int quickReplyIndex = -1;  // picker position, -1 while closed
+int pendingReply = -1;     // reply waiting for its parameter
+
+String formatReply(int id, const String &param) {
+  char text[maxMessageLength + 1];
+  size_t len = quickReplyFormat(id, param.c_str(), text, maxMessageLength);
+  text[len] = '\0';
+  return text;
+}
 
 // Dummy Slots Between Characters
 const int extraSlotsBetween = 3;
 const int totalSlots = numCharacters * (extraSlotsBetween + 1) - extraSlotsBetween;
 
-// Caesar Cipher
-String encrypt(String message) {
-  String result = "";
-  for (char c : message) {
-    if (isAlpha(c)) {
-      result += char((c - 'A' + shift) % 26 + 'A');
-    } else if (isdigit(c)) {
-      result += char((c - '0' + shift) % 10 + '0');
-    } else if (c == ' ') {
-      result += ' ';
-    } else {
-      result += c;
-    }
+// Potentiometer (GPIO1 = ADC1 channel 0), converted continuously by the ADC
+// DMA and drained into the filter every millisecond
+const int potPin = 1;
+const adc1_channel_t potChannel = ADC1_CHANNEL_0;
+const uint32_t potSampleHz = 4000;
+const uint32_t potFrameBytes = 16 * SOC_ADC_DIGI_RESULT_BYTES;  // 4 ms per DMA frame
+KnobFilter knob(totalSlots, 8);
+bool potContinuous = false;
+
+// History. Records are HistoryRecord schema 1; the delivery state lives in
+// the log's status flags.
+bool loadHistoryRecord(uint32_t index, HistoryRecord &record) {
+  uint8_t data[MessageLog::MAX_RECORD_LEN];
+  size_t len = messageLog.read(index, data, sizeof(data), &record.flags);
+  if (!historyUnpack(data, len, record)) return false;
+  record.seq = messageLog.seqOf(index);
+  return true;
+}
+
+HistoryCache historyCache(loadHistoryRecord);
+HistoryRecord scratchRecord;  // not on the stack, as records are over 500 bytes
+
+// Seconds of uptime summed over boots (there is no real-time clock), picking
+// up from the newest indexed entry; only used to order and range history
+uint32_t clockBase = 0;
+
+uint32_t historyTime() {
+  return clockBase + millis() / 1000;
+}
+
+// Index entries follow the log to flash, never ahead of it
+void flushHistory() {
+  if (messageLog.flush()) messageIndex.flush();
+}
+
+// Returns the log sequence number of the new entry. The peer is the sender
+// of a received message and the destination of a sent one.
+uint32_t saveMessage(const char *msg, uint8_t kind, uint16_t peer, uint8_t flags = 0) {
+  uint32_t start = micros();
+  HistoryRecord &record = scratchRecord;
+  record.seq = messageLog.nextSeq();
+  record.time = historyTime();
+  record.peer = peer;
+  record.kind = kind;
+  record.textLen = strnlen(msg, HistoryRecord::MAX_TEXT);
+  memcpy(record.text, msg, record.textLen);
+  record.text[record.textLen] = '\0';
+  uint8_t data[MessageLog::MAX_RECORD_LEN];
+  size_t len = historyPack(record, data, sizeof(data));
+  messageLog.append(data, len, flags);
+  if (!messageIndex.add(record.seq, record.time, peer, kind, record.text, record.textLen)) {
+    flushHistory();
+    messageIndex.add(record.seq, record.time, peer, kind, record.text, record.textLen);
   }
-  return result;
+  historyCache.invalidate();
+  messageCount = messageLog.count();
+  if (historyIndex >= messageCount) historyIndex = messageCount > 0 ? messageCount - 1 : 0;
+  uiVersion++;
+  saveTime.record(micros() - start);
+  return record.seq;
 }
 
-String decrypt(String message) {
-  String result = "";
-  for (char c : message) {
-    if (isAlpha(c)) {
-      result += char((c - 'A' - shift + 26) % 26 + 'A');
-    } else if (isdigit(c)) {
-      result += char((c - '0' - shift + 10) % 10 + '0');
-    } else if (c == ' ') {
-      result += ' ';
-    } else {
-      result += c;
+// The log batches appends in RAM. They go to flash once keys and radio have
+// been quiet for historyIdleMs, or historyFlushMs after the oldest at most;
+// idle time is also used to erase the next sector if nothing live is in it.
+const unsigned long historyIdleMs = 250;
+const unsigned long historyFlushMs = 2000;
+unsigned long lastActivity = 0;
+unsigned long lastHistoryFlush = 0;
+
+void serviceHistory() {
+  unsigned long now = millis();
+  bool idle = now - lastActivity >= historyIdleMs;
+  if (messageLog.pending() == 0 && messageIndex.pending() == 0) {
+    lastHistoryFlush = now;
+    if (idle) messageLog.compact();
+  } else if (idle || now - lastHistoryFlush >= historyFlushMs) {
+    flushHistory();
+    lastHistoryFlush = now;
+  }
+}
+
+// The text of the record with a log sequence number
+size_t indexedText(void *ctx, uint32_t seq, char *buf, size_t cap) {
+  HistoryRecord &record = scratchRecord;
+  if (!loadHistoryRecord(seq - messageLog.seqOf(0), record)) return 0;
+  size_t len = record.textLen < cap ? record.textLen : cap;
+  memcpy(buf, record.text, len);
+  return len;
+}
+
+// Indexes log records the index missed: lost with a power cut, or written
+// before it existed. Records converted from strings have no time or peer.
+void catchUpIndex() {
+  if (messageIndex.nextSeq() > messageLog.nextSeq()) messageIndex.reset();  // the log was replaced
+  uint32_t seq = messageIndex.nextSeq() > messageLog.seqOf(0) ? messageIndex.nextSeq() : messageLog.seqOf(0);
+  HistoryRecord &record = scratchRecord;
+  for (; seq < messageLog.nextSeq(); seq++) {
+    if (!loadHistoryRecord(seq - messageLog.seqOf(0), record)) continue;
+    uint32_t time = record.time ? record.time : messageIndex.lastTime();
+    if (!messageIndex.add(seq, time, record.peer, record.kind, record.text, record.textLen)) {
+      flushHistory();
+      messageIndex.add(seq, time, record.peer, record.kind, record.text, record.textLen);
     }
   }
-  return result;
+  flushHistory();
 }
 
-bool isAlpha(char c) {
-  return c >= 'A' && c <= 'Z';
+// History search: '*' picks a filter and '#' jumps to the next older entry
+// that passes it and holds the text left in the message buffer, wrapping
+// around to the newest
+enum HistoryFilter { FILTER_ALL, FILTER_RECEIVED, FILTER_SENT, FILTER_PEER, FILTER_DAY, FILTERS };
+const char *const filterNames[FILTERS] = {"All", "Received", "Sent", "Peer", "Last day"};
+HistoryFilter historyFilter = FILTER_ALL;
+
+// Valid until the cache is next used
+const HistoryRecord &loadMessage(int index) {
+  uint32_t start = micros();
+  const HistoryRecord &record = historyCache.get(index);
+  loadTime.record(micros() - start);
+  return record;
 }
 
-// History
-void saveMessage(String msg, String type) {
-  prefs.begin("messages", false);
-  prefs.putString(("msg" + String(messageCount)).c_str(), type + ": " + msg);
-  messageCount++;
-  prefs.putInt("count", messageCount);
-  prefs.end();
+// Warm the entries one 'A'/'B' press away
+void prefetchNeighbours() {
+  if (historyIndex > 0) historyCache.prefetch(historyIndex - 1);
+  if (historyIndex < messageCount - 1) historyCache.prefetch(historyIndex + 1);
 }
 
-String loadMessage(int index) {
-  prefs.begin("messages", true);
-  String msg = prefs.getString(("msg" + String(index)).c_str(), "");
-  prefs.end();
-  return msg;
+// The index holds fewer entries than the log can; say so when older
+// records went unsearched
+String noMatchTitle() {
+  uint32_t first = messageLog.seqOf(0);
+  if (messageIndex.firstSeq() <= first) return "No match";
+  return "Not in last " + String((unsigned long)(messageLog.nextSeq() - messageIndex.firstSeq()));
+}
+
+bool findInHistory() {
+  HistoryIndex::Query query;
+  if (historyFilter == FILTER_RECEIVED) query.kinds = HistoryIndex::KIND_RECEIVED;
+  if (historyFilter == FILTER_SENT) query.kinds = HistoryIndex::KIND_SENT;
+  if (historyFilter == FILTER_PEER) {
+    query.anyPeer = false;
+    query.peer = sendDest;
+  }
+  if (historyFilter == FILTER_DAY) query.fromTime = historyTime() > 86400 ? historyTime() - 86400 : 0;
+  query.text = messageBuffer.c_str();
+
+  uint32_t first = messageLog.seqOf(0);
+  uint32_t found;
+  if (messageIndex.search(query, first, first + historyIndex, &found, 1, indexedText, nullptr) == 0 &&
+      messageIndex.search(query, first + historyIndex, messageLog.nextSeq(), &found, 1, indexedText, nullptr) == 0) {
+    return false;
+  }
+  historyIndex = found - first;
+  prefetchNeighbours();
+  return true;
 }
 
 // New Message
 bool newMessageReceived = false;
 String lastReceivedMessage = "";
 
-// ESP-NOW Receive
+// Receive Queue (filled by onReceive() in the Wi-Fi task, drained by loop())
+struct RxMessage {
+  uint8_t mac[6];
+  uint8_t len;
+  uint8_t data[ESP_NOW_MAX_DATA_LEN];
+};
+
+SpscQueue<RxMessage, 16> rxQueue;
+
+// Send results from the ESP-NOW send callback, also in the Wi-Fi task
+SpscQueue<uint8_t, 16> sendStatusQueue;
+
+// Toasts (timed screens that no longer block loop())
+String toastTitle = "";
+String toastBody = "";
+unsigned long toastUntil = 0;
+
+void showToast(const char *title, const String &body, unsigned long durationMs) {
+  toastTitle = title;
+  toastBody = body;
+  toastUntil = millis() + durationMs;
+  uiVersion++;
+}
+
+bool toastActive() {
+  return toastUntil != 0 && (long)(millis() - toastUntil) < 0;
+}
+
+// Metrics screen: one page per histogram, then the counters. 'A'/'B' page,
+// '#' dumps everything over Serial, 'C' resets, any other key closes it.
+const int countersPerPage = 5;
+int metricsPage = -1;  // -1 while closed
+String metricsShown = "";
+unsigned long metricsShownAt = 0;
+
+int metricsPages() {
+  int counters = 0;
+  for (const Counter *c = Counter::first(); c; c = c->next()) counters++;
+  return Histogram::registered() + (counters + countersPerPage - 1) / countersPerPage;
+}
+
+// Title and lines of a page, separated by '\n'
+String metricsText(int page) {
+  char line[64];  // a name or unit and two 32-bit values
+  snprintf(line, sizeof(line), "%d/%d ", page + 1, metricsPages());
+  String text = line;
+  const Histogram *h = Histogram::first();
+  for (int i = 0; h && i < page; i++) h = h->next();
+  if (h) {
+    text += h->name();
+    snprintf(line, sizeof(line), "\nn %lu avg %lu", (unsigned long)h->count(), (unsigned long)h->mean());
+    text += line;
+    snprintf(line, sizeof(line), "\np50 <=%lu p99 <=%lu", (unsigned long)h->percentile(500),
+             (unsigned long)h->percentile(990));
+    text += line;
+    snprintf(line, sizeof(line), "\nmax %lu %s", (unsigned long)h->max(), h->unit());
+    return text + line;
+  }
+
+  text += "counters";
+  const Counter *c = Counter::first();
+  for (int i = 0; c && i < (page - Histogram::registered()) * countersPerPage; i++) c = c->next();
+  for (int i = 0; c && i < countersPerPage; i++, c = c->next()) {
+    snprintf(line, sizeof(line), "\n%s %lu", c->name(), (unsigned long)c->value());
+    text += line;
+  }
+  return text;
+}
+
+void dumpMetrics() {
+  char line[384];
+  Serial.printf("# metrics at %lu ms\n", millis());
+  for (const Counter *c = Counter::first(); c; c = c->next()) {
+    if (c->csv(line, sizeof(line))) Serial.println(line);
+  }
+  for (const Histogram *h = Histogram::first(); h; h = h->next()) {
+    if (h->csv(line, sizeof(line))) Serial.println(line);
+  }
+}
+
+// Metrics written in the Wi-Fi task are left to it, to keep a single writer
+void resetMetrics() {
+  for (Counter *c = Counter::first(); c; c = c->next()) {
+    if (c != &radioReceives) c->reset();
+  }
+  for (Histogram *h = Histogram::first(); h; h = h->next()) {
+    if (h != &receiveTime) h->reset();
+  }
+  metricsResets = metricsResets + 1;
+}
+
+void metricsKey(char key) {
+  int pages = metricsPages();
+  if (key == 'A') metricsPage = (metricsPage + pages - 1) % pages;
+  else if (key == 'B') metricsPage = (metricsPage + 1) % pages;
+  else if (key == '#') dumpMetrics();
+  else if (key == 'C') resetMetrics();
+  else metricsPage = -1;
+  metricsShownAt = 0;
+}
+
+// Retained UI (only the SH1106 pages that changed are pushed over I2C)
+enum Screen { SCREEN_TYPING, SCREEN_HISTORY, SCREEN_TOAST, SCREEN_RECEIVED, SCREEN_QUICK, SCREEN_METRICS };
+
+struct UiState {
+  Screen screen;
+  String title;
+  String text;
+  char selected;
+  InputMode input;
+  int choice;
+  int choices;
+  int historyIndex;
+  int messageCount;
+  uint8_t flags;
+  uint16_t dest;
+};
+
+UiState shownUi;
+bool uiValid = false;
+uint8_t shownFrame[128 * 64 / 8];  // what the panel currently shows
+unsigned long pagesPushed = 0;
+
+UiState currentUi() {
+  UiState ui;
+  ui.selected = 0;
+  ui.input = INPUT_KNOB;
+  ui.choice = 0;
+  ui.choices = 0;
+  ui.historyIndex = 0;
+  ui.messageCount = 0;
+  ui.flags = 0;
+  ui.dest = 0;
+
+  if (newMessageReceived) {
+    ui.screen = SCREEN_RECEIVED;
+    ui.text = lastReceivedMessage;
+  } else if (toastActive()) {
+    ui.screen = SCREEN_TOAST;
+    ui.title = toastTitle;
+    ui.text = toastBody;
+  } else if (metricsPage >= 0) {
+    ui.screen = SCREEN_METRICS;
+    ui.text = metricsShown;
+  } else if (isTypingMode && quickReplyIndex >= 0) {
+    ui.screen = SCREEN_QUICK;
+    ui.text = formatReply(quickReplyIndex, "...");
+    ui.choice = quickReplyIndex;
+    ui.choices = quickReplyCount();
+  } else if (isTypingMode) {
+    ui.screen = SCREEN_TYPING;
+    ui.text = messageBuffer;
+    ui.input = inputMode;
+    if (inputMode == INPUT_KNOB) {
+      ui.selected = characterSet[currentCharIndex];
+    } else if (inputMode == INPUT_MULTITAP) {
+      ui.selected = multiTap.pending();
+      if (ui.selected) ui.text += ui.selected;
+    } else {
+      ui.text += t9.text();
+      ui.choice = t9.choice();
+      ui.choices = t9.choices();
+    }
+    if (pendingReply >= 0) {
+      ui.title = "Reply:";
+      ui.text = formatReply(pendingReply, ui.text);
+    }
+    ui.dest = sendDest;
+  } else {
+    ui.screen = SCREEN_HISTORY;
+    ui.historyIndex = historyIndex;
+    ui.messageCount = messageCount;
+    if (historyFilter != FILTER_ALL) ui.title = filterNames[historyFilter];
+    if (messageCount > 0) {
+      const HistoryRecord &record = loadMessage(historyIndex);
+      const char *kind = historyKindName(record.kind);
+      ui.text = *kind ? String(kind) + ": " + record.text : String(record.text);
+      ui.flags = record.flags;
+    }
+  }
+  return ui;
+}
+
+bool sameUi(const UiState &a, const UiState &b) {
+  return a.screen == b.screen && a.selected == b.selected && a.input == b.input && a.choice == b.choice &&
+         a.choices == b.choices && a.historyIndex == b.historyIndex &&
+         a.messageCount == b.messageCount && a.flags == b.flags && a.dest == b.dest && a.title == b.title &&
+         a.text == b.text;
+}
+
+void drawUi(const UiState &ui) {
+  switch (ui.screen) {
+    case SCREEN_RECEIVED:
+      display.drawStr(0, 10, "Received:");
+      display.drawStr(0, 30, ui.text.c_str());
+      break;
+    case SCREEN_TOAST:
+      display.drawStr(0, 10, ui.title.c_str());
+      display.drawStr(0, 30, ui.text.c_str());
+      break;
+    case SCREEN_QUICK: {
+      String title = "Quick reply " + String(ui.choice + 1) + "/" + String(ui.choices);
+      display.drawStr(0, 10, title.c_str());
+      display.drawStr(0, 30, ui.text.c_str());
+      display.drawStr(0, 50, "A/B: pick  #: use");
+      break;
+    }
+    case SCREEN_TYPING: {
+      display.drawStr(0, 10, ui.title.length() > 0 ? ui.title.c_str() : "Typing:");
+      display.drawStr(50, 10, ui.text.c_str());
+
+      if (ui.input == INPUT_T9) {
+        display.drawStr(0, 30, "T9:");
+        if (ui.choices > 1) {
+          String choice = String(ui.choice + 1) + "/" + String(ui.choices) + " (1: next)";
+          display.drawStr(50, 30, choice.c_str());
+        }
+      } else {
+        display.drawStr(0, 30, ui.input == INPUT_KNOB ? "Select:" : "ABC:");
+        String shownChar = ui.selected == ' ' ? "[SPACE]" : ui.selected ? String(ui.selected) : String("-");
+        display.drawStr(50, 30, shownChar.c_str());
+      }
+
+      char to[16];
+      if (ui.dest == FRAME_BROADCAST) snprintf(to, sizeof(to), "To: ALL");
+      else snprintf(to, sizeof(to), "To: %04X", ui.dest);
+      display.drawStr(0, 50, to);
+      break;
+    }
+    case SCREEN_METRICS: {
+      int y = 10;
+      for (int start = 0; start < (int)ui.text.length(); y += 10) {
+        int end = ui.text.indexOf('\n', start);
+        if (end < 0) end = ui.text.length();
+        display.drawStr(0, y, ui.text.substring(start, end).c_str());
+        start = end + 1;
+      }
+      break;
+    }
+    case SCREEN_HISTORY:
+      display.drawStr(0, 10, "History:");
+      display.drawStr(60, 10, ui.title.c_str());
+      if (ui.messageCount == 0) {
+        display.drawStr(0, 30, "No messages");
+      } else {
+        String idxStr = String(ui.historyIndex + 1) + "/" + String(ui.messageCount);
+        display.drawStr(0, 20, idxStr.c_str());
+        display.drawStr(0, 40, ui.text.c_str());
+        if (ui.flags & HISTORY_AWAITING_ACK) {
+          const char *state = ui.flags & HISTORY_DELIVERED ? "Delivered"
+                            : ui.flags & HISTORY_FAILED    ? "Failed"
+                                                           : "Pending";
+          display.drawStr(60, 20, state);
+        }
+      }
+      break;
+  }
+}
+
+// Pushes, per page, the span of 8x8 tiles that differ from the panel
+bool flushChangedPages() {
+  uint8_t *frame = display.getBufferPtr();
+  int tileWidth = display.getBufferTileWidth();
+  int pageBytes = tileWidth * 8;
+  bool pushed = false;
+
+  for (int page = 0; page < display.getBufferTileHeight(); page++) {
+    uint8_t *drawn = frame + page * pageBytes;
+    uint8_t *shown = shownFrame + page * pageBytes;
+    int first = -1;
+    int last = -1;
+    for (int tile = 0; tile < tileWidth; tile++) {
+      if (!uiValid || memcmp(drawn + tile * 8, shown + tile * 8, 8) != 0) {
+        if (first < 0) first = tile;
+        last = tile;
+      }
+    }
+    if (first < 0) continue;
+
+    display.updateDisplayArea(first, page, last - first + 1, 1);
+    memcpy(shown + first * 8, drawn + first * 8, (last - first + 1) * 8);
+    pagesPushed++;
+    pushed = true;
+  }
+  return pushed;
+}
+
+// Key-to-screen latency, from the scan that saw a key to the end of the
+// flush that shows its effect. Keys that change nothing are not counted.
+bool keyWaiting = false;
+uint32_t keySeenUs = 0;
+
+uint32_t shownVersion = 0;
+bool toastShown = false;
+
+void render() {
+  bool timeKey = keyWaiting;
+  keyWaiting = false;
+  // What changes with time alone: toasts ending and the metrics screen,
+  // refreshed twice a second as the loop metrics change every pass
+  if (toastActive() != toastShown) {
+    toastShown = !toastShown;
+    uiVersion++;
+  }
+  if (metricsPage >= 0 && (metricsShownAt == 0 || millis() - metricsShownAt >= 500)) {
+    metricsShown = metricsText(metricsPage);
+    metricsShownAt = millis();
+    uiVersion++;
+  }
+  if (uiValid && uiVersion == shownVersion) {
+    framesSkipped.add();
+    return;
+  }
+
+  UiState ui = currentUi();
+  shownVersion = uiVersion;
+  if (uiValid && sameUi(ui, shownUi)) {
+    framesSkipped.add();
+    return;
+  }
+
+  uint32_t start = micros();
+  display.clearBuffer();
+  display.setFont(u8g2_font_6x10_tr);
+  drawUi(ui);
+  bool pushed = flushChangedPages();
+  renderTime.record(micros() - start);
+  if (pushed) {
+    framesPushed.add();
+    if (timeKey) keyLatency.record(micros() - keySeenUs);
+  } else {
+    framesSkipped.add();
+  }
+
+  shownUi = ui;
+  uiValid = true;
+}
+
+// Scheduler
+struct Task {
+  unsigned long intervalMs;
+  unsigned long lastRun;
+  void (*run)();
+};
+
+unsigned long loopCount = 0;
+
+bool startPotSampling() {
+  adc_digi_init_config_t init = {};
+  init.max_store_buf_size = 4 * potFrameBytes;
+  init.conv_num_each_intr = potFrameBytes;
+  init.adc1_chan_mask = 1 << potChannel;
+  if (adc_digi_initialize(&init) != ESP_OK) return false;
+
+  adc_digi_pattern_config_t pattern = {};
+  pattern.atten = ADC_ATTEN_DB_11;
+  pattern.channel = potChannel;
+  pattern.unit = 0;
+  pattern.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+  adc_digi_configuration_t config = {};
+  config.pattern_num = 1;
+  config.adc_pattern = &pattern;
+  config.sample_freq_hz = potSampleHz;
+  config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+  if (adc_digi_controller_configure(&config) != ESP_OK || adc_digi_start() != ESP_OK) {
+    adc_digi_deinitialize();
+    return false;
+  }
+  return true;
+}
+
+// Feeds whatever the DMA has converted since the last call into the filter.
+// Without continuous mode, falls back to one analogRead() per call.
+void samplePot() {
+  if (!potContinuous) {
+    knob.sample(analogRead(potPin));
+    return;
+  }
+  uint8_t buf[4 * potFrameBytes];
+  uint32_t len = 0;
+  esp_err_t err = adc_digi_read_bytes(buf, sizeof(buf), &len, 0);
+  if (err == ESP_ERR_INVALID_STATE) potOverruns.add();
+  for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= len; i += SOC_ADC_DIGI_RESULT_BYTES) {
+    adc_digi_output_data_t result;
+    memcpy(&result, buf + i, sizeof(result));
+    if (result.type2.unit == 0 && result.type2.channel == potChannel) knob.sample(result.type2.data);
+  }
+}
+
+// Adds to a Counter what a running total gained since the last call
+void addGrowth(Counter &counter, uint32_t total, uint32_t &last) {
+  counter.add(total - last);
+  last = total;
+}
+
+void sampleMetrics() {
+  static unsigned long lastLoopCount = 0;
+  loopRate.record(loopCount - lastLoopCount);
+  lastLoopCount = loopCount;
+  rxPeak.record(rxQueue.highWater());
+
+  static uint32_t overflowTotal = 0, droppedTotal = 0, hitTotal = 0, missTotal = 0;
+  addGrowth(rxOverflows, rxQueue.overflows(), overflowTotal);
+  addGrowth(keysDropped, keyEvents.dropped(), droppedTotal);
+  addGrowth(cacheHits, historyCache.hits(), hitTotal);
+  addGrowth(cacheMisses, historyCache.misses(), missTotal);
+  const MessageLog::Stats &log = messageLog.stats();
+  static MessageLog::Stats logged = {};
+  addGrowth(logRecords, log.records, logged.records);
+  addGrowth(logPayload, log.payloadBytes, logged.payloadBytes);
+  addGrowth(logBytes, log.bytesWritten, logged.bytesWritten);
+  addGrowth(logWrites, log.writes, logged.writes);
+  addGrowth(logErases, log.erases, logged.erases);
+  addGrowth(logCompactions, log.compactions, logged.compactions);
+}
+
+void setNetworkKey(const char *hex) {
+  uint8_t key[FrameCipher::KEY_LEN];
+  bool valid = strlen(hex) == 2 * sizeof(key);
+  for (size_t i = 0; valid && i < sizeof(key); i++) {
+    char digits[3] = {hex[2 * i], hex[2 * i + 1], '\0'};
+    valid = isxdigit((unsigned char)digits[0]) && isxdigit((unsigned char)digits[1]);
+    key[i] = strtoul(digits, nullptr, 16);
+  }
+  if (!valid) {
+    Serial.println("key: expected 32 hex digits");
+    return;
+  }
+  Preferences prefs;
+  prefs.begin("crypto", false);
+  bool saved = prefs.putBytes("key", key, sizeof(key)) == sizeof(key);
+  prefs.end();
+  cipher.setKey(key);
+  memset(key, 0, sizeof(key));
+  Serial.println(saved ? "Network key set" : "Network key set, but not saved");
+}
+
+// 'm' dumps the metrics; "key <32 hex digits>" sets the network key
+void serviceConsole() {
+  static char line[48];
+  static size_t lineLen = 0;
+  while (Serial.available() > 0) {
+    char c = Serial.read();
+    if (c == '\r' || c == '\n') {
+      line[lineLen] = '\0';
+      if (strncmp(line, "key ", 4) == 0) setNetworkKey(line + 4);
+      lineLen = 0;
+    } else if (c == 'm' && lineLen == 0) {
+      dumpMetrics();
+    } else if (lineLen < sizeof(line) - 1) {
+      line[lineLen++] = c;
+    }
+  }
+}
+
+void serviceLink();
+
+Task tasks[] = {
+  {1, 0, samplePot},
+  {5, 0, serviceLink},
+  {100, 0, serviceHistory},
+  {100, 0, serviceConsole},
+  {1000, 0, sampleMetrics},
+};
+const int numTasks = sizeof(tasks) / sizeof(tasks[0]);
+
+void runTasks() {
+  unsigned long now = millis();
+  for (int i = 0; i < numTasks; i++) {
+    if (now - tasks[i].lastRun >= tasks[i].intervalMs) {
+      tasks[i].lastRun = now;
+      tasks[i].run();
+    }
+  }
+}
+
+// ESP-NOW Receive (only copies bytes in, everything else happens in loop())
 void onReceive(const uint8_t *mac, const uint8_t *incomingData, int len) {
-  String encryptedMsg = String((char*)incomingData);
-  String msg = decrypt(encryptedMsg);
-  saveMessage(msg, "Received");
+  static uint32_t resetsSeen = 0;
+  if (resetsSeen != metricsResets) {
+    resetsSeen = metricsResets;
+    radioReceives.reset();
+    receiveTime.reset();
+  }
+  uint32_t start = micros();
+  radioReceives.add();
+  RxMessage *slot = len > 0 ? rxQueue.beginPush() : nullptr;
+  if (slot) {
+    if (len > ESP_NOW_MAX_DATA_LEN) len = ESP_NOW_MAX_DATA_LEN;
+    memcpy(slot->mac, mac, 6);
+    memcpy(slot->data, incomingData, len);
+    slot->len = len;
+    rxQueue.commitPush();
+  }
+  receiveTime.record(micros() - start);
+}
+
+void onSent(const uint8_t *mac, esp_now_send_status_t status) {
+  sendStatusQueue.push(status == ESP_NOW_SEND_SUCCESS);
+}
+
+// ESP-NOW Delivery (through the mesh, which picks the next hop)
+bool radioSend(void *ctx, const uint8_t *mac, const uint8_t *frame, size_t len, bool forwarded);
+
+// Fails once ESP-NOW's peer list is full; Mesh then floods via that hop
+bool updatePeer(void *ctx, const uint8_t *mac, bool add) {
+  if (!add) {
+    esp_now_del_peer(mac);
+    return true;
+  }
+  if (esp_now_is_peer_exist(mac)) return true;
+  esp_now_peer_info_t peerInfo = {};
+  memcpy(peerInfo.peer_addr, mac, 6);
+  peerInfo.channel = 0;
+  peerInfo.encrypt = false;  // payloads are sealed by FrameCipher instead
+  return esp_now_add_peer(&peerInfo) == ESP_OK;
+}
+
+Mesh mesh(radioSend, updatePeer);
+
+bool transmitFrame(void *ctx, const uint8_t *frame, size_t len) {
+  return mesh.transmit(frame, len);
+}
 
-  newMessageReceived = true;
-  lastReceivedMessage = msg;
+// When each unicast message still waiting for its ACK was sent
+struct SentAt {
+  bool used;
+  uint32_t logSeq;
+  unsigned long ms;
+};
+SentAt sentAt[Fragmenter::OUTGOING];
+
+void noteSent(uint32_t logSeq) {
+  for (SentAt &s : sentAt) {
+    if (s.used) continue;
+    s.used = true;
+    s.logSeq = logSeq;
+    s.ms = millis();
+    return;
+  }
+}
+
+void onDeliveryStatus(void *ctx, uint32_t logSeq, bool delivered) {
+  for (SentAt &s : sentAt) {
+    if (!s.used || s.logSeq != logSeq) continue;
+    s.used = false;
+    if (delivered) ackTime.record(millis() - s.ms);
+  }
+  messageLog.setFlags(logSeq, delivered ? HISTORY_DELIVERED : HISTORY_FAILED);
+  historyCache.invalidate();
+  uiVersion++;
+
+  if (delivered) {
+    if (toastActive() && toastTitle == "Sending:") toastTitle = "Delivered:";
+  } else if (messageLog.contains(logSeq)) {
+    showToast("Not Delivered", loadMessage(logSeq - messageLog.seqOf(0)).text, 2000);
+  }
+}
+
+Fragmenter fragmenter(onDeliveryStatus);
+ReliableLink link(transmitFrame, Fragmenter::linkStatus, &fragmenter);
+
+// Relays and beacons also produce send results, which the link has to skip
+bool radioSend(void *ctx, const uint8_t *mac, const uint8_t *frame, size_t len, bool forwarded) {
+  if (esp_now_send(mac, frame, len) != ESP_OK) {
+    radioSendErrors.add();
+    return false;
+  }
+  radioSends.add();
+  if (forwarded) link.noteOtherTransmit();
+  return true;
+}
+
+// Cycles through ALL and every node the mesh has a route to
+void nextDestination() {
+  uint16_t ids[Mesh::MAX_ROUTES];
+  int n = mesh.destinations(ids, Mesh::MAX_ROUTES);
+  int current = -1;
+  for (int i = 0; i < n; i++) {
+    if (ids[i] == sendDest) current = i;
+  }
+  sendDest = current + 1 < n ? ids[current + 1] : FRAME_BROADCAST;
+}
+
+void serviceLink() {
+  statusDepth.record(sendStatusQueue.size());
+  inFlightDepth.record(link.inFlight());
+  uint8_t *ok;
+  while ((ok = sendStatusQueue.peek()) != nullptr) {
+    link.onLinkStatus(*ok, millis());
+    sendStatusQueue.pop();
+  }
+  link.tick(millis());
+  mesh.tick(millis());
+  fragmenter.pump(link, millis());
+  fragmenter.expire(millis());
+}
+
+void processReceived() {
+  rxDepth.record(rxQueue.size());
+  RxMessage *rx;
+  while ((rx = rxQueue.peek()) != nullptr) {
+    lastActivity = millis();
+    FrameView frame;
+    if (!frameDecode(rx->data, rx->len, frame)) {
+      rxDropped.add();
+      rxQueue.pop();
+      continue;
+    }
+    if (!mesh.receive(rx->mac, rx->data, rx->len, frame, millis())) {
+      rxQueue.pop();
+      continue;
+    }
+
+    // Every frame must decrypt before it is acted on, routed back to or
+    // de-duplicated
+    uint8_t plain[FRAME_MAX_PAYLOAD];
+    uint32_t epoch = 0;
+    int plainLen = cipher.open(frame, plain, &epoch);
+    if (plainLen < 0) {
+      rxRejected.add();
+      rxQueue.pop();
+      continue;
+    }
+    frame.payload = plain;
+    frame.payloadLen = plainLen;
+    mesh.heard(rx->mac, frame.header, millis());
+
+    if (frame.header.type == FRAME_BEACON || !link.receive(frame, millis(), epoch) ||
+        frame.header.type != FRAME_TEXT) {
+      rxQueue.pop();
+      continue;
+    }
+
+    uint8_t encoded[Fragmenter::MAX_MESSAGE_LEN];
+    size_t encodedLen = fragmenter.receive(frame, encoded, sizeof(encoded), millis());
+    rxQueue.pop();
+    if (encodedLen == 0) continue;  // waiting for more fragments
+
+    char text[maxMessageLength + 1];
+    size_t len = messageDecode(encoded, encodedLen, text, maxMessageLength);
+    if (len == 0) {
+      rxRejected.add();
+      continue;
+    }
+    text[len] = '\0';
+
+    saveMessage(text, HISTORY_RECEIVED, frame.header.sender);
+
+    newMessageReceived = true;
+    lastReceivedMessage = text;
+    uiVersion++;
+  }
+}
+
+// ESP-NOW Send (a message to one node stays Pending until it ACKs;
+// broadcasts are not acknowledged). Nothing is saved or queued without a
+// network key.
+bool sendText(const String &text) {
+  size_t len = text.length();
+  if (!cipher.keyed() || len > maxMessageLength || !fragmenter.canSend()) return false;
+
+  uint8_t encoded[Fragmenter::MAX_MESSAGE_LEN];
+  size_t encodedLen = messageEncode(text.c_str(), len, encoded, sizeof(encoded));
+  if (encodedLen == 0) return false;
+
+  uint32_t logSeq =
+      saveMessage(text.c_str(), HISTORY_SENT, sendDest, sendDest == FRAME_BROADCAST ? 0 : HISTORY_AWAITING_ACK);
+  if (!fragmenter.send(sendDest, encoded, encodedLen, logSeq)) return false;
+  if (sendDest != FRAME_BROADCAST) noteSent(logSeq);
+  fragmenter.pump(link, millis());
+  return true;
 }
 
 // Setup
@@ -123,11 +1010,51 @@ void setup() {
   display.drawStr(0, 10, "Booting...");
   display.sendBuffer();
 
-  prefs.begin("messages", true);
-  messageCount = prefs.getInt("count", 0);
-  prefs.end();
+  if (messageLog.begin()) {
+    if (!historyMigrate(messageLog)) Serial.println("History migration failed");
+  } else {
+    Serial.println("Message log partition not found");
+  }
+  messageCount = messageLog.count();
+  if (messageIndex.begin()) {
+    catchUpIndex();
+  } else {
+    Serial.println("Message index partition not found");
+  }
+  clockBase = messageIndex.lastTime();
+
+  potContinuous = startPotSampling();
+  if (!potContinuous) Serial.println("ADC continuous mode unavailable, polling the knob");
+  samplePot();
+
+  keypad.setDebounceTime(5);
+  esp_timer_create_args_t scanTimer = {};
+  scanTimer.callback = KeyEvents::scanTimer;
+  scanTimer.arg = &keyEvents;
+  scanTimer.name = "keypad";
+  esp_timer_handle_t scanHandle;
+  if (esp_timer_create(&scanTimer, &scanHandle) != ESP_OK || esp_timer_start_periodic(scanHandle, keyScanUs) != ESP_OK) {
+    Serial.println("Keypad scan timer failed");
+  }
 
   WiFi.mode(WIFI_STA);
+  uint8_t mac[6];
+  WiFi.macAddress(mac);
+  nodeId = mac[4] << 8 | mac[5];
+  link.begin(nodeId, esp_random());
+  mesh.begin(nodeId, millis());
+
+  uint8_t networkKey[FrameCipher::KEY_LEN];
+  Preferences prefs;
+  prefs.begin("crypto", true);
+  bool haveKey = prefs.getBytes("key", networkKey, sizeof(networkKey)) == sizeof(networkKey);
+  prefs.end();
+  cipher.begin(haveKey ? networkKey : nullptr, nodeId);
+  memset(networkKey, 0, sizeof(networkKey));
+  if (!haveKey) Serial.println("No network key: send \"key <32 hex digits>\" on this console");
+  link.setSealer(FrameCipher::sealFrame, &cipher);
+  mesh.setSealer(FrameCipher::sealFrame, &cipher);
+
   if (esp_now_init() != ESP_OK) {
     display.clearBuffer();
     display.drawStr(0, 10, "ESP-NOW Init Failed");
@@ -136,14 +1063,8 @@ void setup() {
   }
 
   esp_now_register_recv_cb(onReceive);
-  esp_now_peer_info_t peerInfo = {};
-  memcpy(peerInfo.peer_addr, peerAddress, 6);
-  peerInfo.channel = 0;
-  peerInfo.encrypt = false;
-
-  if (!esp_now_is_peer_exist(peerAddress)) {
-    esp_now_add_peer(&peerInfo);
-  }
+  esp_now_register_send_cb(onSent);
+  updatePeer(nullptr, Mesh::BROADCAST_MAC, true);
 
   display.clearBuffer();
   display.drawStr(0, 10, "Ready to type");
@@ -152,36 +1073,51 @@ void setup() {
 
 // Loop
 void loop() {
-  char key = keypad.getKey();
+  static uint32_t lastLoopUs = micros();
+  uint32_t nowUs = micros();
+  if (loopCount > 0) loopTime.record(nowUs - lastLoopUs);
+  lastLoopUs = nowUs;
+  loopCount++;
+  runTasks();
+  processReceived();
 
-  // Potentiometer Reading
-  int potVal = 0;
-  for (int i = 0; i < 10; i++) {
-    potVal += analogRead(potPin);
-    delay(1);
+  // Taps, plus auto-repeat for deleting and for scrolling history
+  char key = NO_KEY;
+  KeyEvent event;
+  if (keyEvents.next(event)) {
+    bool repeats = isTypingMode ? event.key == '*' : event.key == 'A' || event.key == 'B';
+    if (event.type == KEY_PRESS || (event.type == KEY_REPEAT && repeats)) {
+      key = event.key;
+      keyWaiting = true;
+      uiVersion++;
+      lastActivity = millis();
+      keySeenUs = event.timeUs;
+    }
   }
-  potVal /= 10;
 
   // Store old index before mapping to check knob movement
   static int oldVirtualIndex = -1;
-  int virtualIndex = map(potVal, 0, 4095, 0, totalSlots - 1);
+  int virtualIndex = knob.index();
   bool knobMoved = virtualIndex != oldVirtualIndex;
   oldVirtualIndex = virtualIndex;
 
   // If new message received, show it and pause rest of UI until key or knob input
   if (newMessageReceived) {
-    display.clearBuffer();
-    display.setFont(u8g2_font_6x10_tr);
-    display.drawStr(0, 10, "Received:");
-    display.drawStr(0, 30, lastReceivedMessage.c_str());
-    display.sendBuffer();
+    render();
 
     if (key || knobMoved) {
       newMessageReceived = false;
+      uiVersion++;
     }
     return;
   }
 
+  // The metrics screen takes every key while open
+  if (key && metricsPage >= 0) {
+    metricsKey(key);
+    key = NO_KEY;
+  }
+
   // Calculate actual char index by ignoring dummy slots
   int charIndex = virtualIndex / (extraSlotsBetween + 1);
   int remainder = virtualIndex % (extraSlotsBetween + 1);
@@ -189,82 +1125,115 @@ void loop() {
   if (remainder == 0 && charIndex != lastStableCharIndex) {
     currentCharIndex = charIndex;
     lastStableCharIndex = currentCharIndex;
+    uiVersion++;
+  }
+
+  char timedOut = multiTap.tick(millis());
+  if (timedOut) {
+    appendChar(timedOut);
+    uiVersion++;
   }
 
   if (key) {
+    // Any key press ends a toast early so its effect is visible
+    toastUntil = 0;
+
     if (key == 'D') {
+      if (isTypingMode) commitEntry();
       isTypingMode = !isTypingMode;
+      quickReplyIndex = -1;
       historyIndex = 0;
-      delay(300);
+      if (!isTypingMode) prefetchNeighbours();
     }
 
-    if (isTypingMode) {
+    if (isTypingMode && quickReplyIndex >= 0) {
+      int count = quickReplyCount();
+      if (key == 'A') {
+        quickReplyIndex = (quickReplyIndex + count - 1) % count;
+      } else if (key == 'B') {
+        quickReplyIndex = (quickReplyIndex + 1) % count;
+      } else if (key == '*') {
+        quickReplyIndex = -1;
+      } else if (key == '#') {
+        if (strstr(quickReply(quickReplyIndex), "{}")) {
+          pendingReply = quickReplyIndex;
+        } else {
+          String text = quickReply(quickReplyIndex);
+          if (sendText(text)) showToast(sendDest == FRAME_BROADCAST ? "Sent:" : "Sending:", text, 1000);
+          else showToast(cipher.keyed() ? "Send Failed" : "No network key", text, 1000);
+        }
+        quickReplyIndex = -1;
+      }
+    } else if (isTypingMode) {
       if (key == '#') {
-        if (messageBuffer.length() > 0) {
-          String encrypted = encrypt(messageBuffer);
-          esp_now_send(peerAddress, (uint8_t *)encrypted.c_str(), encrypted.length() + 1);
-          saveMessage(messageBuffer, "Sent");
-
-          display.clearBuffer();
-          display.drawStr(0, 10, "Sent:");
-          display.drawStr(0, 30, messageBuffer.c_str());
-          display.sendBuffer();
+        commitEntry();
+        String text = pendingReply >= 0 ? formatReply(pendingReply, messageBuffer) : messageBuffer;
+        if (messageBuffer.length() == 0 && pendingReply < 0) {
+          quickReplyIndex = 0;
+        } else if (sendText(text)) {
+          showToast(sendDest == FRAME_BROADCAST ? "Sent:" : "Sending:", text, 1000);
           messageBuffer = "";
-          delay(1000);
+          pendingReply = -1;
+        } else {
+          showToast(cipher.keyed() ? "Send Failed" : "No network key", text, 1000);
         }
       } else if (key == '*') {
-        if (messageBuffer.length() > 0) messageBuffer.remove(messageBuffer.length() - 1);
+        if (multiTap.pending()) {
+          multiTap.cancel();
+        } else if (!t9.back() && messageBuffer.length() > 0) {
+          messageBuffer.remove(messageBuffer.length() - 1);
+        }
+      } else if (key == 'A') {
+        nextDestination();
+      } else if (key == 'B') {
+        commitEntry();
+        inputMode = (InputMode)((inputMode + 1) % INPUT_MODES);
+        showToast("Input:", inputModeNames[inputMode], 500);
       } else if (key == 'C') {
+        multiTap.cancel();
+        t9.clear();
         messageBuffer = "";
-        display.clearBuffer();
-        display.drawStr(0, 10, "Typing Cleared");
-        display.sendBuffer();
-        delay(500);
-      } else if (key == '0') {
-        messageBuffer += characterSet[currentCharIndex];
+        pendingReply = -1;
+        showToast("Typing Cleared", "", 500);
+      } else if (key >= '0' && key <= '9') {
+        if (inputMode == INPUT_KNOB) {
+          if (key == '0') appendChar(characterSet[currentCharIndex]);
+        } else if (inputMode == INPUT_MULTITAP) {
+          char c = multiTap.press(key, millis());
+          if (c) appendChar(c);
+        } else if (key == '0') {
+          commitEntry();
+          appendChar(' ');
+        } else if (key == '1') {
+          t9.next();
+        } else if (!t9.press(key)) {
+          showToast("No word for", String(key), 500);
+        }
       }
     } else {
       if (key == 'A') {
         if (historyIndex > 0) historyIndex--;
+        prefetchNeighbours();
       } else if (key == 'B') {
         if (historyIndex < messageCount - 1) historyIndex++;
+        prefetchNeighbours();
       } else if (key == 'C') {
-        prefs.begin("messages", false);
-        prefs.clear();
-        prefs.end();
+        messageLog.clear();
+        historyCache.invalidate();
         messageCount = 0;
         historyIndex = 0;
-        display.clearBuffer();
-        display.drawStr(0, 10, "History Cleared");
-        display.sendBuffer();
-        delay(1000);
-        return;
+        showToast("History Cleared", "", 1000);
+      } else if (key == '*') {
+        historyFilter = (HistoryFilter)((historyFilter + 1) % FILTERS);
+        showToast("Filter:", filterNames[historyFilter], 500);
+      } else if (key == '#') {
+        if (!findInHistory()) showToast(noMatchTitle().c_str(), messageBuffer, 1000);
+      } else if (key == '0') {
+        metricsPage = 0;
       }
     }
   }
 
   // Display
-  display.clearBuffer();
-  display.setFont(u8g2_font_6x10_tr);
-
-  if (isTypingMode) {
-    display.drawStr(0, 10, "Typing:");
-    display.drawStr(50, 10, messageBuffer.c_str());
-
-    display.drawStr(0, 30, "Select:");
-    String shownChar = characterSet[currentCharIndex] == ' ' ? "[SPACE]" : String(characterSet[currentCharIndex]);
-    display.drawStr(50, 30, shownChar.c_str());
-  } else {
-    display.drawStr(0, 10, "History:");
-    if (messageCount == 0) {
-      display.drawStr(0, 30, "No messages");
-    } else {
-      String histMsg = loadMessage(historyIndex);
-      String idxStr = String(historyIndex + 1) + "/" + String(messageCount);
-      display.drawStr(0, 20, idxStr.c_str());
-      display.drawStr(0, 40, histMsg.c_str());
-    }
-  }
-
-  display.sendBuffer();
+  render();
 }